@@ -0,0 +1,499 @@
+/* buffer.cc - Micro-benchmarks of the buffer implementation.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "../src/buffer.h"
+#include "../src/util.h"
+
+
+/*
+ * This is built by `make bench-buffer`, and links against only the
+ * buffer library - not curses, or Lua.
+ *
+ * Each operation is timed against buffers of increasing size, and with
+ * lines of differing lengths.  Every operation is repeated until it has
+ * run for at least `--min-time` seconds, and we report the average.
+ *
+ * Options:
+ *
+ *   --filter text      Run only the benchmarks whose name contains the text.
+ *   --lengths file     Also use lines with the lengths of those in the file.
+ *   --max-size size    The largest buffer to test, such as 64M or 1G.
+ *   --min-time secs    How long to run each benchmark for.
+ *
+ * The buffer needs roughly 40 bytes for each character, so a 1G buffer
+ * needs a machine with a lot of memory.
+ */
+
+
+/**
+ * A small, and deterministic, random number generator.
+ */
+class rng
+{
+public:
+    rng() : m_state(0x2545F4914F6CDD1DULL) {};
+
+    unsigned int next(unsigned int max)
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+        return (m_state % max);
+    }
+
+private:
+    unsigned long long m_state;
+};
+
+
+/**
+ * A distribution of line-lengths.
+ */
+struct distribution
+{
+    std::string name;
+    std::function<int(rng &)> length;
+};
+
+
+/**
+ * A benchmark, which is run against a buffer.
+ *
+ * If `bytes` is set the operation processes the whole buffer, so we
+ * report the throughput too.
+ */
+struct benchmark
+{
+    std::string name;
+    bool bytes;
+    std::function<void(Buffer *)> fn;
+};
+
+
+/**
+ * Generate a buffer of (at least) the given size, in bytes of UTF-8,
+ * storing the actual size in `actual`.
+ *
+ * Most characters are ASCII, but one in fifty is a two or three byte
+ * character.
+ */
+static Buffer *generate(size_t size, distribution &dist, size_t *actual)
+{
+    Buffer *b = new Buffer("bench");
+    rng r;
+
+    /*
+     * Replace the empty row a buffer starts with.
+     */
+    delete b->rows.at(0);
+    b->rows.clear();
+
+    size_t done = 0;
+
+    while (done < size)
+    {
+        erow *row = new erow();
+        int len   = dist.length(r);
+
+        row->chars->reserve(len);
+
+        for (int i = 0; i < len; i++)
+        {
+            wchar_t c;
+
+            switch (r.next(100))
+            {
+            case 0:
+                c = 0xE9;
+                break;
+
+            case 1:
+                c = 0x6F22;
+                break;
+
+            default:
+                c = ' ' + r.next(95);
+                break;
+            }
+
+            row->chars->push_back(std::wstring(1, c));
+            done += Util::utf8_length(c);
+        }
+
+        b->rows.push_back(row);
+        done += 1;
+    }
+
+    *actual = done;
+    return b;
+}
+
+
+/**
+ * Read the lengths of the lines in the given file.
+ */
+static std::vector<int> read_lengths(const char *path)
+{
+    std::vector<int> lengths;
+    std::ifstream in(path);
+    std::string line;
+
+    while (std::getline(in, line))
+        lengths.push_back(line.size());
+
+    return lengths;
+}
+
+
+/**
+ * Parse a size such as "64K" or "1G".
+ */
+static size_t parse_size(const char *str)
+{
+    char *end;
+    size_t size = strtoul(str, &end, 10);
+
+    switch (*end)
+    {
+    case 'G':
+        size *= 1024;
+
+    /* fall through */
+    case 'M':
+        size *= 1024;
+
+    /* fall through */
+    case 'K':
+        size *= 1024;
+    }
+
+    return size;
+}
+
+
+/**
+ * Format the given size, such as "64K".
+ */
+static std::string format_size(size_t size)
+{
+    const char *units = "BKMG";
+    int u = 0;
+
+    while (size >= 1024 && size % 1024 == 0 && u < 3)
+    {
+        size /= 1024;
+        u++;
+    }
+
+    return (std::to_string(size) + (u > 0 ? std::string(1, units[u]) : ""));
+}
+
+
+/**
+ * Format a duration, given in nanoseconds.
+ */
+static std::string format_time(double ns)
+{
+    char buf[32];
+
+    if (ns < 1000)
+        snprintf(buf, sizeof(buf), "%.1fns", ns);
+    else if (ns < 1000000)
+        snprintf(buf, sizeof(buf), "%.2fus", ns / 1000);
+    else if (ns < 1000000000)
+        snprintf(buf, sizeof(buf), "%.2fms", ns / 1000000);
+    else
+        snprintf(buf, sizeof(buf), "%.2fs", ns / 1000000000);
+
+    return buf;
+}
+
+
+/**
+ * The operations we measure.
+ *
+ * Edits are made in the middle of the buffer, and undone, so that the
+ * buffer is the same for each iteration.
+ */
+static std::vector<benchmark> benchmarks()
+{
+    std::vector<benchmark> all;
+
+    all.push_back({"pos2offset", true, [](Buffer * b)
+    {
+        int y = b->rows.size() - 1;
+        b->pos2offset(b->rows.at(y)->chars->size(), y);
+    }
+                  });
+
+    all.push_back({"text", true, [](Buffer * b)
+    {
+        b->text();
+    }
+                  });
+
+    all.push_back({"update_syntax", true, [](Buffer * b)
+    {
+        static std::string colours;
+        static int prepared = -1;
+
+        if (prepared != b->id())
+        {
+            colours.assign(b->text().size(), 3);
+            prepared = b->id();
+        }
+
+        b->update_syntax(colours.data(), colours.size());
+    }
+                  });
+
+    all.push_back({"insert_delete_char", false, [](Buffer * b)
+    {
+        int y = b->rows.size() / 2;
+        int x = b->rows.at(y)->chars->size() / 2;
+
+        b->insert_char(x, y, 'x');
+        b->delete_char(x, y);
+    }
+                  });
+
+    all.push_back({"insert_delete_row", false, [](Buffer * b)
+    {
+        int y = b->rows.size() / 2;
+
+        b->rows.insert(b->rows.begin() + y, new erow());
+        delete b->rows.at(y);
+        b->rows.erase(b->rows.begin() + y);
+    }
+                  });
+
+    all.push_back({"split_join_row", false, [](Buffer * b)
+    {
+        int y = b->rows.size() / 2;
+        int x = b->rows.at(y)->chars->size() / 2;
+
+        b->split_row(x, y);
+        b->join_row(y + 1);
+    }
+                  });
+
+    return all;
+}
+
+
+/**
+ * Run the given benchmark for at least `min_time` seconds, returning the
+ * number of iterations, and the time each took in nanoseconds.
+ */
+static void run(benchmark &bench, Buffer *b, double min_time, long *iterations, double *ns)
+{
+    long count = 1;
+
+    while (true)
+    {
+        long start = Util::now_us();
+
+        for (long i = 0; i < count; i++)
+            bench.fn(b);
+
+        long elapsed = Util::now_us() - start;
+
+        if (elapsed >= min_time * 1000000 || count >= (1L << 30))
+        {
+            *iterations = count;
+            *ns         = elapsed * 1000.0 / count;
+            return;
+        }
+
+        /*
+         * Aim for the minimum time, without growing too quickly when the
+         * first attempts were too quick to measure.
+         */
+        long next = (elapsed > 0) ? (long)(count * min_time * 1000000 * 1.2 / elapsed) : count * 10;
+        count     = std::max(count * 2, std::min(next, count * 100));
+    }
+}
+
+
+/**
+ * Run each benchmark, against each buffer.
+ */
+int main(int argc, char *argv[])
+{
+    size_t max_size     = parse_size("4M");
+    double min_time     = 0.2;
+    const char *filter  = NULL;
+    const char *lengths = NULL;
+
+    while (1)
+    {
+        static struct option long_options[] =
+        {
+            {"filter", required_argument, 0, 'f'},
+            {"lengths", required_argument, 0, 'l'},
+            {"max-size", required_argument, 0, 's'},
+            {"min-time", required_argument, 0, 't'},
+            {0, 0, 0, 0}
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, "f:l:s:t:", long_options, &option_index);
+
+        if (c == -1)
+            break;
+
+        switch (c)
+        {
+        case 'f':
+            filter = optarg;
+            break;
+
+        case 'l':
+            lengths = optarg;
+            break;
+
+        case 's':
+            max_size = parse_size(optarg);
+            break;
+
+        case 't':
+            min_time = atof(optarg);
+            break;
+
+        default:
+            fprintf(stderr, "Usage: %s [--filter text] [--lengths file] [--max-size size] [--min-time secs]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    /*
+     * The lengths of lines, approximating source code, prose which has
+     * been wrapped, log-files, and minified code.
+     */
+    std::vector<distribution> dists;
+
+    dists.push_back({"code", [](rng & r)
+    {
+        return (r.next(5) == 0) ? 0 : 4 + (int)r.next(60);
+    }
+                    });
+    dists.push_back({"prose", [](rng & r)
+    {
+        return (r.next(10) == 0) ? 0 : 60 + (int)r.next(20);
+    }
+                    });
+    dists.push_back({"log", [](rng & r)
+    {
+        return 80 + (int)r.next(160);
+    }
+                    });
+    dists.push_back({"minified", [](rng & r)
+    {
+        return 2000 + (int)r.next(8000);
+    }
+                    });
+
+    /*
+     * Lines sampled from a real file.
+     */
+    if (lengths != NULL)
+    {
+        std::vector<int> sample = read_lengths(lengths);
+
+        if (sample.empty())
+        {
+            fprintf(stderr, "There are no lines in %s\n", lengths);
+            return 1;
+        }
+
+        std::string name = lengths;
+        name = name.substr(name.rfind('/') + 1);
+
+        dists.push_back({name, [sample](rng & r)
+        {
+            return sample[r.next(sample.size())];
+        }
+                        });
+    }
+
+    std::vector<benchmark> all = benchmarks();
+
+    printf("%-48s %12s %12s %10s\n", "benchmark", "iterations", "time", "MB/s");
+
+    for (size_t size = 1024; size <= max_size; size *= 16)
+    {
+        for (std::vector<distribution>::iterator d = dists.begin(); d != dists.end(); ++d)
+        {
+            Buffer *b     = NULL;
+            size_t actual = 0;
+
+            for (std::vector<benchmark>::iterator it = all.begin(); it != all.end(); ++it)
+            {
+                std::string name = d->name + "/" + format_size(size) + "/" + it->name;
+
+                if (filter != NULL && name.find(filter) == std::string::npos)
+                    continue;
+
+                /*
+                 * Buffers are only generated if they're needed.
+                 */
+                if (b == NULL)
+                    b = generate(size, *d, &actual);
+
+                long iterations;
+                double ns;
+                run(*it, b, min_time, &iterations, &ns);
+
+                printf("%-48s %12ld %12s", name.c_str(), iterations, format_time(ns).c_str());
+
+                if (it->bytes)
+                    printf(" %10.1f", actual / (ns / 1000000000.0) / (1024 * 1024));
+
+                printf("\n");
+                fflush(stdout);
+            }
+
+            delete b;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,544 @@
+/* replay.cc - Replay key-scripts against the editor, measuring latency.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <getopt.h>
+#include <locale.h>
+#include <pty.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../src/editor.h"
+#include "../src/util.h"
+
+
+/*
+ * This is built by `make bench-replay`, and links against the editor
+ * itself.  Each key-script is replayed against a new editor, which has
+ * loaded only the default configuration, and the given file.
+ *
+ * Key-scripts contain one command per line:
+ *
+ *   # A comment.
+ *   type hello\n        - Type the text, each character is a keystroke.
+ *   press KEY_NPAGE 50  - Press the key, the given number of times.
+ *   keys ^S f o o ENTER - Press the keys in a single burst, as a prompt needs.
+ *   paste some\ntext    - Paste the text, via bracketed-paste.
+ *   idle                - Run the `on_idle` hook, which highlights the buffer.
+ *
+ * Keys are named as they are for `bind()`.  Text may contain `\n`, `\t`
+ * and `\\` escapes.
+ */
+
+
+/**
+ * A single step of a key-script.
+ */
+struct step
+{
+    /*
+     * The keys to process, in one burst.
+     */
+    std::vector<unsigned int> keys;
+
+    /*
+     * Should we run the idle-hook, rather than process keys?
+     */
+    bool idle;
+};
+
+
+/**
+ * Convert the name of a key, as used by `bind()`, to the key-code the
+ * editor would read.  Meta-keys become two keys, as they're typed.
+ *
+ * Returns false if the name isn't recognized.
+ */
+static bool parse_key(const std::string &name, std::vector<unsigned int> &keys)
+{
+    if (name.compare(0, 2, "M-") == 0 && name.size() > 2)
+    {
+        keys.push_back(27);
+        return parse_key(name.substr(2), keys);
+    }
+
+    if (name == "ENTER")
+        keys.push_back('\n');
+    else if (name == "ESC")
+        keys.push_back(27);
+    else if (name == "TAB")
+        keys.push_back('\t');
+    else if (name == "SPACE")
+        keys.push_back(' ');
+    else if (name.size() == 2 && name[0] == '^' && name[1] >= '@' && name[1] <= '_')
+        keys.push_back(name[1] - '@');
+    else if (name.compare(0, 4, "KEY_") == 0)
+    {
+        for (int c = KEY_MIN; c <= KEY_MAX; c++)
+        {
+            const char *n = keyname(c);
+
+            if (n != NULL && name == n)
+            {
+                keys.push_back(c);
+                return true;
+            }
+        }
+
+        return false;
+    }
+    else
+    {
+        std::wstring wide;
+        Util::utf8_to_wide(name.c_str(), name.size(), wide);
+
+        bool single = (wide.size() == 1);
+
+        if (single)
+            keys.push_back(wide[0]);
+
+        return single;
+    }
+
+    return true;
+}
+
+
+/**
+ * Expand the escapes in the given text, returning the characters.
+ */
+static std::vector<unsigned int> parse_text(const std::string &text)
+{
+    std::vector<unsigned int> out;
+
+    std::wstring wide;
+    Util::utf8_to_wide(text.c_str(), text.size(), wide);
+
+    for (const wchar_t *c = wide.c_str(); *c; c++)
+    {
+        if (*c != '\\' || c[1] == '\0')
+        {
+            out.push_back(*c);
+            continue;
+        }
+
+        c++;
+
+        if (*c == 'n')
+            out.push_back('\n');
+        else if (*c == 't')
+            out.push_back('\t');
+        else
+            out.push_back(*c);
+    }
+
+    return out;
+}
+
+
+/**
+ * Parse the given key-script, exiting on error.
+ */
+static std::vector<step> parse_script(const char *path)
+{
+    std::vector<step> steps;
+    std::ifstream in(path);
+    std::string line;
+    int n = 0;
+
+    if (!in)
+    {
+        fprintf(stderr, "Failed to open %s\n", path);
+        exit(2);
+    }
+
+    while (std::getline(in, line))
+    {
+        n++;
+
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        size_t sp       = line.find(' ');
+        std::string cmd = line.substr(0, sp);
+        std::string arg = (sp == std::string::npos) ? "" : line.substr(sp + 1);
+
+        step s;
+        s.idle = false;
+        bool ok = true;
+
+        if (cmd == "idle")
+        {
+            s.idle = true;
+            steps.push_back(s);
+        }
+        else if (cmd == "type")
+        {
+            std::vector<unsigned int> text = parse_text(arg);
+
+            for (std::vector<unsigned int>::iterator it = text.begin(); it != text.end(); ++it)
+            {
+                s.keys.assign(1, *it);
+                steps.push_back(s);
+            }
+        }
+        else if (cmd == "paste")
+        {
+            std::vector<unsigned int> text = parse_text(arg);
+            const char *start = "\033[200~";
+            const char *end   = "\033[201~";
+
+            s.keys.insert(s.keys.end(), start, start + strlen(start));
+            s.keys.insert(s.keys.end(), text.begin(), text.end());
+            s.keys.insert(s.keys.end(), end, end + strlen(end));
+            steps.push_back(s);
+        }
+        else if (cmd == "press")
+        {
+            char name[64];
+            int count = 1;
+
+            ok = (sscanf(arg.c_str(), "%63s %d", name, &count) >= 1) && parse_key(name, s.keys);
+
+            for (int i = 0; ok && i < count; i++)
+                steps.push_back(s);
+        }
+        else if (cmd == "keys")
+        {
+            char *copy = strdup(arg.c_str());
+
+            for (char *tok = strtok(copy, " "); ok && tok != NULL; tok = strtok(NULL, " "))
+                ok = parse_key(tok, s.keys);
+
+            free(copy);
+            steps.push_back(s);
+        }
+        else
+        {
+            ok = false;
+        }
+
+        if (!ok)
+        {
+            fprintf(stderr, "%s:%d: invalid command: %s\n", path, n, line.c_str());
+            exit(2);
+        }
+    }
+
+    return steps;
+}
+
+
+/**
+ * Return the given percentile of the samples.
+ */
+static double percentile(std::vector<double> samples, int p)
+{
+    if (samples.empty())
+        return 0;
+
+    std::sort(samples.begin(), samples.end());
+
+    size_t i = (p * samples.size() + 99) / 100;
+    return samples[i > 0 ? i - 1 : 0];
+}
+
+
+/*
+ * Our results, by name, in the order they were produced.
+ */
+static std::vector<std::pair<std::string, double> > results;
+
+
+/**
+ * Record the given result.
+ */
+static void result(const std::string &name, double value)
+{
+    results.push_back(std::make_pair(name, value));
+}
+
+
+/**
+ * Replay the steps against a new editor, which is editing the given file.
+ */
+static void replay(const char *file, const std::string &name, const std::vector<step> &steps)
+{
+    Editor *e = Editor::instance();
+    e->load_default_config();
+    e->load_files(std::vector<std::string>(1, file));
+
+    /*
+     * The first highlighting loads the syntax-module, so isn't timed.
+     */
+    e->call_lua(HOOK_ON_IDLE);
+    e->draw_screen();
+
+    std::vector<double> latency;
+    std::vector<double> frame;
+    std::vector<double> idle;
+
+    for (std::vector<step>::const_iterator it = steps.begin(); it != steps.end(); ++it)
+    {
+        long start = Util::now_us();
+
+        if (it->idle)
+            e->call_lua(HOOK_ON_IDLE);
+        else
+            e->process_keys(it->keys);
+
+        long drawing = Util::now_us();
+        e->draw_screen();
+        long end = Util::now_us();
+
+        if (it->idle)
+        {
+            idle.push_back((end - start) / 1000.0);
+        }
+        else
+        {
+            latency.push_back((end - start) / 1000.0);
+            frame.push_back((end - drawing) / 1000.0);
+        }
+    }
+
+    Editor::destroy_instance();
+
+    result(name + ".steps", latency.size() + idle.size());
+
+    if (!latency.empty())
+    {
+        result(name + ".latency_p50_ms", percentile(latency, 50));
+        result(name + ".latency_p99_ms", percentile(latency, 99));
+        result(name + ".frame_p50_ms", percentile(frame, 50));
+        result(name + ".frame_p99_ms", percentile(frame, 99));
+    }
+
+    if (!idle.empty())
+    {
+        result(name + ".idle_p50_ms", percentile(idle, 50));
+        result(name + ".idle_p99_ms", percentile(idle, 99));
+    }
+}
+
+
+/**
+ * Compare our results with those in the given file, returning the number
+ * of regressions - results which have grown by more than `threshold`
+ * percent.
+ */
+static int compare(const char *path, double threshold)
+{
+    std::map<std::string, double> baseline;
+    std::ifstream in(path);
+    std::string name;
+    double value;
+
+    if (!in)
+    {
+        fprintf(stderr, "Failed to open %s\n", path);
+        exit(2);
+    }
+
+    while (in >> name >> value)
+        baseline[name] = value;
+
+    int regressions = 0;
+
+    printf("\n%-32s %12s %12s %8s\n", "", "baseline", "current", "change");
+
+    for (std::vector<std::pair<std::string, double> >::iterator it = results.begin(); it != results.end(); ++it)
+    {
+        if (baseline.find(it->first) == baseline.end() || it->first.find(".steps") != std::string::npos)
+            continue;
+
+        double base   = baseline[it->first];
+        double change = (base > 0) ? (it->second - base) * 100.0 / base : 0;
+        bool worse    = change > threshold;
+
+        printf("%-32s %12.3f %12.3f %+7.1f%%%s\n", it->first.c_str(), base,
+               it->second, change, worse ? " REGRESSION" : "");
+
+        if (worse)
+            regressions++;
+    }
+
+    return regressions;
+}
+
+
+/**
+ * Setup curses, drawing to /dev/null.
+ *
+ * The editor reads the size of the terminal from STDIN, so that is a
+ * pseudo-terminal of the given size.
+ */
+static void setup(int rows, int cols)
+{
+    int master, slave;
+    struct winsize ws;
+    memset(&ws, 0, sizeof(ws));
+    ws.ws_row = rows;
+    ws.ws_col = cols;
+
+    if (openpty(&master, &slave, NULL, NULL, &ws) != 0)
+    {
+        perror("openpty");
+        exit(2);
+    }
+
+    dup2(slave, STDIN_FILENO);
+
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%d", rows);
+    setenv("LINES", buf, 1);
+    snprintf(buf, sizeof(buf), "%d", cols);
+    setenv("COLUMNS", buf, 1);
+
+    char e[] = "ESCDELAY=0";
+    putenv(e);
+    setlocale(LC_ALL, "");
+
+    SCREEN *screen = newterm("xterm-256color", fopen("/dev/null", "w"), fdopen(slave, "r"));
+
+    if (screen == NULL)
+    {
+        fprintf(stderr, "Failed to initialize curses\n");
+        exit(2);
+    }
+
+    set_term(screen);
+    start_color();
+
+    for (int i = 1; i < COLORS && i < COLOR_PAIRS && i <= 255; i++)
+        init_pair(i, i, COLOR_BLACK);
+
+    raw();
+    keypad(stdscr, TRUE);
+    noecho();
+}
+
+
+/**
+ * Replay each key-script, and report the results.
+ */
+int main(int argc, char *argv[])
+{
+    const char *baseline = NULL;
+    double threshold     = 10;
+    int rows             = 24;
+    int cols             = 80;
+
+    while (1)
+    {
+        static struct option long_options[] =
+        {
+            {"compare", required_argument, 0, 'c'},
+            {"size", required_argument, 0, 's'},
+            {"threshold", required_argument, 0, 't'},
+            {0, 0, 0, 0}
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, "c:s:t:", long_options, &option_index);
+
+        if (c == -1)
+            break;
+
+        switch (c)
+        {
+        case 'c':
+            baseline = optarg;
+            break;
+
+        case 's':
+            if (sscanf(optarg, "%dx%d", &rows, &cols) != 2)
+                return 2;
+
+            break;
+
+        case 't':
+            threshold = atof(optarg);
+            break;
+
+        default:
+            return 2;
+        }
+    }
+
+    if (argc - optind < 2)
+    {
+        fprintf(stderr, "Usage: %s [--size ROWSxCOLS] [--compare baseline] [--threshold percent] file script1.keys [.. scriptN.keys]\n", argv[0]);
+        return 2;
+    }
+
+    const char *file = argv[optind];
+
+    /*
+     * Parse the scripts before we touch the terminal.
+     */
+    std::vector<std::pair<std::string, std::vector<step> > > scripts;
+
+    for (int i = optind + 1; i < argc; i++)
+    {
+        std::string name = argv[i];
+        name = name.substr(name.rfind('/') + 1);
+        name = name.substr(0, name.find('.'));
+
+        scripts.push_back(std::make_pair(name, parse_script(argv[i])));
+    }
+
+    setup(rows, cols);
+
+    for (auto it = scripts.begin(); it != scripts.end(); ++it)
+        replay(file, it->first, it->second);
+
+    endwin();
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    result("peak_rss_kb", usage.ru_maxrss);
+
+    for (auto it = results.begin(); it != results.end(); ++it)
+        printf("%-32s %.3f\n", it->first.c_str(), it->second);
+
+    if (baseline != NULL && compare(baseline, threshold) > 0)
+        return 1;
+
+    return 0;
+}
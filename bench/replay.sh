@@ -0,0 +1,31 @@
+#!/bin/sh
+#
+# Replay the key-scripts beneath bench/scripts/ against a large C++ file,
+# reporting the latency of each keystroke, the time taken to draw each
+# frame, and our peak memory usage.
+#
+# Usage: bench/replay.sh [--compare baseline] [--threshold percent] [--size RxC]
+#
+# To detect regressions save the results of a run, and compare against
+# them later - the exit-code is non-zero if any result has grown by more
+# than the threshold, which defaults to 10%:
+#
+#   bench/replay.sh > baseline.txt
+#   ...
+#   bench/replay.sh --compare baseline.txt
+#
+# Via make the options are given as `make bench-replay BENCH_ARGS=".."`.
+#
+
+dir=$(mktemp -d)
+trap 'rm -rf $dir' EXIT
+
+#
+# The file is named for the highlighting mode we want, and is built from
+# our own source, repeated until it is a couple of megabytes in size.
+#
+for i in $(seq 1 40); do
+    cat src/*.cc
+done > $dir/big.cc
+
+./bench/replay "$@" $dir/big.cc bench/scripts/*.keys
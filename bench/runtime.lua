@@ -0,0 +1,86 @@
+--
+-- Benchmark the Lua runtime the editor was built against.
+--
+-- This is loaded via `--config`, and once the editor has started it times
+-- syntax-highlighting of the current buffer, and the primitives which a
+-- keystroke typically invokes.  The results are appended to the file named
+-- by $KILUA_BENCH_OUT, and then the editor exits.
+--
+-- Usually this is run via `make bench-runtime`, which builds the editor
+-- against both Lua 5.2 and LuaJIT.
+--
+
+
+--
+-- The number of times each test is repeated.
+--
+local iterations = tonumber(os.getenv("KILUA_BENCH_ITERATIONS") or "") or 20
+
+
+--
+-- Run the given function `count` times, returning the average time taken
+-- by each call in milliseconds.
+--
+local function time( count, fn )
+   local start = os.clock()
+   for i = 1, count do
+      fn()
+   end
+   return ( os.clock() - start ) * 1000 / count
+end
+
+
+--
+-- Run once the editor, and the default configuration, have loaded.
+--
+timer( 100, function()
+
+   local results = {}
+
+   --
+   -- Highlighting: parse the buffer, and apply the colours.
+   --
+   -- The first run loads the syntax-module, and disables highlighting if
+   -- that fails, so it isn't timed.
+   --
+   local text = text()
+   on_syntax_highlight( text )
+
+   if ( syntax() ~= "" ) then
+      results[#results + 1] = string.format( "highlight %.3fms", time( iterations, function()
+         local colours = on_syntax_highlight( text )
+         if ( colours ~= nil and colours ~= "" ) then
+            update_colours( colours )
+         end
+      end))
+   else
+      results[#results + 1] = "highlight n/a"
+   end
+
+   --
+   -- Keystrokes: insert and delete a character, move, and read the line.
+   --
+   results[#results + 1] = string.format( "keystroke %.4fms", time( iterations * 1000, function()
+      insert( "x" )
+      move( "left" )
+      move( "right" )
+      delete()
+      local y = select( 2, point() )
+      local l = line( y + 1 )
+   end))
+
+   --
+   -- Reading the whole buffer, a line at a time.
+   --
+   results[#results + 1] = string.format( "lines %.3fms", time( iterations, function()
+      for n, l in each_line() do
+      end
+   end))
+
+   local runtime = jit and jit.version or _VERSION
+   local out = io.open( os.getenv( "KILUA_BENCH_OUT" ) or "kilua-bench.txt", "a" )
+   out:write( string.format( "%-16s %s\n", runtime, table.concat( results, "  " ) ) )
+   out:close()
+
+   exit()
+end)
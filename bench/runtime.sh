@@ -0,0 +1,44 @@
+#!/bin/sh
+#
+# Compare the performance of the editor when built against Lua 5.2, and
+# against LuaJIT, by running bench/runtime.lua under each.
+#
+# Usage: bench/runtime.sh [file]
+#
+# The file defaults to src/editor.cc, which is highlighted as C++.
+#
+
+file=$(realpath "${1:-src/editor.cc}") || exit 1
+out=$(mktemp)
+
+#
+# We build in a copy of the tree, so that the build in the checkout is
+# left alone, and without AddressSanitizer, which would distort the
+# numbers.
+#
+tree=$(mktemp -d)
+trap 'rm -rf "$tree" "$out"' EXIT
+tar -cf - --exclude=.git . | tar -xf - -C "$tree"
+cd "$tree"
+
+for runtime in lua5.2 luajit; do
+
+    if ! pkg-config --exists $runtime; then
+        echo "$runtime is not available, skipping" >&2
+        continue
+    fi
+
+    make clean >/dev/null
+    if [ "$runtime" = "luajit" ]; then
+        make SANITIZE= luajit >/dev/null || exit 1
+    else
+        make SANITIZE= >/dev/null || exit 1
+    fi
+
+    #
+    # The editor needs a terminal, so we run it under script(1).
+    #
+    KILUA_BENCH_OUT=$out script -qec "./kilua --config bench/runtime.lua $file" /dev/null >/dev/null
+done
+
+cat $out
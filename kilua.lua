@@ -14,7 +14,9 @@
 -- callbacks are documented later in the file, but in brief they include:
 --
 --  * get_status_bar()
---     This function is called to populate the status-bar in the footer.
+--     This function is called to populate the status-bar in the footer,
+--     if no template has been set via `status_format`.  If it is defined
+--     before this file is loaded no template is set.
 --
 --  * on_complete(str)
 --     This is invoked if the user presses `TAB` when prompted for input.
@@ -32,10 +34,10 @@
 --      Called __after__ a file is saved.
 --
 --  * on_key(key)
---     Called when input is received.
+--     Called when a special key is received which isn't bound.
 --
--- Otherwise the only magic here is the `keymap` table.  Kilua will lookup
--- every keypress in this table, and if there is a matching function defined
+-- Otherwise the only magic here is the `bind` function.  Kilua will lookup
+-- every keypress in its bindings, and if there is a matching function defined
 -- it will be invoked, otherwise the literal character will be inserted.
 --
 -- Steve
@@ -51,12 +53,6 @@
 --======================================================================
 ------------------------------------------------------------------------
 
---
--- Table of bound keys
---
-local keymap = {}
-
-
 --
 --  Key bindings.
 --
@@ -66,19 +62,20 @@ local keymap = {}
 --
 --  For example this would fail:
 --
---     keymap['^D'] = delete_forwards
+--     bind("^D", delete_forwards)
 --
 --  But by the time this file is _completely_ loaded the function is
 -- indeed defined which allows this to work:
 --
---     keymap['^D'] = function() delete_forwards() end
+--     bind("^D", function() delete_forwards() end)
 --
+--  A sequence of keys is written with spaces between them, such as
+-- "^X ^S", and "M-x" is the same as pressing ESC and then "x".
 --
-keymap['ENTER']         = function() insert("\n") end
-keymap['KEY_BACKSPACE'] = delete
-keymap['KEY_DC']        = function() delete_forwards() end
-keymap['^H']            = delete
-keymap['^D']            = function() delete_forwards() end
+bind("KEY_BACKSPACE", delete)
+bind("KEY_DC",        function() delete_forwards() end)
+bind("^H",            delete)
+bind("^D",            function() delete_forwards() end)
 
 
 --
@@ -92,7 +89,7 @@ do
    --
    local search_term = ''
 
-   keymap['^S'] = function()
+   bind("^S", function()
       local term = prompt("(regexp) Search? " )
 
       -- If nothing entered default to the previous value
@@ -121,72 +118,78 @@ do
          -- save the search term
          search_term = term
       end
-   end
+   end)
 end
 
 --
 -- Goto line
 --
-keymap['M-g' ] = function() goto_line() end
+bind("M-g", function() goto_line() end)
 
 --
 -- Cut-line, and paste-line.
 --
-keymap['^K'] = function() kill_line() end
-keymap['^Y'] = function() paste() end
+bind("^K", function() kill_line() end)
+bind("^Y", function() paste() end)
 
 --
 -- Esc-q quits immediately.
 --
-keymap['M-q'] = exit
+bind("M-q", exit)
 
 --
 -- Movement
 --
-keymap['^A']         = sol  -- start of line
-keymap['^E']         = eol  -- end of line
-keymap['^B']         = function() move("left") end
-keymap['KEY_LEFT']   = function() move("left") end
-keymap['^F']         = function() move("right") end
-keymap['KEY_RIGHT']  = function() move("right") end
-keymap['^P']         = function() move("up") end
-keymap['KEY_UP']     = function() move("up") end
-keymap['KEY_DOWN']   = function() move("down") end
-keymap['^N']         = function() move("down") end
-keymap['KEY_HOME']   = sol   -- start of line
-keymap['KEY_END']    = eol   -- end of line
-keymap['M-KEY_HOME'] = sof   -- start of file
-keymap['M-KEY_END']  = eof   -- end of file
-keymap['KEY_PPAGE']  = function() page_up() end
-keymap['KEY_NPAGE']  = function() page_down() end
+bind("^A",         sol)  -- start of line
+bind("^E",         eol)  -- end of line
+bind("^B",         function() move("left") end)
+bind("KEY_LEFT",   function() move("left") end)
+bind("^F",         function() move("right") end)
+bind("KEY_RIGHT",  function() move("right") end)
+bind("^P",         function() move("up") end)
+bind("KEY_UP",     function() move("up") end)
+bind("KEY_DOWN",   function() move("down") end)
+bind("^N",         function() move("down") end)
+bind("KEY_HOME",   sol)   -- start of line
+bind("KEY_END",    eol)   -- end of line
+bind("M-KEY_HOME", sof)   -- start of file
+bind("M-KEY_END",  eof)   -- end of file
+bind("KEY_PPAGE",  function() page_up() end)
+bind("KEY_NPAGE",  function() page_down() end)
 
 
 --
 -- M-x -> eval, just like emacs.
 --
-keymap['M-x'] = function() eval_lua() end
+bind("M-x", function() eval_lua() end)
 
 --
 -- M-! ("Escape", then "!") will run a command and insert the output
--- into the current buffer.
+-- into the current buffer, once it has finished.
 --
-keymap['M-!'] = function()
+bind("M-!", function()
    local cmd = prompt( "execute:" )
    if ( cmd ) then
-      insert( cmd_output(cmd) )
+      insert_command_output( cmd )
    end
-end
-
+end)
 
 --
--- M-m will record a bookmark.
+-- M-& will run a command in the background, showing the output in
+-- the `*Output*` buffer as it arrives.
 --
-keymap['M-m'] = function() bookmark_save() end
+bind("M-&", function()
+   local cmd = prompt( "execute:" )
+   if ( cmd ) then
+      run_command( cmd, "*Output*" )
+   end
+end)
+
 
 --
--- Prefix-map for jumping to recorded bookmark.
+-- M-m will record a bookmark.
 --
-keymap['M-b'] = {}
+bind("M-m", function() bookmark_save() end)
 
 
 --
@@ -197,149 +200,89 @@ keymap['M-b'] = {}
 --  ^X  i => Insert file/command
 --  ^X ^X => Swap point and mark
 --
-keymap['^X'] = {}
-keymap['^X']['^C'] = function() quit() end
-keymap['^X']['^S'] = save
-keymap['^X']['i']  = function() insert_contents() end
+bind("^X ^C", function() quit() end)
+bind("^X ^S", save)
+bind("^X i",  function() insert_contents() end)
 
 -- ^X ^O or ^X ^F both open a file in new buffer
 -- ^X ^V open file in existing buffer
-keymap['^X']['^O'] = function() open_file(true) end
-keymap['^X']['^F'] = function() open_file(true) end
-keymap['^X']['^V'] = function() open_file(false) end
+bind("^X ^O", function() open_file(true) end)
+bind("^X ^F", function() open_file(true) end)
+bind("^X ^V", function() open_file(false) end)
 
 --
 -- Working with buffers.
 --
-keymap['M-KEY_LEFT']  = function() prev_buffer() end
-keymap['M-KEY_RIGHT'] = function() next_buffer() end
-keymap['^X']['B']     = function() choose_buffer() end
-keymap['^X']['K']     = kill_buffer
-keymap['^X']['b']     = function() choose_buffer() end
-keymap['^X']['c']     = create_buffer
-keymap['^X']['k']     = function() confirm_kill_buffer() end
-keymap['^X']['n']     = function() next_buffer() end
-keymap['^X']['p']     = function() prev_buffer() end
-
+bind("M-KEY_LEFT",  function() prev_buffer() end)
+bind("M-KEY_RIGHT", function() next_buffer() end)
+bind("^X B",        function() choose_buffer() end)
+bind("^X K",        kill_buffer)
+bind("^X b",        function() choose_buffer() end)
+bind("^X c",        create_buffer)
+bind("^X k",        function() confirm_kill_buffer() end)
+bind("^X n",        function() next_buffer() end)
+bind("^X p",        function() prev_buffer() end)
 
 --
--- Working with the selection
+-- Show how long the editor is taking to do things.
 --
-keymap['^ ']  = function() toggle_mark() end
-keymap['M-w'] = function() copy_selection() end
-keymap['^W']  = function() cut_selection() end
-
-
-
+bind("^X s",        function() show_stats() end)
 
 --
---  Callbacks and utilities they use.
------------------------------------------------------------------------------
-
-
+-- Start the profiler, or stop it and show where the time went.
+--
+bind("^X P",        function() toggle_profile() end)
 
 --
--- This function is called when input is received.
+-- Kill the process writing to this buffer, or the most recent.
 --
--- It will lookup the value of the keypress, and if it
--- represents a binding it will execute that function.
+bind("^X ^K", function()
+   if ( not kill_process() ) then
+      status( "No process to kill" )
+   end
+end)
+
+
 --
--- If no binding is found then the key is inserted into
--- the editor, literally.
+-- Keyboard macros.
 --
--- There is some magic to handle multi-character keystrokes
--- but it is pretty simple.
+--  ^X ( => Start recording
+--  ^X ) => Stop recording, dropping the two keys of this binding.
+--  ^X e => Replay the macro once
+--  ^X E => Replay the macro N times, prompting for N.
 --
-do
-   pending_char = nil
-   pending_esc  = false
+bind("^X (", macro_record)
+bind("^X )", function() macro_stop(2) end)
+bind("^X e", function() macro_replay() end)
+bind("^X E", function() replay_macro() end)
 
-   function on_key(k)
 
-      --
-      -- Was this escape?
-      --
-      -- Special case if it was ESC-ESC
-      --
-      if ( k == "ESC" ) then
-         if ( pending_esc ) then
-            k = "M-ESC"
-            pending_esc = false
-         else
-            pending_esc = true
-            return
-         end
-      end
-
-      --
-      -- Pending-escape?
-      --
-      if ( pending_esc == true ) then
-         k = "M-" .. k
-         pending_esc = false
-      end
+--
+-- Multiple cursors.
+--
+--  M-c  => Add a cursor here, and move down a line.
+--  M-C  => Remove the additional cursors.
+--  ^X m => Add a cursor at each match of a regular expression.
+--
+bind("M-c",  function() add_cursor_below() end)
+bind("M-C",  clear_cursors)
+bind("^X m", function() add_cursors_matching() end)
 
-      --
-      -- At this point the key didn't result in a function.
-      --
-      -- Nor did it terminate a special action.
-      --
-      -- So we'll now look for the expanded function.
-      --
-      if ( pending_char ) then
-         local val = keymap[pending_char][k]
-
-         if ( type(val) == 'function' ) then
-            --
-            -- We got a function to invoke!
-            --
-            val()
-            pending_char = nil
-            return
-         else
-            --
-            -- Failure
-            --
-            pending_char = nil
-            return
-         end
-      end
 
+--
+-- Working with the selection
+--
+bind({ "^ " }, function() toggle_mark() end)
+bind("M-w",    function() copy_selection() end)
+bind("^W",     function() cut_selection() end)
 
-      --
-      -- Lookup the key in our key-map.
-      --
-      local result = keymap[k]
 
-      --
-      -- Was there a result?
-      --
-      if ( result ) then
 
-         if ( type(result) == 'function' ) then
-            result()
-            pending_esc = false
-            pending_char  = nil
-            return
-         end
-         if ( type(result) == 'table' ) then
 
-            --
-            -- This is a pending multi-part key - record this part away.
-            --
-            pending_esc = false
-            pending_char = k
-            return
-         end
-      end
+--
+--  Callbacks and utilities they use.
+-----------------------------------------------------------------------------
 
-      --
-      -- Otherwise just insert the character.
-      --
-      insert(k)
-      pending_char = nil
-   end
-end
 
 
 --
@@ -357,6 +300,15 @@ function on_loaded( filename )
    local file = filename:match("^.+/(.+)$") or filename
    local ext = file:match("^.+%.(.+)$") or file
 
+   --
+   -- TABs are shown as the spaces up to the next tab stop, which are
+   -- every eight columns unless the file-type prefers otherwise.
+   --
+   local tabs = {}
+   tabs['go'] = 4
+
+   tab_width( tabs[ext] or 8 )
+
    --
    --  Association for suffix to mode.
    --
@@ -685,6 +637,110 @@ end
 
 
 
+--
+--  Keyboard macros.
+-----------------------------------------------------------------------------
+
+
+--
+-- Replay the keyboard macro a number of times.
+--
+-- A count of zero replays the macro until it fails, or stops moving the
+-- point down the buffer - which is a good way to apply it to the rest of
+-- the buffer.  Press ^G to interrupt a long replay.
+--
+function replay_macro()
+   local count = prompt( "Replay macro how many times (0 = to the end)? " )
+
+   if ( tonumber(count) == nil ) then
+      status( "You must enter a number!" )
+      return
+   end
+
+   macro_replay( tonumber(count) )
+end
+
+
+
+
+--
+--  Multiple cursors.
+-----------------------------------------------------------------------------
+
+
+--
+-- Add a cursor at the point, then move the point down a line.
+--
+-- NOTE: We use `point()` to move rather than `move()`, because the latter
+-- moves the additional cursors too.
+--
+function add_cursor_below()
+   local x,y = point()
+
+   point( x, y + 1 )
+
+   local nx, ny = point()
+   if ( ny == y ) then
+      status( "No more lines!" )
+      return
+   end
+
+   add_cursor( x, y )
+end
+
+
+--
+-- Add a cursor at each match of the given regular expression.
+--
+-- The point is left at the first match, and additional cursors are
+-- placed at the others, so that typing edits all of them at once.
+--
+function add_cursors_matching( term )
+   if ( term == nil ) then
+      term = prompt( "(regexp) Add cursors at? " )
+   end
+
+   if ( term == nil or term == "" ) then
+      status( "Cancelled" )
+      return
+   end
+
+   clear_cursors()
+   sof()
+
+   --
+   -- Find each match, stopping when we wrap around, or get stuck.
+   --
+   local found = {}
+
+   while ( search( term ) ) do
+      local x,y = point()
+
+      if ( #found > 0 ) then
+         if ( found[1][1] == x and found[1][2] == y ) then break end
+         if ( found[#found][1] == x and found[#found][2] == y ) then break end
+      end
+
+      table.insert( found, { x, y } )
+      move( "right" )
+   end
+
+   if ( #found == 0 ) then
+      return
+   end
+
+   point( found[1][1], found[1][2] )
+
+   for i = 2, #found do
+      add_cursor( found[i][1], found[i][2] )
+   end
+
+   status( "Added cursors at " .. #found .. " matches" )
+end
+
+
+
+
 --
 --  Quit handling.
 -----------------------------------------------------------------------------
@@ -732,33 +788,18 @@ function quit()
    --
    local dirty_count = 0
 
-   --
-   -- The current-buffer
-   --
-   local old_buffer = buffer()
-
    --
    -- For each buffer
    --
    for index,name in ipairs(buffers()) do
-      --
-      -- Select the buffer
-      --
-      buffer( index - 1 )
-
       --
       -- Is it dirty?
       --
-      if ( dirty() ) then
+      if ( get_buffer( index - 1 ):dirty() ) then
          dirty_count = dirty_count + 1
       end
    end
 
-   --
-   -- Restore the old-current buffer
-   --
-   buffer( old_buffer )
-
    --
    -- If there are dirty buffers ..
    --
@@ -959,7 +1000,7 @@ function bookmark_load(key)
    --
    -- Remove the binding
    --
-   keymap['M-b'][key] = nil
+   unbind({ "M-b", key })
 
    --
    -- Restore the old-current buffer
@@ -987,7 +1028,7 @@ function bookmark_save()
    buffer_data( "bookmark_" .. k .. "_y", y )
 
    -- Allow it to be recalled
-   keymap['M-b'][k] = function() bookmark_load(k) end
+   bind({ "M-b", k }, function() bookmark_load(k) end)
    status( "M-b-" .. k .. " will now take you to " .. x .. "," .. y .. " in this buffer")
 end
 
@@ -1004,8 +1045,8 @@ end
 
 
 --
--- `on_idle` is called every second, or so, and can run things in the
--- background.
+-- `on_idle` is called once input has stopped for a moment, and can run
+-- things in the background.
 --
 function on_idle()
 
@@ -1019,140 +1060,89 @@ function on_idle()
    end
 
    --
-   -- Get the text
-   --
-   local text = text()
-
-   --
-   -- Transform that into a series of colours
-   --
-   local colours = on_syntax_highlight( text );
-
-   --
-   -- If it worked then set the colours.
+   -- Get the text, and transform that into a series of colours - timing
+   -- the parse along with the update, as the `highlight` phase.
    --
-   if ( colours ~= nil and colours ~= "" ) then
-      update_colours( colours )
-   end
-end
-
-
+   highlight( function()
+      local colours = on_syntax_highlight( text() )
 
---
--- String interopolation function, taken from the Lua wiki:
---
---   http://lua-users.org/wiki/StringInterpolation
---
--- Usage:
---
---   print( string.interp( "Hello ${name}", { name = "World" } )
---
-function string.interp(s, tab)
-   return (s:gsub('($%b{})', function(w) return tab[w:sub(3, -2)] or w end))
+      --
+      -- If it worked then set the colours.
+      --
+      if ( colours ~= nil and colours ~= "" ) then
+         update_colours( colours )
+      end
+   end )
 end
 
 
 
-
 --
--- If this function is defined it will be invoked to draw the status-bar.
+-- When we're running under LuaJIT we use its FFI to read rows, and to set
+-- colours, directly - rather than passing values via the Lua stack.
 --
--- We use a format-string to determine what to draw, and ensure that we
--- pad/truncate to fit the width of the console
+-- This requires the editor to export its symbols, as `make luajit` does.
 --
-function get_status_bar()
-
-   --
-   -- Format String of what we show.
-   --
-   local fmt = "${buffer}/${buffers} - ${file} ${mode} ${modified} #BLANK# Col:${x} Row:${y} [${point}] ${time}"
-
-   --
-   -- Things we use.
-   --
-   local x,y = point()
-
-   --
-   -- Table holding values we can interpolate.
-   --
-   local t = {}
-   t['buffer']  = buffer() + 1
-   t['buffers'] = #buffers()
-
-   --
-   -- See https://www.lua.org/pil/22.1.html
-   --
-   t['date'] = os.date("%A %d %B %Y")
-   t['time'] = os.date("%X")
+if ( jit ) then
+   local ok, ffi = pcall( require, "ffi" )
 
-   t['file']  = buffer_name()
+   if ( ok ) then
+      ffi.cdef[[
+         int kilua_buffer(void);
+         int kilua_rows(int id);
+         const char *kilua_row(int id, int n, size_t *len);
+         int kilua_update_colours(int id, const char *colours, size_t len);
+      ]]
 
-   t['mode']  = ""
+      local C   = ffi.C
+      local len = ffi.new( "size_t[1]" )
 
-   local s = syntax()
-   if ( #s > 0 ) then
-      t['mode'] = s .. "-mode"
-   end
-   t['x']     = x
-   t['y']     = y + 1
-   t['point'] = at()
+      if ( pcall( function() return C.kilua_row end ) ) then
+         function line( n )
+            local text = C.kilua_row( C.kilua_buffer(), n, len )
+            if ( text == nil ) then
+               return nil
+            end
+            return ffi.string( text, len[0] )
+         end
 
-   if ( dirty() )  then
-      t['modified'] = "<modified>"
-   else
-      t['modified'] = ""
+         function update_colours( colours )
+            C.kilua_update_colours( C.kilua_buffer(), colours, #colours )
+         end
+      end
    end
+end
 
-   --
-   -- Width of console
-   --
-   local w = width()
-
-   --
-   -- Interpolate our output
-   --
-   local out = string.interp( fmt, t )
-
-   --
-   -- If the format string includes `${point}` - which expands to the
-   -- character under the cursor - then we need to make sure that is
-   -- only a single character.
-   --
-   -- If the character under the point is `€`, or other multi-byte
-   -- character, it will have a length of bigger than one byte
-   -- even though it is, by definition, a single character.
-   --
-   local at_pos = string.find( fmt, "${point}" )
-   local fix = 0
-   if ( at_pos ) then
-      fix = #at() -1
-   end
 
-   --
-   -- Too large?
-   --
-   if ( #out > w ) then
-      -- Remove the marker.
-      out = out:gsub( "#BLANK#", "" )
-      return( out:sub(0,w) )
-   end
+--
+-- The garbage-collector runs a little after each allocation, and again
+-- whenever you stop typing, so it has less to do while you're typing.
+--
+-- The pause is how much memory may grow, as a percentage, before a new
+-- collection starts, and the step multiplier how much work is done per
+-- allocation.  Raising the pause means fewer collections while typing,
+-- at the cost of more memory.
+--
+gc( 200, 200 )
 
-   --
-   -- Too small?
-   --
-   local pad = w - #out + fix + ( 7 )   -- 7 == length of '#BLANK#'
-   local spc = ""
-   while( pad > 0 ) do
-      spc = spc .. " "
-      pad = pad - 1
-   end
 
-   --
-   -- Replace the #BLANK# string with our new spc-string containing the
-   -- correct amount of padding.
-   --
-   out = out:gsub( "#BLANK#", spc )
-   return( out )
+--
+-- The status-bar is drawn from this template, which is expanded by the
+-- editor itself - and only when one of the values it shows changes.
+--
+-- "#BLANK#" is replaced with the padding required to fill the screen,
+-- and "${name()}" with the result of the Lua function `name` - which is
+-- cached until you call `status_invalidate("name")`.
+--
+-- If you'd rather generate the status-bar yourself define a
+-- `get_status_bar()` function, and no template will be set here.
+--
+-- "${time}" is available too, but it is only updated when the screen is
+-- redrawn - keeping it current would need a timer, which would wake the
+-- editor even when it is idle.
+--
+if ( get_status_bar == nil ) then
+   status_format( "${buffer}/${buffers} - ${file} ${mode} ${modified} #BLANK# Col:${x} Row:${y} [${point}]" )
 end
 
 
@@ -1462,31 +1452,84 @@ status("Kilua v" .. KILUA_VERSION)
 
 
 --
--- Call `make` - showing the output in our `*MAKE*` buffer.
+-- Run a command in the background, showing the output in the named
+-- buffer as it arrives.
 --
-function make()
-   --
-   -- Select the buffer.
-   --
-   local result = buffer( "*Make*" )
-
-   --
-   -- If selecting by name failed then the buffer can't exist.
+function run_command( cmd, name )
    --
-   -- Create it.
+   -- Select the buffer, creating it if it doesn't exist.
    --
-   if ( result == -1 ) then
-      create_buffer( "*Make*" )
+   if ( buffer( name ) == -1 ) then
+      create_buffer( name )
    end
 
    -- Ensure we append output
    eof()
 
-   -- Run the command.
-   insert(cmd_output( "make" ) )
+   local pid, err = spawn( cmd, name, function( code )
+      status( "'" .. cmd .. "' exited with status " .. code )
+   end )
+
+   if ( not pid ) then
+      status( "Failed to run '" .. cmd .. "': " .. err )
+   end
+end
+
+
+--
+-- Run a command in the background, and insert its output at the point
+-- once it has finished - without blocking the editor meanwhile.
+--
+-- The output is collected in a scratch buffer, which is killed once it
+-- has been inserted.
+--
+insert_commands = 0
+
+function insert_command_output( cmd )
+   local target = get_buffer()
+   local x, y   = point()
+
+   insert_commands = insert_commands + 1
+   local scratch = "*Command-" .. insert_commands .. "*"
+
+   local pid, err = spawn( cmd, scratch, function( code )
+      local output = get_buffer( scratch )
+      local text   = table.concat( output:lines(), "\n" )
+      local name   = buffer_name()
+
+      --
+      -- Insert the output where the point was, if the buffer still
+      -- exists, keeping the point where it is now if that was before.
+      --
+      if ( pcall( target.select, target ) ) then
+         local px, py = point()
+
+         point( x, y )
+         insert( text )
+
+         if ( py < y or ( py == y and px < x ) ) then
+            point( px, py )
+         end
+      end
+
+      output:select()
+      kill_buffer()
+      buffer( name )
+
+      status( "'" .. cmd .. "' exited with status " .. code )
+   end )
+
+   if ( not pid ) then
+      status( "Failed to run '" .. cmd .. "': " .. err )
+   end
+end
+
 
-   -- completed
-   insert("completed\n")
+--
+-- Call `make` - showing the output in our `*Make*` buffer.
+--
+function make()
+   run_command( "make", "*Make*" )
 end
 
 
@@ -1524,6 +1567,70 @@ function bd()
 end
 
 
+--
+-- Show how long each phase of the main-loop is taking, and how much
+-- memory Lua and each buffer are using, in the `*Stats*` buffer.
+--
+function show_stats()
+   local s = stats()
+
+   --
+   -- Replace any previous report.
+   --
+   if ( buffer( "*Stats*" ) ~= -1 ) then
+      kill_buffer()
+   end
+   create_buffer( "*Stats*" )
+
+   insert( string.format( "%-10s %8s %10s %10s %10s\n", "Phase", "Count", "Mean", "p99", "Max" ) )
+
+   for _, p in ipairs( s.phases ) do
+      insert( string.format( "%-10s %8d %8.3fms %8.3fms %8.3fms\n",
+                             p.name, p.count, p.mean, p.p99, p.max ) )
+   end
+
+   insert( "\n" )
+   insert( string.format( "%-30s %10s\n", "Memory", "KB" ) )
+   insert( string.format( "%-30s %10.1f\n", "Lua", s.lua / 1024 ) )
+
+   if ( s.pool_reserved ) then
+      insert( string.format( "%-30s %10.1f\n", "Lua small objects", s.pool_used / 1024 ) )
+      insert( string.format( "%-30s %10.1f\n", "Lua small object slabs", s.pool_reserved / 1024 ) )
+   end
+
+   for _, b in ipairs( s.buffers ) do
+      insert( string.format( "%-30s %10.1f\n", b.name, b.memory / 1024 ) )
+   end
+
+   sof()
+end
+
+
+--
+-- Start the sampling profiler, or stop it and show its samples in the
+-- `*Profile*` buffer.
+--
+-- The samples are folded stacks, so saving the buffer gives a file which
+-- `flamegraph.pl` can render.
+--
+function toggle_profile()
+   if ( profile_start() ) then
+      status( "Profiling started" )
+      return
+   end
+
+   local folded = profile_stop()
+
+   if ( buffer( "*Profile*" ) ~= -1 ) then
+      kill_buffer()
+   end
+   create_buffer( "*Profile*" )
+
+   insert( folded )
+   sof()
+end
+
+
 --
 -- Dump files beneath /etc
 --
@@ -0,0 +1,263 @@
+/* batch.cc - Running a script against many files, without a terminal.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <getopt.h>
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <thread>
+
+#include "batch.h"
+#include "editor.h"
+#include "lua_primitives.h"
+#include "profiler.h"
+
+
+/**
+ * The work shared between our threads.
+ */
+struct batch_job
+{
+    /*
+     * The script to run against each file.
+     */
+    const char *script;
+
+    /*
+     * Configuration files to load before the script.
+     */
+    std::vector<std::string> configs;
+
+    /*
+     * The files to process, and the offset of the next one which needs
+     * to be claimed by a thread.
+     */
+    std::vector<std::string> files;
+    std::atomic<size_t> next;
+
+    /*
+     * The number of files we failed to process.
+     */
+    std::atomic<int> failed;
+
+    /*
+     * Set if a configuration file failed to load, to stop every thread.
+     */
+    std::atomic<bool> broken;
+};
+
+
+/**
+ * Process files, until there are none left.
+ */
+static void batch_worker(batch_job *job)
+{
+    /*
+     * This thread has its own editor, and Lua state.
+     */
+    Editor *e    = Editor::instance();
+    lua_State *L = e->lua();
+
+    e->set_headless(true);
+
+    /*
+     * An error in a configuration file stops us all, but it mustn't
+     * terminate the process while other threads are writing files.
+     */
+    for (std::vector<std::string>::iterator it = job->configs.begin(); it != job->configs.end(); ++it)
+    {
+        if (e->load_lua(it->c_str(), false, false) < 0)
+        {
+            job->broken = true;
+            break;
+        }
+    }
+
+    /*
+     * The script is compiled once, and run for each file.
+     */
+    luaL_loadfile(L, job->script);
+    int script = luaL_ref(L, LUA_REGISTRYINDEX);
+
+    size_t i;
+
+    while (!job->broken && (i = job->next++) < job->files.size())
+    {
+        const char *file = job->files[i].c_str();
+        struct stat sb;
+
+        if (stat(file, &sb) != 0 || !S_ISREG(sb.st_mode))
+        {
+            fprintf(stderr, "%s: not a regular file\n", file);
+            job->failed++;
+            continue;
+        }
+
+        e->load_files(std::vector<std::string>(1, job->files[i]));
+
+        /*
+         * The script receives the name of the file, as `...`.
+         */
+        {
+            lua_running running;
+
+            lua_rawgeti(L, LUA_REGISTRYINDEX, script);
+            lua_pushstring(L, file);
+
+            if (lua_pcall(L, 1, 0, 0) != 0)
+            {
+                fprintf(stderr, "%s: %s\n", file, lua_tostring(L, -1));
+                lua_pop(L, 1);
+                job->failed++;
+            }
+        }
+
+        /*
+         * Kill every buffer but *Messages*, including any which the
+         * script created, so we don't grow as we work.
+         */
+        while (e->count_buffers() > 1)
+        {
+            e->set_current_buffer(e->count_buffers() - 1);
+            e->kill_current_buffer();
+        }
+    }
+
+    luaL_unref(L, LUA_REGISTRYINDEX, script);
+    Editor::destroy_instance();
+}
+
+
+/**
+ * Run `kilua --batch script.lua [options] file1 .. fileN`.
+ */
+int batch_main(int argc, char *argv[])
+{
+    batch_job job;
+    job.script = NULL;
+    job.next   = 0;
+    job.failed = 0;
+    job.broken = false;
+
+    int jobs = std::thread::hardware_concurrency();
+
+    while (1)
+    {
+        static struct option long_options[] =
+        {
+            {"batch", required_argument, 0, 'b'},
+            {"config", required_argument, 0, 'c'},
+            {"jobs", required_argument, 0, 'j'},
+            {0, 0, 0, 0}
+        };
+
+        int option_index = 0;
+
+        int c = getopt_long(argc, argv, "b:c:j:", long_options, &option_index);
+
+        if (c == -1)
+            break;
+
+        switch (c)
+        {
+        case 'b':
+            job.script = optarg;
+            break;
+
+        case 'c':
+            job.configs.push_back(optarg);
+            break;
+
+        case 'j':
+            jobs = atoi(optarg);
+            break;
+
+        default:
+            return 1;
+        }
+    }
+
+    for (int i = optind; i < argc; i++)
+        job.files.push_back(argv[i]);
+
+    if (job.script == NULL || job.files.empty())
+    {
+        fprintf(stderr, "Usage: kilua --batch script.lua [--jobs N] [--config file.lua] file1 [file2 .. fileN]\n");
+        return 1;
+    }
+
+    /*
+     * Report a broken script, or configuration file, once rather than
+     * once per thread.
+     */
+    std::vector<std::string> sources = job.configs;
+    sources.push_back(job.script);
+
+    lua_State *L = luaL_newstate();
+
+    for (std::vector<std::string>::iterator it = sources.begin(); it != sources.end(); ++it)
+    {
+        if (luaL_loadfile(L, it->c_str()) != 0)
+        {
+            fprintf(stderr, "%s\n", lua_tostring(L, -1));
+            lua_close(L);
+            return 1;
+        }
+
+        lua_pop(L, 1);
+    }
+
+    lua_close(L);
+
+    /*
+     * Files are read and written in the user's locale, as they are
+     * interactively.
+     */
+    setlocale(LC_ALL, "");
+
+    if (jobs < 1)
+        jobs = 1;
+
+    if ((size_t)jobs > job.files.size())
+        jobs = job.files.size();
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < jobs; i++)
+        threads.push_back(std::thread(batch_worker, &job));
+
+    for (std::vector<std::thread>::iterator it = threads.begin(); it != threads.end(); ++it)
+        it->join();
+
+    return ((job.failed > 0 || job.broken) ? 1 : 0);
+}
@@ -31,8 +31,12 @@
  */
 
 
+#include <algorithm>
+#include <atomic>
 #include <string.h>
+#include <wchar.h>
 #include "buffer.h"
+#include "util.h"
 
 /**
  * Constructor.
@@ -41,6 +45,7 @@ erow::erow()
 {
     chars = new std::vector<std::wstring>;
     cols  = new std::vector<int>;
+    m_tabs = 0;
 }
 
 
@@ -53,6 +58,116 @@ erow::~erow()
     delete (cols);
 }
 
+/**
+ * The display column at which the given character starts.
+ */
+int erow::column(int x, int tabs)
+{
+    layout(tabs);
+
+    return (m_columns.at(x));
+}
+
+
+/**
+ * The number of columns the given character occupies.
+ */
+int erow::width(int x, int tabs)
+{
+    layout(tabs);
+
+    return (m_columns.at(x + 1) - m_columns.at(x));
+}
+
+
+/**
+ * The character which occupies the given display column.
+ *
+ * The last character which starts at, or before, the column - or the
+ * length of the row if the column is beyond its end.
+ */
+int erow::index(int column, int tabs)
+{
+    layout(tabs);
+
+    if (column >= m_columns.back())
+        return (chars->size());
+
+    std::vector<int>::iterator it = std::upper_bound(m_columns.begin(), m_columns.end(), column);
+    int x = (it - m_columns.begin()) - 1;
+
+    /*
+     * The first of several characters starting at this column.
+     */
+    while (x > 0 && m_columns.at(x - 1) == m_columns.at(x))
+        x--;
+
+    return (x);
+}
+
+
+/**
+ * Discard the layout of the row.
+ */
+void erow::changed()
+{
+    m_columns.clear();
+}
+
+
+/**
+ * The memory used by the layout.
+ */
+size_t erow::layout_memory()
+{
+    return (m_columns.capacity() * sizeof(int));
+}
+
+
+/**
+ * Calculate the display column of each character.
+ *
+ * Control characters are shown as "^X", bytes which weren't valid UTF-8
+ * as a single replacement character, and TABs as the spaces up to the
+ * next tab stop.
+ */
+void erow::layout(int tabs)
+{
+    if (!m_columns.empty() && m_tabs == tabs)
+        return;
+
+    int n = chars->size();
+    int column = 0;
+
+    m_columns.resize(n + 1);
+    m_tabs = tabs;
+
+    for (int x = 0; x < n; x++)
+    {
+        m_columns[x] = column;
+
+        const std::wstring &cell = chars->at(x);
+        wchar_t c = cell.empty() ? ' ' : cell.at(0);
+        int w;
+
+        if (c == '\t')
+            w = tabs - (column % tabs);
+        else if (c < 0x20 || c == 0x7F)
+            w = 2;
+        else if (c >= 0xDC80 && c <= 0xDCFF)
+            w = 1;
+        else if (x > 0 && !chars->at(x - 1).empty() && chars->at(x - 1).back() == 0x200D)
+            w = 0;
+        else if ((w = wcwidth(c)) < 0 || (w == 0 && x == 0))
+            w = 1;
+
+        column += w;
+    }
+
+    m_columns[n] = column;
+}
+
+
 /**
  * The text of the row, from the given character offset.
  */
@@ -71,21 +186,68 @@ std::wstring erow::text(int offset)
     return (ret);
 }
 
+
+/**
+ * The number of bytes required to hold the row as UTF-8.
+ */
+size_t erow::utf8_size()
+{
+    size_t size = 0;
+
+    for (std::vector<std::wstring>::iterator it = chars->begin(); it != chars->end(); ++it)
+    {
+        for (std::wstring::iterator c = it->begin(); c != it->end(); ++c)
+            size += Util::utf8_length(*c);
+    }
+
+    return (size);
+}
+
+
+/**
+ * Append the text of the row, as UTF-8, to the given string.
+ */
+void erow::utf8(std::string &out)
+{
+    char buf[4];
+
+    for (std::vector<std::wstring>::iterator it = chars->begin(); it != chars->end(); ++it)
+    {
+        for (std::wstring::iterator c = it->begin(); c != it->end(); ++c)
+        {
+            if (*c < 0x80)
+                out += (char)(*c);
+            else
+                out.append(buf, Util::utf8_encode(*c, buf));
+        }
+    }
+}
+
+
 /**
  * Constructor.
  */
 Buffer::Buffer(const char *bname)
 {
+    /*
+     * Buffers may be created by several threads, in `--batch` mode.
+     */
+    static std::atomic<int> next_id(1);
+
+    m_id     = next_id++;
     cx       = 0;
     cy       = 0;
     markx    = -1;
     marky    = -1;
     rowoff   = 0;
     coloff   = 0;
+    scroll   = 0;
     m_name   = strdup(bname);
     m_dirty  = false;
     m_syntax = "";
 
+    m_tab_width = 8;
+
     /*
      * The buffer will have one (empty) row.
      */
@@ -127,12 +289,14 @@ void Buffer::empty_buffer()
     }
 
     rows.clear();
+    cursors.clear();
     cx         = 0;
     cy         = 0;
     markx      = -1;
     marky      = -1;
     rowoff     = 0;
     coloff     = 0;
+    scroll     = 0;
 
     /*
      * The buffer will have one (empty) row.
@@ -193,6 +357,15 @@ void Buffer::set_dirty(bool state)
     m_dirty = state;
 }
 
+/**
+ * Get the unique ID of the buffer.
+ */
+int Buffer::id()
+{
+    return (m_id);
+}
+
+
 /**
  * Get the name of the buffer.
  */
@@ -215,44 +388,60 @@ void Buffer::set_name(const char *name)
 
 
 /**
- * Get the buffer contents, as text.
+ * Get the buffer contents, as UTF-8 text.
  *
- * NOTE: NOT wide-text.
+ * We size the result before we copy anything into it, so that it is
+ * only allocated once.
  */
 std::string Buffer::text()
 {
+    size_t size = 0;
+
+    for (std::vector<erow *>::iterator it = rows.begin(); it != rows.end(); ++it)
+        size += (*it)->utf8_size() + 1;
+
     std::string text;
+    text.reserve(size);
 
-    int row_count = rows.size();
+    for (std::vector<erow *>::iterator it = rows.begin(); it != rows.end(); ++it)
+    {
+        (*it)->utf8(text);
+        text += '\n';
+    }
 
-    for (int y = 0; y < row_count; y++)
+    return (text);
+}
+
+
+/**
+ * Estimate the memory used by the buffer, in bytes.
+ *
+ * Each character is a string of its own, which only allocates if it
+ * holds more than a few characters.
+ */
+size_t Buffer::memory()
+{
+    static const size_t inline_chars = std::wstring().capacity();
+
+    size_t size = sizeof(Buffer) + rows.capacity() * sizeof(erow *);
+
+    for (std::vector<erow *>::iterator it = rows.begin(); it != rows.end(); ++it)
     {
-        int chars = rows.at(y)->chars->size();
+        erow *row = (*it);
 
-        for (int x = 0; x < chars; x++)
+        size += sizeof(erow);
+        size += sizeof(*row->chars) + row->chars->capacity() * sizeof(std::wstring);
+        size += sizeof(*row->cols) + row->cols->capacity() * sizeof(int);
+        size += row->layout_memory();
+
+        for (std::vector<std::wstring>::iterator c = row->chars->begin(); c != row->chars->end(); ++c)
         {
-            /*
-             * We append the character at the row,col position.
-             *
-             * NOTE This might be an N-byte character string, we
-             * deliberately only use the first because LPEG doesn't
-             * even handle UTF-8, so it doesn't matter.
-             *
-             * We could have said this instead:
-             *
-             *   if (cur->rows.at(y)->chars->at(x)->size() > 1 )
-             *      text += "?";
-             *   else
-             *      text += cur->rows.at(y)->chars->at(x);
-             *
-             */
-            text += rows.at(y)->chars->at(x)[0];
+            if (c->capacity() > inline_chars)
+                size += (c->capacity() + 1) * sizeof(wchar_t);
         }
-
-        text += '\n';
     }
 
-    return (text);
+    return (size);
 }
 
 
@@ -285,6 +474,10 @@ void Buffer::update_syntax(const char *colours, size_t len)
         /*
          * For each character in the row, set the colour
          * to be the return value.
+         *
+         * The colours match the UTF-8 text of the buffer, so we
+         * use the colour of the first byte of each character and
+         * skip the rest.
          */
         for (int x = 0; x < (int)crow->chars->size(); x++)
         {
@@ -293,7 +486,10 @@ void Buffer::update_syntax(const char *colours, size_t len)
             else
                 crow->cols->push_back(7) ; /* white */
 
-            done += 1;
+            const std::wstring &cell = crow->chars->at(x);
+
+            for (std::wstring::const_iterator c = cell.begin(); c != cell.end(); ++c)
+                done += Util::utf8_length(*c);
         }
 
         /*
@@ -305,6 +501,223 @@ void Buffer::update_syntax(const char *colours, size_t len)
 }
 
 
+/**
+ * Insert a character at the given position.
+ */
+void Buffer::insert_char(int x, int y, wchar_t c)
+{
+    erow *row = rows.at(y);
+    row->chars->insert(row->chars->begin() + x, std::wstring(1, c));
+    row->changed();
+}
+
+
+/**
+ * Insert the text at the given position, returning the position after it.
+ *
+ * Rather than inserting one character at a time, which would involve
+ * shuffling the rest of the row, and the rows beneath, for each
+ * character, we split the text into lines and insert them all at once.
+ */
+cursor Buffer::insert_text(int x, int y, const std::wstring &text)
+{
+    erow *cur_row = rows.at(y);
+
+    /*
+     * Split the text into the cells of each line.
+     */
+    std::vector<std::vector<std::wstring> > lines(1);
+
+    for (std::wstring::const_iterator it = text.begin(); it != text.end(); ++it)
+    {
+        if (*it == '\n')
+            lines.push_back(std::vector<std::wstring>());
+        else
+            lines.back().push_back(std::wstring(1, *it));
+    }
+
+    /*
+     * The characters after the position move to the end of the last line.
+     */
+    std::vector<std::wstring> tail(cur_row->chars->begin() + x, cur_row->chars->end());
+    cur_row->chars->erase(cur_row->chars->begin() + x, cur_row->chars->end());
+
+    /*
+     * The first line is appended to the current row, the rest become
+     * new rows.
+     */
+    cur_row->chars->insert(cur_row->chars->end(), lines[0].begin(), lines[0].end());
+    cur_row->changed();
+
+    std::vector<erow *> added;
+
+    for (size_t i = 1; i < lines.size(); i++)
+    {
+        erow *new_row = new erow();
+        new_row->chars->assign(lines[i].begin(), lines[i].end());
+        added.push_back(new_row);
+    }
+
+    rows.insert(rows.begin() + y + 1, added.begin(), added.end());
+
+    erow *last = rows.at(y + lines.size() - 1);
+    int end    = last->chars->size();
+    last->chars->insert(last->chars->end(), tail.begin(), tail.end());
+    last->changed();
+
+    return (cursor(end, y + lines.size() - 1));
+}
+
+
+/**
+ * Delete the character at the given position.
+ */
+void Buffer::delete_char(int x, int y)
+{
+    erow *row = rows.at(y);
+    row->chars->erase(row->chars->begin() + x);
+    row->changed();
+}
+
+
+/**
+ * Split the row at the given position.
+ */
+void Buffer::split_row(int x, int y)
+{
+    erow *row     = rows.at(y);
+    erow *new_row = new erow();
+
+    new_row->chars->assign(row->chars->begin() + x, row->chars->end());
+    row->chars->erase(row->chars->begin() + x, row->chars->end());
+    row->changed();
+    rows.insert(rows.begin() + y + 1, new_row);
+}
+
+
+/**
+ * Join the given row onto the end of the previous one.
+ */
+int Buffer::join_row(int y)
+{
+    erow *p_row = rows.at(y - 1);
+    erow *c_row = rows.at(y);
+    int p_len   = p_row->chars->size();
+
+    p_row->chars->insert(p_row->chars->end(), c_row->chars->begin(), c_row->chars->end());
+    p_row->changed();
+    rows.erase(rows.begin() + y);
+    delete c_row;
+
+    return (p_len);
+}
+
+
+/**
+ * Add an additional cursor at the given position.
+ */
+bool Buffer::add_cursor(int x, int y)
+{
+    cursor c(x, y);
+
+    std::vector<cursor>::iterator it = std::lower_bound(cursors.begin(), cursors.end(), c);
+
+    if (it != cursors.end() && (*it) == c)
+        return false;
+
+    cursors.insert(it, c);
+    return true;
+}
+
+
+/**
+ * Move the additional cursors in the given direction.
+ *
+ * Unlike the point these are not constrained by the screen, so we
+ * only need to keep them within the text.
+ */
+void Buffer::move_cursors(const char *direction)
+{
+    int max_row = rows.size();
+
+    for (std::vector<cursor>::iterator it = cursors.begin(); it != cursors.end(); ++it)
+    {
+        cursor &c = (*it);
+
+        if (strcmp(direction, "up") == 0)
+        {
+            if (c.y > 0)
+                c.y -= 1;
+        }
+        else if (strcmp(direction, "down") == 0)
+        {
+            if (c.y < max_row - 1)
+                c.y += 1;
+        }
+        else if (strcmp(direction, "left") == 0)
+        {
+            if (c.x > 0)
+            {
+                c.x -= 1;
+            }
+            else if (c.y > 0)
+            {
+                c.y -= 1;
+                c.x = rows.at(c.y)->chars->size();
+            }
+        }
+        else if (strcmp(direction, "right") == 0)
+        {
+            if (c.x < (int)rows.at(c.y)->chars->size())
+            {
+                c.x += 1;
+            }
+            else if (c.y < max_row - 1)
+            {
+                c.y += 1;
+                c.x = 0;
+            }
+        }
+        else if (strcmp(direction, "sol") == 0)
+        {
+            c.x = 0;
+        }
+        else if (strcmp(direction, "eol") == 0)
+        {
+            c.x = rows.at(c.y)->chars->size();
+        }
+
+        /*
+         * Keep the cursor within the row.
+         */
+        int len = rows.at(c.y)->chars->size();
+
+        if (c.x > len)
+            c.x = len;
+    }
+
+    /*
+     * Cursors might have collided.
+     */
+    std::sort(cursors.begin(), cursors.end());
+    cursors.erase(std::unique(cursors.begin(), cursors.end()), cursors.end());
+
+    /*
+     * Or moved onto the point.
+     */
+    cursors.erase(std::remove(cursors.begin(), cursors.end(), cursor(cx + coloff, cy + rowoff)), cursors.end());
+}
+
+
+/**
+ * Is there an additional cursor at the given position?
+ */
+bool Buffer::has_cursor(int x, int y)
+{
+    return (std::binary_search(cursors.begin(), cursors.end(), cursor(x, y)));
+}
+
+
 /**
  * Get per-buffer data.
  */
@@ -321,3 +734,23 @@ void Buffer::set_data(std::string key, std::string value)
 {
     m_data[key] = value;
 }
+
+
+/**
+ * Get the distance between tab stops.
+ */
+int Buffer::tab_width()
+{
+    return (m_tab_width);
+}
+
+
+/**
+ * Set the distance between tab stops.
+ *
+ * The layout of each row is recalculated as it is next drawn.
+ */
+void Buffer::set_tab_width(int width)
+{
+    m_tab_width = width;
+}
@@ -60,6 +60,16 @@ public:
      */
     std::wstring text(int offset);
 
+    /**
+     * The number of bytes required to hold the row as UTF-8.
+     */
+    size_t utf8_size();
+
+    /**
+     * Append the text of the row, as UTF-8, to the given string.
+     */
+    void utf8(std::string &out);
+
     /*
      * The character at each position in this row.
      */
@@ -69,6 +79,76 @@ public:
      * The colour to draw at each position.
      */
     std::vector<int> *cols;
+
+    /**
+     * The display column at which the given character starts, which may
+     * be the length of the row, with tab stops every `tabs` columns.
+     */
+    int column(int x, int tabs);
+
+    /**
+     * The number of columns the given character occupies.
+     *
+     * This is zero for a combining character, or one joined to its
+     * predecessor, which is drawn as part of the character before it.
+     */
+    int width(int x, int tabs);
+
+    /**
+     * The character which occupies the given display column.
+     */
+    int index(int column, int tabs);
+
+    /**
+     * Discard the layout of the row, as its characters have changed.
+     */
+    void changed();
+
+    /**
+     * The memory used by the layout, in bytes.
+     */
+    size_t layout_memory();
+
+private:
+    /**
+     * Calculate the display column of each character, if the row has
+     * changed or the tab stops differ from those last used.
+     */
+    void layout(int tabs);
+
+    /**
+     * The display column at which each character starts, followed by the
+     * width of the row - empty if it must be recalculated - and the
+     * distance between the tab stops it was calculated with.
+     */
+    std::vector<int> m_columns;
+    int m_tabs;
+};
+
+
+
+/**
+ * A position within a buffer, as a character offset within a row.
+ *
+ * Cursors are ordered by row, then column.
+ */
+class cursor
+{
+public:
+    cursor(int px, int py) : x(px), y(py) {};
+
+    bool operator<(const cursor &other) const
+    {
+        return ((y < other.y) || ((y == other.y) && (x < other.x)));
+    };
+
+    bool operator==(const cursor &other) const
+    {
+        return ((x == other.x) && (y == other.y));
+    };
+
+public:
+    int x, y;
 };
 
 
@@ -120,6 +200,11 @@ public:
      */
     void set_dirty(bool state);
 
+    /**
+     * Get the unique ID of the buffer.
+     */
+    int id();
+
     /**
      * Get the name of the buffer.
      */
@@ -131,18 +216,71 @@ public:
     void set_name(const char *name);
 
     /**
-     * Get the buffer contents, as text.
-     *
-     * NOTE: NOT wide-text.
+     * Get the buffer contents, as UTF-8 text.
      */
     std::string text();
 
+    /**
+     * Estimate the memory used by the buffer, in bytes.
+     */
+    size_t memory();
+
     /**
      * Update the colours of the current buffer, via the
      * result of the lua callback.
+     *
+     * There is one colour for each byte of the UTF-8 text.
      */
     void update_syntax(const char *colours, size_t len);
 
+    /**
+     * Insert a character at the given position.
+     *
+     * These editing operations work upon absolute positions, and don't
+     * move the point, or the additional cursors.
+     */
+    void insert_char(int x, int y, wchar_t c);
+
+    /**
+     * Insert the text at the given position, returning the position
+     * after it.  The text may contain newlines.
+     */
+    cursor insert_text(int x, int y, const std::wstring &text);
+
+    /**
+     * Delete the character at the given position.
+     */
+    void delete_char(int x, int y);
+
+    /**
+     * Split the row at the given position, moving the characters after
+     * it onto a new row beneath.
+     */
+    void split_row(int x, int y);
+
+    /**
+     * Join the given row onto the end of the previous one, returning the
+     * length the previous row had.
+     */
+    int join_row(int y);
+
+    /**
+     * Add an additional cursor at the given position.
+     *
+     * Returns false if there is already a cursor there.
+     */
+    bool add_cursor(int x, int y);
+
+    /**
+     * Move the additional cursors in the given direction.
+     */
+    void move_cursors(const char *direction);
+
+    /**
+     * Is there an additional cursor at the given position?
+     */
+    bool has_cursor(int x, int y);
+
     /**
      * Get per-buffer data.
      */
@@ -153,6 +291,12 @@ public:
      */
     void set_data(std::string key, std::string value);
 
+    /**
+     * Get, and set, the distance between tab stops.
+     */
+    int tab_width();
+    void set_tab_width(int width);
+
 public:
 
     /* Cursor x and y position in characters */
@@ -161,6 +305,13 @@ public:
     /* Offset of row/col displayed. */
     int rowoff, coloff;
 
+    /*
+     * The display column at the left edge of the screen, as we might
+     * have scrolled horizontally.  This is shared by every row, whereas
+     * `coloff` is the character which it falls within on the point's.
+     */
+    int scroll;
+
     /* the actual rows */
     std::vector<erow *> rows;
 
@@ -171,7 +322,16 @@ public:
     int markx;
     int marky;
 
+    /*
+     * Additional cursors, in absolute positions, which receive
+     * the same edits as the point.  Sorted, and without duplicates.
+     */
+    std::vector<cursor> cursors;
+
 private:
+    /* The unique ID of this buffer, which is never reused. */
+    int m_id;
+
     /* Is this buffer dirty? */
     bool m_dirty;
 
@@ -181,4 +341,7 @@ private:
     /* per-buffer key/value data */
     std::unordered_map<std::string, std::string> m_data;
 
+    /* The distance between tab stops. */
+    int m_tab_width;
+
 };
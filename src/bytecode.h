@@ -0,0 +1,5688 @@
+/* bytecode.h - Generated by util/embed, do not edit. */
+
+unsigned char kilua_luac[] = {
+	0x1b, 0x4c, 0x75, 0x61, 0x52, 0x00, 0x01, 0x04, 0x08, 0x04, 0x08, 0x00, 
+	0x19, 0x93, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x06, 0x70, 0x01, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x40, 0x00, 0x00, 0x86, 0x80, 0x40, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0xc0, 0x00, 0x00, 0xa5, 0x00, 0x00, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x00, 0x01, 
+	0x00, 0x86, 0x80, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x40, 0x01, 0x00, 0xa5, 0x40, 0x00, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x01, 0x80, 0x01, 0x00, 0x46, 0x00, 0x40, 0x00, 0x81, 0xc0, 0x01, 
+	0x00, 0xe5, 0x80, 0x00, 0x00, 0x5d, 0x40, 0x80, 0x01, 0x57, 0xc0, 0xff, 
+	0x7f, 0x06, 0x00, 0x40, 0x00, 0x41, 0x00, 0x02, 0x00, 0xa5, 0xc0, 0x00, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x02, 
+	0x00, 0xa5, 0x00, 0x01, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x80, 0x02, 0x00, 0xa5, 0x40, 0x01, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0xc0, 0x02, 0x00, 0x86, 0x00, 0x43, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x03, 
+	0x00, 0x86, 0x80, 0x43, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0xc0, 0x03, 0x00, 0x86, 0x00, 0x44, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x04, 0x00, 0xa5, 0x80, 0x01, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x80, 0x04, 
+	0x00, 0xa5, 0xc0, 0x01, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0xc0, 0x04, 0x00, 0xa5, 0x00, 0x02, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x00, 0x05, 0x00, 0xa5, 0x40, 0x02, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x05, 
+	0x00, 0xa5, 0x80, 0x02, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x80, 0x05, 0x00, 0xa5, 0xc0, 0x02, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0xc0, 0x05, 0x00, 0xa5, 0x00, 0x03, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x00, 0x06, 
+	0x00, 0xa5, 0x40, 0x03, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x40, 0x06, 0x00, 0x86, 0x80, 0x43, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x80, 0x06, 0x00, 0x86, 0x00, 0x44, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0xc0, 0x06, 
+	0x00, 0x86, 0x00, 0x47, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x40, 0x07, 0x00, 0x86, 0x80, 0x47, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0xc0, 0x07, 0x00, 0xa5, 0x80, 0x03, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x00, 0x08, 
+	0x00, 0xa5, 0xc0, 0x03, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x40, 0x08, 0x00, 0xa5, 0x00, 0x04, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x80, 0x08, 0x00, 0xa5, 0x40, 0x04, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0xc0, 0x08, 
+	0x00, 0xa5, 0x80, 0x04, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x00, 0x09, 0x00, 0xa5, 0xc0, 0x04, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x09, 0x00, 0xa5, 0x00, 0x05, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x80, 0x09, 
+	0x00, 0x86, 0xc0, 0x49, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x00, 0x0a, 0x00, 0xa5, 0x40, 0x05, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x0a, 0x00, 0xa5, 0x80, 0x05, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x80, 0x0a, 
+	0x00, 0xa5, 0xc0, 0x05, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0xc0, 0x0a, 0x00, 0xa5, 0x00, 0x06, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x00, 0x0b, 0x00, 0xa5, 0x40, 0x06, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x0b, 
+	0x00, 0xa5, 0x80, 0x06, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x80, 0x0b, 0x00, 0xa5, 0xc0, 0x06, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0xc0, 0x0b, 0x00, 0x86, 0x00, 0x4c, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x0c, 
+	0x00, 0xa5, 0x00, 0x07, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x80, 0x0c, 0x00, 0x86, 0xc0, 0x4c, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x00, 0x0d, 0x00, 0xa5, 0x40, 0x07, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x0d, 
+	0x00, 0xa5, 0x80, 0x07, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x80, 0x0d, 0x00, 0xa5, 0xc0, 0x07, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0xc0, 0x0d, 0x00, 0xa5, 0x00, 0x08, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x00, 0x0e, 
+	0x00, 0xa5, 0x40, 0x08, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x40, 0x0e, 0x00, 0xa5, 0x80, 0x08, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x80, 0x0e, 0x00, 0x86, 0xc0, 0x4e, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x00, 0x0f, 
+	0x00, 0xa5, 0xc0, 0x08, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x40, 0x0f, 0x00, 0xa5, 0x00, 0x09, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x80, 0x0f, 0x00, 0xa5, 0x40, 0x09, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0xc0, 0x0f, 
+	0x00, 0xa5, 0x80, 0x09, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x00, 0x10, 0x00, 0x86, 0x40, 0x50, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x80, 0x10, 0x00, 0xa5, 0xc0, 0x09, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x80, 
+	0x00, 0x81, 0xc0, 0x10, 0x00, 0x64, 0x40, 0x80, 0x00, 0xa5, 0x00, 0x0a, 
+	0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 0x00, 0x41, 0x00, 0x11, 
+	0x00, 0xa5, 0x40, 0x0a, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x40, 0x11, 0x00, 0xa5, 0x80, 0x0a, 0x00, 0x1d, 0x40, 0x80, 
+	0x01, 0x25, 0xc0, 0x0a, 0x00, 0x08, 0x00, 0x00, 0xa3, 0x25, 0x00, 0x0b, 
+	0x00, 0x08, 0x00, 0x80, 0xa3, 0x25, 0x40, 0x0b, 0x00, 0x08, 0x00, 0x00, 
+	0xa4, 0x25, 0x80, 0x0b, 0x00, 0x08, 0x00, 0x80, 0xa4, 0x25, 0xc0, 0x0b, 
+	0x00, 0x08, 0x00, 0x00, 0xa5, 0x25, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x80, 
+	0xa5, 0x08, 0x80, 0x41, 0xa6, 0x25, 0x40, 0x0c, 0x00, 0x08, 0x00, 0x80, 
+	0xa6, 0x25, 0x80, 0x0c, 0x00, 0x08, 0x00, 0x00, 0xa7, 0x25, 0xc0, 0x0c, 
+	0x00, 0x08, 0x00, 0x80, 0xa7, 0x25, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x00, 
+	0xa8, 0x25, 0x40, 0x0d, 0x00, 0x08, 0x00, 0x80, 0xa8, 0x25, 0x80, 0x0d, 
+	0x00, 0x08, 0x00, 0x00, 0xa9, 0x25, 0xc0, 0x0d, 0x00, 0x08, 0x00, 0x80, 
+	0xa9, 0x25, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x00, 0xaa, 0x25, 0x40, 0x0e, 
+	0x00, 0x08, 0x00, 0x80, 0xaa, 0x25, 0x80, 0x0e, 0x00, 0x08, 0x00, 0x00, 
+	0xab, 0x25, 0xc0, 0x0e, 0x00, 0x08, 0x00, 0x80, 0xab, 0x25, 0x00, 0x0f, 
+	0x00, 0x08, 0x00, 0x00, 0xac, 0x25, 0x40, 0x0f, 0x00, 0x08, 0x00, 0x80, 
+	0xac, 0x25, 0x80, 0x0f, 0x00, 0x08, 0x00, 0x00, 0xad, 0x25, 0xc0, 0x0f, 
+	0x00, 0x08, 0x00, 0x80, 0xad, 0x25, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 
+	0xae, 0x25, 0x40, 0x10, 0x00, 0x08, 0x00, 0x80, 0xae, 0x25, 0x80, 0x10, 
+	0x00, 0x08, 0x00, 0x00, 0xaf, 0x06, 0xc0, 0x57, 0x00, 0x1b, 0x00, 0x00, 
+	0x00, 0x17, 0xc0, 0x05, 0x80, 0x06, 0x00, 0x58, 0x00, 0x46, 0x40, 0x58, 
+	0x00, 0x81, 0x80, 0x18, 0x00, 0x1d, 0xc0, 0x80, 0x01, 0x1b, 0x00, 0x00, 
+	0x00, 0x57, 0x40, 0x04, 0x80, 0x87, 0xc0, 0xd8, 0x00, 0xc1, 0x00, 0x19, 
+	0x00, 0x9d, 0x40, 0x00, 0x01, 0x87, 0x40, 0xd9, 0x00, 0xc7, 0x80, 0xd9, 
+	0x00, 0x01, 0xc1, 0x19, 0x00, 0xdd, 0x80, 0x00, 0x01, 0x06, 0x01, 0x58, 
+	0x00, 0x65, 0xc1, 0x10, 0x00, 0x1d, 0x81, 0x00, 0x01, 0x1b, 0x01, 0x00, 
+	0x00, 0x57, 0x40, 0x01, 0x80, 0x25, 0x01, 0x11, 0x00, 0x08, 0x00, 0x01, 
+	0xb4, 0x25, 0x41, 0x11, 0x00, 0x08, 0x00, 0x81, 0xb4, 0x57, 0x00, 0x00, 
+	0x80, 0x57, 0xc0, 0xff, 0x7f, 0x06, 0x80, 0x5a, 0x00, 0x41, 0xc0, 0x1a, 
+	0x00, 0x81, 0xc0, 0x1a, 0x00, 0x1d, 0x40, 0x80, 0x01, 0x06, 0x00, 0x5b, 
+	0x00, 0x18, 0x40, 0x5b, 0x00, 0x17, 0x80, 0x00, 0x80, 0x06, 0x80, 0x5b, 
+	0x00, 0x41, 0xc0, 0x1b, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x25, 0x80, 0x11, 
+	0x00, 0x08, 0x00, 0x00, 0xb8, 0x25, 0xc0, 0x11, 0x00, 0x08, 0x00, 0x80, 
+	0xb8, 0x25, 0x00, 0x12, 0x00, 0x08, 0x00, 0x00, 0xb9, 0x25, 0x40, 0x12, 
+	0x00, 0x08, 0x00, 0x80, 0xb9, 0x06, 0x00, 0x5d, 0x00, 0x46, 0x00, 0x5d, 
+	0x00, 0x47, 0x40, 0xdd, 0x00, 0x81, 0x80, 0x1d, 0x00, 0x56, 0x80, 0x80, 
+	0x00, 0x0a, 0x40, 0x80, 0xba, 0x06, 0x00, 0x5d, 0x00, 0x46, 0x00, 0x5d, 
+	0x00, 0x47, 0x40, 0xdd, 0x00, 0x81, 0xc0, 0x1d, 0x00, 0xc6, 0x00, 0x5e, 
+	0x00, 0xc7, 0x40, 0xde, 0x01, 0x01, 0x81, 0x1e, 0x00, 0xdd, 0x80, 0x00, 
+	0x01, 0x01, 0xc1, 0x1e, 0x00, 0x56, 0x00, 0x81, 0x00, 0x0a, 0x40, 0x80, 
+	0xba, 0x25, 0x80, 0x12, 0x00, 0x08, 0x00, 0x00, 0xbe, 0x25, 0xc0, 0x12, 
+	0x00, 0x08, 0x00, 0x80, 0xbe, 0x06, 0x80, 0x5f, 0x00, 0x41, 0xc0, 0x1f, 
+	0x00, 0x86, 0x00, 0x60, 0x00, 0x56, 0x80, 0x80, 0x00, 0x1d, 0x40, 0x00, 
+	0x01, 0x25, 0x00, 0x13, 0x00, 0x08, 0x00, 0x80, 0xc0, 0x08, 0xc0, 0x60, 
+	0xc1, 0x25, 0x40, 0x13, 0x00, 0x08, 0x00, 0x00, 0xc2, 0x25, 0x80, 0x13, 
+	0x00, 0x08, 0x00, 0x80, 0xc2, 0x25, 0xc0, 0x13, 0x00, 0x08, 0x00, 0x00, 
+	0xc3, 0x25, 0x00, 0x14, 0x00, 0x08, 0x00, 0x80, 0xc3, 0x25, 0x40, 0x14, 
+	0x00, 0x08, 0x00, 0x00, 0xc4, 0x25, 0x80, 0x14, 0x00, 0x08, 0x00, 0x80, 
+	0xc4, 0x1f, 0x00, 0x80, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x69, 0x6e, 0x64, 0x00, 0x04, 
+	0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x45, 0x59, 0x5f, 
+	0x42, 0x41, 0x43, 0x4b, 0x53, 0x50, 0x41, 0x43, 0x45, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6c, 0x65, 0x74, 
+	0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 
+	0x45, 0x59, 0x5f, 0x44, 0x43, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5e, 0x48, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5e, 0x44, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5e, 0x53, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x4d, 0x2d, 0x67, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5e, 0x4b, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5e, 0x59, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x4d, 0x2d, 0x71, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x65, 0x78, 0x69, 0x74, 0x00, 0x04, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x41, 0x00, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x6f, 0x6c, 0x00, 0x04, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x45, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6f, 0x6c, 0x00, 0x04, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x42, 0x00, 0x04, 0x09, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x45, 0x59, 0x5f, 0x4c, 
+	0x45, 0x46, 0x54, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5e, 0x46, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x4b, 0x45, 0x59, 0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x00, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x50, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x45, 0x59, 0x5f, 
+	0x55, 0x50, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x4b, 0x45, 0x59, 0x5f, 0x44, 0x4f, 0x57, 0x4e, 0x00, 0x04, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x4e, 0x00, 0x04, 0x09, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x45, 0x59, 0x5f, 0x48, 0x4f, 
+	0x4d, 0x45, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x4b, 0x45, 0x59, 0x5f, 0x45, 0x4e, 0x44, 0x00, 0x04, 0x0b, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x2d, 0x4b, 0x45, 0x59, 0x5f, 0x48, 
+	0x4f, 0x4d, 0x45, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x73, 0x6f, 0x66, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x4d, 0x2d, 0x4b, 0x45, 0x59, 0x5f, 0x45, 0x4e, 0x44, 0x00, 
+	0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6f, 0x66, 
+	0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x45, 
+	0x59, 0x5f, 0x50, 0x50, 0x41, 0x47, 0x45, 0x00, 0x04, 0x0a, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x45, 0x59, 0x5f, 0x4e, 0x50, 0x41, 
+	0x47, 0x45, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x4d, 0x2d, 0x78, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x4d, 0x2d, 0x21, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x4d, 0x2d, 0x26, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x4d, 0x2d, 0x6d, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x5e, 0x43, 0x00, 0x04, 0x06, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x5e, 0x53, 
+	0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x61, 
+	0x76, 0x65, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5e, 0x58, 0x20, 0x69, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5e, 0x58, 0x20, 0x5e, 0x4f, 0x00, 0x04, 0x06, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x5e, 0x46, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x5e, 
+	0x56, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 
+	0x2d, 0x4b, 0x45, 0x59, 0x5f, 0x4c, 0x45, 0x46, 0x54, 0x00, 0x04, 0x0c, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x2d, 0x4b, 0x45, 0x59, 
+	0x5f, 0x52, 0x49, 0x47, 0x48, 0x54, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x42, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x4b, 0x00, 0x04, 
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x69, 0x6c, 0x6c, 
+	0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x62, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x63, 0x00, 
+	0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x72, 0x65, 
+	0x61, 0x74, 0x65, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x6b, 
+	0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 
+	0x20, 0x6e, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5e, 0x58, 0x20, 0x70, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5e, 0x58, 0x20, 0x73, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x50, 0x00, 0x04, 0x06, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x5e, 0x4b, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 
+	0x28, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 
+	0x61, 0x63, 0x72, 0x6f, 0x5f, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 
+	0x29, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 
+	0x58, 0x20, 0x65, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5e, 0x58, 0x20, 0x45, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x4d, 0x2d, 0x63, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x4d, 0x2d, 0x43, 0x00, 0x04, 0x0e, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x5f, 0x63, 
+	0x75, 0x72, 0x73, 0x6f, 0x72, 0x73, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x5e, 0x58, 0x20, 0x6d, 0x00, 0x04, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x20, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x2d, 0x77, 0x00, 0x04, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x57, 0x00, 0x04, 0x0a, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x6e, 0x5f, 0x6c, 0x6f, 
+	0x61, 0x64, 0x65, 0x64, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6f, 0x6e, 0x5f, 0x73, 0x61, 0x76, 0x65, 0x00, 0x04, 0x09, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x6e, 0x5f, 0x73, 0x61, 
+	0x76, 0x65, 0x64, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x04, 
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6d, 0x64, 0x5f, 
+	0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x5f, 0x66, 
+	0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x73, 0x00, 0x04, 0x0d, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x73, 0x74, 0x65, 0x5f, 0x62, 
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 
+	0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 
+	0x73, 0x74, 0x65, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 
+	0x00, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 
+	0x70, 0x79, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x75, 
+	0x74, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 
+	0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x70, 
+	0x6c, 0x61, 0x79, 0x5f, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x00, 0x04, 0x11, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x5f, 0x63, 
+	0x75, 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x00, 
+	0x04, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 
+	0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x73, 0x5f, 0x6d, 0x61, 0x74, 
+	0x63, 0x68, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x5f, 0x6b, 
+	0x69, 0x6c, 0x6c, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x75, 0x69, 0x74, 
+	0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x76, 
+	0x61, 0x6c, 0x5f, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x5f, 0x63, 
+	0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x04, 0x0e, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x5f, 
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6e, 0x65, 0x78, 0x74, 0x5f, 0x62, 0x75, 0x66, 
+	0x66, 0x65, 0x72, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x70, 0x72, 0x65, 0x76, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 
+	0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x6f, 
+	0x6f, 0x6b, 0x6d, 0x61, 0x72, 0x6b, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x00, 
+	0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x6f, 0x6f, 
+	0x6b, 0x6d, 0x61, 0x72, 0x6b, 0x5f, 0x73, 0x61, 0x76, 0x65, 0x00, 0x04, 
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x6e, 0x5f, 0x69, 
+	0x64, 0x6c, 0x65, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6a, 0x69, 0x74, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x70, 0x63, 0x61, 0x6c, 0x6c, 0x00, 0x04, 0x08, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 
+	0x69, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 
+	0x64, 0x65, 0x66, 0x00, 0x04, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 
+	0x74, 0x20, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x5f, 0x62, 0x75, 0x66, 0x66, 
+	0x65, 0x72, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6b, 
+	0x69, 0x6c, 0x75, 0x61, 0x5f, 0x72, 0x6f, 0x77, 0x73, 0x28, 0x69, 0x6e, 
+	0x74, 0x20, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 
+	0x61, 0x72, 0x20, 0x2a, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x5f, 0x72, 0x6f, 
+	0x77, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x2c, 0x20, 0x69, 0x6e, 
+	0x74, 0x20, 0x6e, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 
+	0x2a, 0x6c, 0x65, 0x6e, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6b, 0x69, 0x6c, 0x75, 
+	0x61, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5f, 0x63, 0x6f, 0x6c, 
+	0x6f, 0x75, 0x72, 0x73, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x64, 0x2c, 
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 
+	0x2a, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x73, 0x2c, 0x20, 0x73, 0x69, 
+	0x7a, 0x65, 0x5f, 0x74, 0x20, 0x6c, 0x65, 0x6e, 0x29, 0x3b, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x43, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6e, 0x65, 0x77, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x74, 0x5b, 0x31, 0x5d, 
+	0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x69, 
+	0x6e, 0x65, 0x00, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 
+	0x72, 0x73, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x67, 0x63, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x40, 
+	0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x65, 0x74, 
+	0x5f, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x5f, 0x62, 0x61, 0x72, 0x00, 
+	0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 
+	0x61, 0x74, 0x75, 0x73, 0x5f, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x00, 
+	0x04, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x7b, 0x62, 
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x7d, 0x2f, 0x24, 0x7b, 0x62, 0x75, 0x66, 
+	0x66, 0x65, 0x72, 0x73, 0x7d, 0x20, 0x2d, 0x20, 0x24, 0x7b, 0x66, 0x69, 
+	0x6c, 0x65, 0x7d, 0x20, 0x24, 0x7b, 0x6d, 0x6f, 0x64, 0x65, 0x7d, 0x20, 
+	0x24, 0x7b, 0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x7d, 0x20, 
+	0x23, 0x42, 0x4c, 0x41, 0x4e, 0x4b, 0x23, 0x20, 0x43, 0x6f, 0x6c, 0x3a, 
+	0x24, 0x7b, 0x78, 0x7d, 0x20, 0x52, 0x6f, 0x77, 0x3a, 0x24, 0x7b, 0x79, 
+	0x7d, 0x20, 0x5b, 0x24, 0x7b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x7d, 0x5d, 
+	0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x6e, 
+	0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x00, 0x04, 0x08, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x67, 0x65, 0x5f, 
+	0x75, 0x70, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x70, 0x61, 0x67, 0x65, 0x5f, 0x64, 0x6f, 0x77, 0x6e, 0x00, 0x04, 0x0a, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x6f, 0x74, 0x6f, 0x5f, 
+	0x6c, 0x69, 0x6e, 0x65, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x70, 0x61, 0x63, 0x6b, 0x61, 0x67, 0x65, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x74, 0x68, 0x00, 
+	0x04, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x2f, 0x65, 
+	0x74, 0x63, 0x2f, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2f, 0x73, 0x79, 0x6e, 
+	0x74, 0x61, 0x78, 0x2f, 0x3f, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x73, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x65, 0x74, 0x65, 0x6e, 0x76, 
+	0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x4f, 
+	0x4d, 0x45, 0x00, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x2f, 0x2e, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2f, 0x73, 0x79, 0x6e, 0x74, 
+	0x61, 0x78, 0x2f, 0x3f, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x0c, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x00, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6f, 0x6e, 0x5f, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 
+	0x5f, 0x68, 0x69, 0x67, 0x68, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 
+	0x75, 0x73, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x4b, 0x69, 0x6c, 0x75, 0x61, 0x20, 0x76, 0x00, 0x04, 0x0e, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x49, 0x4c, 0x55, 0x41, 0x5f, 0x56, 
+	0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x72, 0x75, 0x6e, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 
+	0x61, 0x6e, 0x64, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 
+	0x61, 0x6e, 0x64, 0x73, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 
+	0x6e, 0x73, 0x65, 0x72, 0x74, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 
+	0x64, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x00, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x64, 0x00, 0x04, 
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x68, 0x6f, 0x77, 
+	0x5f, 0x73, 0x74, 0x61, 0x74, 0x73, 0x00, 0x04, 0x0f, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x5f, 0x70, 
+	0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6c, 0x73, 0x00, 0x53, 0x00, 0x00, 0x00, 0x4c, 
+	0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x5f, 0x66, 0x6f, 
+	0x72, 0x77, 0x61, 0x72, 0x64, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 
+	0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 
+	0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+	0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 
+	0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x5f, 
+	0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x73, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 0x00, 
+	0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x07, 0x1f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 
+	0x00, 0x00, 0x1d, 0x80, 0x00, 0x01, 0x58, 0x80, 0x40, 0x00, 0x17, 0x40, 
+	0x00, 0x80, 0x18, 0xc0, 0x40, 0x00, 0x17, 0x00, 0x00, 0x80, 0x05, 0x00, 
+	0x80, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x17, 0xc0, 0x04, 0x80, 0x46, 0x00, 
+	0x41, 0x00, 0x5d, 0xc0, 0x80, 0x00, 0xc6, 0x40, 0x41, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0xdd, 0x80, 0x00, 0x01, 0xdb, 0x00, 0x00, 0x00, 0x17, 0xc0, 
+	0x02, 0x80, 0xc6, 0x00, 0x41, 0x00, 0xdd, 0xc0, 0x80, 0x00, 0x18, 0xc0, 
+	0x80, 0x00, 0x17, 0xc0, 0x01, 0x80, 0x18, 0x00, 0x01, 0x01, 0x17, 0x40, 
+	0x01, 0x80, 0x46, 0x81, 0x41, 0x00, 0x81, 0xc1, 0x01, 0x00, 0x5d, 0x41, 
+	0x00, 0x01, 0x46, 0x41, 0x41, 0x00, 0x80, 0x01, 0x00, 0x00, 0x5d, 0x41, 
+	0x00, 0x01, 0x09, 0x00, 0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x08, 0x00, 
+	0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
+	0x72, 0x6f, 0x6d, 0x70, 0x74, 0x00, 0x04, 0x12, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x28, 0x72, 0x65, 0x67, 0x65, 0x78, 0x70, 0x29, 0x20, 
+	0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x3f, 0x20, 0x00, 0x00, 0x04, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x65, 0x61, 0x72, 
+	0x63, 0x68, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6d, 0x6f, 0x76, 0x65, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5d, 
+	0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 
+	0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x61, 
+	0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x67, 
+	0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6a, 
+	0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6a, 
+	0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x70, 
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 
+	0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x71, 
+	0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 
+	0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
+	0x65, 0x72, 0x6d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0c, 0x00, 
+	0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x79, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x32, 0x00, 0x13, 
+	0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x79, 0x32, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1d, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x74, 0x65, 
+	0x72, 0x6d, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 
+	0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0a, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x6f, 0x74, 0x6f, 0x5f, 
+	0x6c, 0x69, 0x6e, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x84, 
+	0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 
+	0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 0x84, 0x00, 
+	0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
+	0x61, 0x73, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x91, 
+	0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x00, 0x1d, 0x40, 
+	0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x76, 0x65, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x66, 
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 
+	0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x00, 0x00, 0x00, 0x91, 
+	0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x91, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x92, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x00, 0x1d, 
+	0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x76, 0x65, 
+	0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 
+	0x66, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 
+	0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x00, 0x00, 0x00, 
+	0x92, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 
+	0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 
+	0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+	0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x00, 
+	0x1d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x76, 
+	0x65, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 
+	0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x00, 
+	0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 
+	0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0x94, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 
+	0x00, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 
+	0x6f, 0x76, 0x65, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x04, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 
+	0x94, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5f, 0x45, 0x4e, 0x56, 0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 
+	0x41, 0x40, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 
+	0x02, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x75, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 
+	0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x45, 0x4e, 0x56, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 
+	0x40, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6d, 0x6f, 0x76, 0x65, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x75, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x00, 
+	0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 
+	0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 
+	0x00, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 
+	0x6f, 0x76, 0x65, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x64, 0x6f, 0x77, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 
+	0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x45, 0x4e, 0x56, 0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 
+	0x40, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6d, 0x6f, 0x76, 0x65, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x64, 0x6f, 0x77, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x04, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 
+	0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5f, 0x45, 0x4e, 0x56, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 
+	0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x67, 
+	0x65, 0x5f, 0x75, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x9e, 
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x70, 0x61, 0x67, 0x65, 0x5f, 0x64, 0x6f, 0x77, 0x6e, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 
+	0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 0x9e, 0x00, 
+	0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 
+	0x76, 0x61, 0x6c, 0x5f, 0x6c, 0x75, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 
+	0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 
+	0x56, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 
+	0x00, 0x1d, 0x80, 0x00, 0x01, 0x1b, 0x00, 0x00, 0x00, 0x17, 0x80, 0x00, 
+	0x80, 0x46, 0x80, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0x5d, 0x40, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 
+	0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x78, 
+	0x65, 0x63, 0x75, 0x74, 0x65, 0x3a, 0x00, 0x04, 0x16, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x5f, 0x63, 
+	0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 
+	0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 
+	0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x09, 0x00, 0x00, 0x00, 0xab, 
+	0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xac, 
+	0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xad, 
+	0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 
+	0x6d, 0x64, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x45, 0x4e, 0x56, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 
+	0x40, 0x00, 0x00, 0x1d, 0x80, 0x00, 0x01, 0x1b, 0x00, 0x00, 0x00, 0x17, 
+	0xc0, 0x00, 0x80, 0x46, 0x80, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc1, 
+	0xc0, 0x00, 0x00, 0x5d, 0x40, 0x80, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x3a, 
+	0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x75, 
+	0x6e, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x00, 0x04, 0x09, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x4f, 0x75, 0x74, 0x70, 
+	0x75, 0x74, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 
+	0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x0a, 0x00, 0x00, 
+	0x00, 0xb6, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 
+	0x00, 0xb7, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 
+	0x00, 0xb8, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 
+	0x00, 0xba, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6d, 0x64, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xc0, 0x00, 
+	0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x62, 0x6f, 0x6f, 0x6b, 0x6d, 0x61, 0x72, 0x6b, 0x5f, 0x73, 
+	0x61, 0x76, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 
+	0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xcb, 0x00, 
+	0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x71, 0x75, 0x69, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 
+	0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 
+	0x00, 0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+	0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 
+	0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x5f, 
+	0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 
+	0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x43, 0x00, 
+	0x80, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 
+	0x70, 0x65, 0x6e, 0x5f, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xd1, 0x00, 
+	0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xd2, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x43, 0x00, 0x80, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x1f, 0x00, 
+	0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 0x66, 0x69, 0x6c, 0x65, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 
+	0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd2, 0x00, 
+	0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xd2, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xd3, 
+	0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x43, 0x00, 0x00, 0x00, 0x1d, 0x40, 
+	0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0a, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x70, 0x65, 0x6e, 0x5f, 
+	0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x00, 
+	0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd3, 0x00, 
+	0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 
+	0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0c, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x72, 0x65, 0x76, 0x5f, 
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 
+	0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 
+	0x00, 0xd9, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+	0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 
+	0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x65, 0x78, 0x74, 0x5f, 0x62, 0x75, 
+	0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xd9, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xda, 
+	0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x5f, 0x62, 0x75, 
+	0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0xda, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xdc, 
+	0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x63, 0x68, 0x6f, 0x6f, 0x73, 0x65, 0x5f, 0x62, 0x75, 
+	0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdc, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xde, 
+	0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x66, 0x69, 0x72, 0x6d, 0x5f, 0x6b, 
+	0x69, 0x6c, 0x6c, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 
+	0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 
+	0xde, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5f, 0x45, 0x4e, 0x56, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 
+	0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x65, 0x78, 
+	0x74, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xdf, 0x00, 
+	0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 
+	0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0c, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x72, 0x65, 0x76, 0x5f, 
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 
+	0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 
+	0x00, 0xe5, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+	0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 
+	0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x68, 0x6f, 0x77, 0x5f, 0x73, 0x74, 
+	0x61, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 
+	0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0xe5, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xea, 0x00, 
+	0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x5f, 0x70, 0x72, 0x6f, 
+	0x66, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0xea, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xef, 
+	0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x80, 0x80, 0x00, 0x1b, 0x40, 
+	0x00, 0x00, 0x17, 0x80, 0x00, 0x80, 0x06, 0x40, 0x40, 0x00, 0x41, 0x80, 
+	0x00, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 
+	0x69, 0x6c, 0x6c, 0x5f, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x00, 
+	0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 
+	0x74, 0x75, 0x73, 0x00, 0x04, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x4e, 0x6f, 0x20, 0x70, 0x72, 0x6f, 0x63, 0x65, 0x73, 0x73, 0x20, 
+	0x74, 0x6f, 0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x08, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 
+	0x00, 0xf1, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xff, 0x00, 
+	0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x00, 0x1d, 0x40, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x5f, 
+	0x73, 0x74, 0x6f, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 
+	0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 
+	0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 
+	0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x5f, 0x72, 0x65, 
+	0x70, 0x6c, 0x61, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x01, 
+	0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x79, 0x5f, 0x6d, 0x61, 
+	0x63, 0x72, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 
+	0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x0b, 0x01, 
+	0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x61, 0x64, 0x64, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 
+	0x5f, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 
+	0x0b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 
+	0x00, 0x0d, 0x01, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 
+	0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 
+	0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x15, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x5f, 0x63, 0x75, 0x72, 
+	0x73, 0x6f, 0x72, 0x73, 0x5f, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6e, 
+	0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 
+	0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0d, 
+	0x01, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x13, 0x01, 0x00, 0x00, 
+	0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 
+	0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x5f, 0x6d, 0x61, 0x72, 0x6b, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 
+	0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 
+	0x00, 0x13, 0x01, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x14, 0x01, 0x00, 0x00, 0x14, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 
+	0x70, 0x79, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 
+	0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x01, 
+	0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x15, 0x01, 0x00, 0x00, 0x15, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 
+	0x75, 0x74, 0x5f, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 
+	0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x01, 
+	0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x27, 0x01, 0x00, 0x00, 0x6a, 
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x48, 0x00, 0x00, 0x00, 0x1b, 0x40, 
+	0x00, 0x00, 0x17, 0x00, 0x00, 0x80, 0x1f, 0x00, 0x80, 0x00, 0x4c, 0x00, 
+	0x40, 0x00, 0xc1, 0x40, 0x00, 0x00, 0x5d, 0x80, 0x80, 0x01, 0x5b, 0x40, 
+	0x00, 0x00, 0x17, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x8c, 0x00, 
+	0xc0, 0x00, 0x01, 0x81, 0x00, 0x00, 0x9d, 0x80, 0x80, 0x01, 0x9b, 0x40, 
+	0x00, 0x00, 0x17, 0x00, 0x00, 0x80, 0x80, 0x00, 0x80, 0x00, 0xcb, 0x00, 
+	0x00, 0x00, 0xca, 0x00, 0xc1, 0x81, 0x06, 0x41, 0x41, 0x00, 0x47, 0x81, 
+	0x80, 0x01, 0x5b, 0x41, 0x00, 0x00, 0x17, 0x00, 0x00, 0x80, 0x41, 0x81, 
+	0x01, 0x00, 0x1d, 0x41, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x00, 0x0a, 0x01, 
+	0xc2, 0x83, 0x0a, 0x01, 0x42, 0x84, 0x0a, 0x01, 0xc2, 0x84, 0x0a, 0xc1, 
+	0x42, 0x85, 0x0a, 0xc1, 0xc0, 0x81, 0x0a, 0x01, 0x42, 0x86, 0x0a, 0x81, 
+	0xc3, 0x86, 0x0a, 0x81, 0x43, 0x87, 0x0a, 0xc1, 0xc3, 0x87, 0x0a, 0xc1, 
+	0x43, 0x88, 0x0a, 0x41, 0xc4, 0x88, 0x0a, 0x81, 0x44, 0x89, 0x0a, 0x01, 
+	0xc5, 0x89, 0x0a, 0x01, 0xc5, 0x8a, 0x0a, 0xc1, 0x45, 0x8b, 0x47, 0x81, 
+	0x00, 0x02, 0x5b, 0x01, 0x00, 0x00, 0x17, 0x00, 0x03, 0x80, 0x46, 0x01, 
+	0x46, 0x00, 0x87, 0x81, 0x00, 0x02, 0x5d, 0x41, 0x00, 0x01, 0x46, 0x41, 
+	0x46, 0x00, 0x81, 0x81, 0x06, 0x00, 0xc7, 0x81, 0x00, 0x02, 0x01, 0xc2, 
+	0x06, 0x00, 0x40, 0x02, 0x00, 0x01, 0x96, 0x41, 0x02, 0x03, 0x5d, 0x41, 
+	0x00, 0x01, 0x46, 0x01, 0x47, 0x00, 0x5d, 0x41, 0x80, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x47, 0x41, 0x00, 0x02, 0x5b, 0x01, 0x00, 0x00, 0x17, 0x00, 
+	0x03, 0x80, 0x46, 0x01, 0x46, 0x00, 0x87, 0x41, 0x00, 0x02, 0x5d, 0x41, 
+	0x00, 0x01, 0x46, 0x41, 0x46, 0x00, 0x81, 0x81, 0x06, 0x00, 0xc7, 0x81, 
+	0x00, 0x02, 0x01, 0x42, 0x07, 0x00, 0x40, 0x02, 0x80, 0x00, 0x96, 0x41, 
+	0x02, 0x03, 0x5d, 0x41, 0x00, 0x01, 0x46, 0x01, 0x47, 0x00, 0x5d, 0x41, 
+	0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x1e, 0x00, 
+	0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 
+	0x61, 0x74, 0x63, 0x68, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5e, 0x2e, 0x2b, 0x2f, 0x28, 0x2e, 0x2b, 0x29, 0x24, 0x00, 
+	0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x2e, 0x2b, 
+	0x25, 0x2e, 0x28, 0x2e, 0x2b, 0x29, 0x24, 0x00, 0x04, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x6f, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x10, 0x40, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x74, 0x61, 0x62, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x04, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x04, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x00, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x70, 0x70, 0x00, 0x04, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6c, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x73, 0x70, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x04, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x74, 0x6d, 0x00, 0x04, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x74, 0x6d, 0x6c, 
+	0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6d, 
+	0x61, 0x69, 0x6c, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6d, 0x73, 0x67, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x69, 0x6e, 0x69, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6d, 0x64, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x78, 
+	0x74, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 
+	0x61, 0x6b, 0x65, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x04, 0x09, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x66, 0x69, 0x6c, 
+	0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x16, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x65, 0x6c, 0x65, 0x63, 
+	0x74, 0x65, 0x64, 0x20, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 0x6d, 
+	0x6f, 0x64, 0x65, 0x20, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x20, 0x76, 0x69, 0x61, 0x20, 0x73, 0x75, 0x66, 0x66, 0x69, 
+	0x78, 0x20, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6f, 0x6e, 0x5f, 0x69, 0x64, 0x6c, 0x65, 0x00, 0x04, 0x0f, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x76, 0x69, 0x61, 0x20, 0x66, 0x69, 
+	0x6c, 0x65, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x48, 0x00, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 
+	0x00, 0x29, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 
+	0x00, 0x2c, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 
+	0x00, 0x2c, 0x01, 0x00, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x2d, 0x01, 0x00, 
+	0x00, 0x2d, 0x01, 0x00, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x2d, 0x01, 0x00, 
+	0x00, 0x2d, 0x01, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x34, 0x01, 0x00, 
+	0x00, 0x36, 0x01, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x36, 0x01, 0x00, 
+	0x00, 0x36, 0x01, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x36, 0x01, 0x00, 
+	0x00, 0x3b, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x3d, 0x01, 0x00, 
+	0x00, 0x3e, 0x01, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 
+	0x00, 0x41, 0x01, 0x00, 0x00, 0x42, 0x01, 0x00, 0x00, 0x43, 0x01, 0x00, 
+	0x00, 0x44, 0x01, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x46, 0x01, 0x00, 
+	0x00, 0x47, 0x01, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x49, 0x01, 0x00, 
+	0x00, 0x4a, 0x01, 0x00, 0x00, 0x4f, 0x01, 0x00, 0x00, 0x4f, 0x01, 0x00, 
+	0x00, 0x4f, 0x01, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x52, 0x01, 0x00, 
+	0x00, 0x52, 0x01, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x53, 0x01, 0x00, 
+	0x00, 0x53, 0x01, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x53, 0x01, 0x00, 
+	0x00, 0x53, 0x01, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x56, 0x01, 0x00, 
+	0x00, 0x56, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x61, 0x01, 0x00, 
+	0x00, 0x61, 0x01, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 
+	0x00, 0x62, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 
+	0x00, 0x63, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 
+	0x00, 0x63, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 
+	0x00, 0x66, 0x01, 0x00, 0x00, 0x66, 0x01, 0x00, 0x00, 0x68, 0x01, 0x00, 
+	0x00, 0x6a, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x69, 0x6c, 0x65, 0x00, 0x09, 
+	0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x65, 0x78, 0x74, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x48, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
+	0x61, 0x62, 0x73, 0x00, 0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x18, 0x00, 
+	0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x73, 
+	0x01, 0x00, 0x00, 0x75, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x04, 0x00, 
+	0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x81, 0x40, 0x00, 0x00, 0x5d, 0x40, 
+	0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 
+	0x73, 0x00, 0x04, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 
+	0x62, 0x6f, 0x75, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x73, 0x61, 0x76, 0x65, 
+	0x20, 0x2e, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 
+	0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0x74, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 
+	0x00, 0x75, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x61, 0x6d, 
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0x7f, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x01, 
+	0x00, 0x0b, 0x21, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x86, 0x40, 
+	0x40, 0x00, 0x87, 0x80, 0x40, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x9d, 0x00, 
+	0x01, 0x01, 0x17, 0xc0, 0x05, 0x80, 0x4d, 0xc0, 0xc0, 0x00, 0x18, 0xc0, 
+	0xc0, 0x00, 0x17, 0x00, 0x05, 0x80, 0x86, 0x01, 0x41, 0x00, 0x87, 0x41, 
+	0x41, 0x03, 0xc0, 0x01, 0x80, 0x02, 0x01, 0x82, 0x01, 0x00, 0x9d, 0x81, 
+	0x80, 0x01, 0x9b, 0x01, 0x00, 0x00, 0x17, 0xc0, 0x03, 0x80, 0x86, 0xc1, 
+	0x41, 0x00, 0xc1, 0x01, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x41, 0x42, 
+	0x02, 0x00, 0x80, 0x02, 0x80, 0x02, 0xd6, 0x81, 0x82, 0x03, 0x9d, 0x41, 
+	0x00, 0x01, 0x86, 0x81, 0x42, 0x00, 0x87, 0xc1, 0x42, 0x03, 0xc1, 0x01, 
+	0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0xd6, 0x01, 0x82, 0x03, 0x9d, 0x41, 
+	0x00, 0x01, 0x17, 0x40, 0x00, 0x80, 0xa2, 0x40, 0x00, 0x00, 0x23, 0x41, 
+	0xf9, 0x7f, 0x1f, 0x00, 0x80, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x69, 0x6f, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x74, 0x63, 
+	0x68, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 
+	0x23, 0x21, 0x2f, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x12, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x68, 0x65, 0x62, 0x61, 0x6e, 0x67, 
+	0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x73, 0x00, 0x04, 0x08, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x78, 0x65, 0x63, 0x75, 
+	0x74, 0x65, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x63, 0x68, 0x6d, 0x6f, 0x64, 0x20, 0x37, 0x35, 0x35, 0x20, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 
+	0x6c, 0x75, 0x61, 0x00, 0x21, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 
+	0x85, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 
+	0x85, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x86, 0x01, 0x00, 0x00, 
+	0x87, 0x01, 0x00, 0x00, 0x87, 0x01, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 
+	0x88, 0x01, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 
+	0x88, 0x01, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 
+	0x8a, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x00, 0x00, 
+	0x8a, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x00, 0x00, 
+	0x8a, 0x01, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00, 
+	0x8b, 0x01, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00, 
+	0x8b, 0x01, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 
+	0x85, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x69, 0x6c, 0x65, 
+	0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x65, 0x6e, 0x65, 
+	0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x05, 0x00, 0x00, 0x00, 0x20, 
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
+	0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 
+	0x72, 0x6f, 0x6c, 0x29, 0x00, 0x05, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x06, 
+	0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x9f, 0x01, 0x00, 0x00, 0xcd, 0x01, 0x00, 0x00, 0x01, 0x00, 0x04, 0x3d, 
+	0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x80, 0x46, 
+	0x00, 0x40, 0x00, 0x81, 0x40, 0x00, 0x00, 0x5d, 0x80, 0x00, 0x01, 0x5b, 
+	0x00, 0x00, 0x00, 0x17, 0xc0, 0x01, 0x80, 0x58, 0x80, 0xc0, 0x00, 0x17, 
+	0x40, 0x01, 0x80, 0x86, 0xc0, 0x40, 0x00, 0x9d, 0x40, 0x80, 0x00, 0x86, 
+	0x00, 0x41, 0x00, 0xc0, 0x00, 0x80, 0x00, 0x9d, 0x40, 0x00, 0x01, 0x17, 
+	0x80, 0x00, 0x80, 0x86, 0x40, 0x41, 0x00, 0xc1, 0x80, 0x01, 0x00, 0x9d, 
+	0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x46, 0xc0, 0x41, 0x00, 0x5d, 
+	0x80, 0x80, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x80, 0x06, 0x80, 0x46, 
+	0x40, 0x41, 0x00, 0x81, 0x00, 0x02, 0x00, 0x5d, 0x40, 0x00, 0x01, 0x43, 
+	0x00, 0x80, 0x00, 0x18, 0x40, 0xc2, 0x00, 0x17, 0x00, 0x05, 0x80, 0x86, 
+	0xc0, 0x42, 0x00, 0x9d, 0x80, 0x80, 0x00, 0x08, 0x80, 0x00, 0x85, 0x86, 
+	0x80, 0x42, 0x00, 0x58, 0x00, 0x43, 0x01, 0x17, 0x80, 0x00, 0x80, 0x86, 
+	0x80, 0x42, 0x00, 0x18, 0x40, 0x43, 0x01, 0x17, 0x00, 0x00, 0x80, 0x43, 
+	0x00, 0x00, 0x00, 0x86, 0x80, 0x42, 0x00, 0x58, 0x80, 0x43, 0x01, 0x17, 
+	0x80, 0x00, 0x80, 0x86, 0x80, 0x42, 0x00, 0x18, 0xc0, 0x43, 0x01, 0x17, 
+	0x40, 0xfb, 0x7f, 0x86, 0x40, 0x41, 0x00, 0xc1, 0x80, 0x01, 0x00, 0x9d, 
+	0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x17, 0x00, 0xfa, 0x7f, 0x46, 
+	0x00, 0x40, 0x00, 0x81, 0x00, 0x04, 0x00, 0x5d, 0x80, 0x00, 0x01, 0x5b, 
+	0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x80, 0x58, 0x80, 0xc0, 0x00, 0x17, 
+	0x80, 0x00, 0x80, 0x86, 0x00, 0x41, 0x00, 0xc0, 0x00, 0x80, 0x00, 0x9d, 
+	0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x72, 0x6f, 0x6d, 
+	0x70, 0x74, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x4f, 0x70, 0x65, 0x6e, 0x3a, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5f, 0x62, 0x75, 0x66, 0x66, 
+	0x65, 0x72, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6f, 0x70, 0x65, 0x6e, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x0a, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x61, 0x6e, 0x63, 0x65, 0x6c, 
+	0x6c, 0x65, 0x64, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x64, 0x69, 0x72, 0x74, 0x79, 0x00, 0x04, 0x29, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 
+	0x73, 0x20, 0x64, 0x69, 0x72, 0x74, 0x79, 0x2e, 0x20, 0x20, 0x52, 0x65, 
+	0x61, 0x6c, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 
+	0x3f, 0x20, 0x28, 0x79, 0x2f, 0x6e, 0x29, 0x3f, 0x00, 0x01, 0x01, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x04, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x04, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x04, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x52, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x20, 
+	0x77, 0x69, 0x74, 0x68, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x3d, 
+	0x00, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x00, 0xa6, 
+	0x01, 0x00, 0x00, 0xa6, 0x01, 0x00, 0x00, 0xa6, 0x01, 0x00, 0x00, 0xa7, 
+	0x01, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0xa7, 
+	0x01, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0xa9, 
+	0x01, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, 0xa9, 
+	0x01, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0xab, 
+	0x01, 0x00, 0x00, 0xad, 0x01, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00, 0xb3, 
+	0x01, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00, 0xb3, 0x01, 0x00, 0x00, 0xb6, 
+	0x01, 0x00, 0x00, 0xb6, 0x01, 0x00, 0x00, 0xb6, 0x01, 0x00, 0x00, 0xb8, 
+	0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0xbb, 
+	0x01, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00, 0xbc, 
+	0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0xbc, 
+	0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0xbd, 
+	0x01, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0xbf, 
+	0x01, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0xbf, 
+	0x01, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0xc0, 
+	0x01, 0x00, 0x00, 0xc1, 0x01, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0xc9, 
+	0x01, 0x00, 0x00, 0xc9, 0x01, 0x00, 0x00, 0xc9, 0x01, 0x00, 0x00, 0xca, 
+	0x01, 0x00, 0x00, 0xca, 0x01, 0x00, 0x00, 0xca, 0x01, 0x00, 0x00, 0xca, 
+	0x01, 0x00, 0x00, 0xcb, 0x01, 0x00, 0x00, 0xcb, 0x01, 0x00, 0x00, 0xcb, 
+	0x01, 0x00, 0x00, 0xcd, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x09, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x65, 0x77, 0x5f, 0x62, 
+	0x75, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x61, 0x6d, 0x65, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x75, 0x6e, 0x00, 0x1b, 0x00, 0x00, 
+	0x00, 0x32, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x35, 0x00, 0x00, 0x00, 0x3d, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xda, 0x01, 0x00, 0x00, 0xdf, 
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x05, 0x0b, 0x00, 0x00, 0x00, 0x46, 0x00, 
+	0x40, 0x00, 0x47, 0x40, 0xc0, 0x00, 0x80, 0x00, 0x00, 0x00, 0x5d, 0x80, 
+	0x00, 0x01, 0x8c, 0x80, 0xc0, 0x00, 0x01, 0xc1, 0x00, 0x00, 0x9d, 0x80, 
+	0x80, 0x01, 0xcc, 0x00, 0xc1, 0x00, 0xdd, 0x40, 0x00, 0x01, 0x9f, 0x00, 
+	0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6f, 0x00, 0x04, 0x06, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x6f, 0x70, 0x65, 0x6e, 
+	0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 
+	0x61, 0x64, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x2a, 0x61, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x63, 0x6c, 0x6f, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00, 0xdb, 
+	0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00, 0xdc, 
+	0x01, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x00, 0xdd, 
+	0x01, 0x00, 0x00, 0xde, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 
+	0x6d, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x61, 0x6e, 0x64, 0x6c, 
+	0x65, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x00, 0x07, 0x00, 
+	0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xe4, 
+	0x01, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0xc0, 0x80, 0x00, 0x86, 0x40, 
+	0x40, 0x00, 0xc1, 0x80, 0x00, 0x00, 0x9d, 0x40, 0x00, 0x01, 0x86, 0x00, 
+	0x40, 0x00, 0x9d, 0xc0, 0x80, 0x00, 0x18, 0x00, 0x00, 0x01, 0x17, 0x80, 
+	0x00, 0x80, 0x18, 0x40, 0x80, 0x01, 0x17, 0x00, 0x00, 0x80, 0x1f, 0x00, 
+	0x80, 0x00, 0x06, 0xc1, 0x40, 0x00, 0x1d, 0x41, 0x80, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x69, 0x67, 0x68, 
+	0x74, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 
+	0x65, 0x6c, 0x65, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x0f, 
+	0x00, 0x00, 0x00, 0xe7, 0x01, 0x00, 0x00, 0xe7, 0x01, 0x00, 0x00, 0xea, 
+	0x01, 0x00, 0x00, 0xea, 0x01, 0x00, 0x00, 0xea, 0x01, 0x00, 0x00, 0xed, 
+	0x01, 0x00, 0x00, 0xed, 0x01, 0x00, 0x00, 0xf5, 0x01, 0x00, 0x00, 0xf5, 
+	0x01, 0x00, 0x00, 0xf5, 0x01, 0x00, 0x00, 0xf5, 0x01, 0x00, 0x00, 0xf6, 
+	0x01, 0x00, 0x00, 0xfb, 0x01, 0x00, 0x00, 0xfb, 0x01, 0x00, 0x00, 0xfc, 
+	0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x78, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6e, 0x78, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x79, 
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 
+	0x56, 0x00, 0x11, 0x02, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x05, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x40, 0x80, 
+	0x00, 0x06, 0x40, 0x40, 0x00, 0x1d, 0xc0, 0x80, 0x00, 0x86, 0x80, 0x40, 
+	0x00, 0x9d, 0x40, 0x80, 0x00, 0x08, 0x00, 0xc1, 0x81, 0x80, 0x00, 0x00, 
+	0x00, 0x19, 0x80, 0x80, 0x82, 0x17, 0x00, 0x02, 0x80, 0xc6, 0xc0, 0x40, 
+	0x00, 0x06, 0x81, 0x41, 0x00, 0x1d, 0x81, 0x80, 0x00, 0xd6, 0x00, 0x81, 
+	0x01, 0x08, 0xc0, 0x80, 0x81, 0xc6, 0xc0, 0x41, 0x00, 0xdd, 0x40, 0x80, 
+	0x00, 0x8e, 0x00, 0x42, 0x01, 0x17, 0x00, 0xfd, 0x7f, 0xc6, 0xc0, 0x40, 
+	0x00, 0x01, 0x41, 0x02, 0x00, 0xd6, 0x00, 0x81, 0x01, 0x08, 0xc0, 0x80, 
+	0x81, 0x1f, 0x00, 0x80, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6f, 0x6c, 0x00, 0x04, 0x06, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x6f, 0x69, 0x6e, 0x74, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x6f, 
+	0x6c, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
+	0x61, 0x73, 0x74, 0x65, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 
+	0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x61, 0x74, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x5f, 0x66, 
+	0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x73, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 
+	0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x18, 0x00, 0x00, 
+	0x00, 0x14, 0x02, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00, 0x15, 0x02, 0x00, 
+	0x00, 0x15, 0x02, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x16, 0x02, 0x00, 
+	0x00, 0x18, 0x02, 0x00, 0x00, 0x1b, 0x02, 0x00, 0x00, 0x1e, 0x02, 0x00, 
+	0x00, 0x1e, 0x02, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x21, 0x02, 0x00, 
+	0x00, 0x21, 0x02, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x21, 0x02, 0x00, 
+	0x00, 0x24, 0x02, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x27, 0x02, 0x00, 
+	0x00, 0x27, 0x02, 0x00, 0x00, 0x29, 0x02, 0x00, 0x00, 0x29, 0x02, 0x00, 
+	0x00, 0x29, 0x02, 0x00, 0x00, 0x29, 0x02, 0x00, 0x00, 0x2a, 0x02, 0x00, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x78, 0x00, 0x04, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x32, 0x02, 0x00, 0x00, 
+	0x34, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x06, 
+	0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x1f, 
+	0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x00, 0x04, 
+	0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x73, 0x74, 
+	0x65, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x04, 0x00, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0x33, 0x02, 
+	0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0x34, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x3a, 0x02, 0x00, 0x00, 0x46, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x1d, 0xc0, 0x80, 0x00, 0x18, 0x40, 0x40, 0x00, 0x17, 0xc0, 
+	0x03, 0x80, 0x18, 0x40, 0xc0, 0x00, 0x17, 0x40, 0x03, 0x80, 0x86, 0x80, 
+	0x40, 0x00, 0x9d, 0xc0, 0x80, 0x00, 0x06, 0x01, 0x40, 0x00, 0x40, 0x01, 
+	0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x1d, 0x41, 0x80, 0x01, 0x06, 0xc1, 
+	0x40, 0x00, 0x41, 0x01, 0x01, 0x00, 0x80, 0x01, 0x00, 0x01, 0xc1, 0x41, 
+	0x01, 0x00, 0x00, 0x02, 0x80, 0x01, 0x56, 0x01, 0x82, 0x02, 0x1d, 0x41, 
+	0x00, 0x01, 0x17, 0x80, 0x01, 0x80, 0x86, 0x00, 0x40, 0x00, 0xc1, 0x40, 
+	0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x9d, 0x40, 0x80, 0x01, 0x86, 0xc0, 
+	0x40, 0x00, 0xc1, 0x80, 0x01, 0x00, 0x9d, 0x40, 0x00, 0x01, 0x1f, 0x00, 
+	0x80, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0xf0, 0xbf, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 
+	0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x65, 0x74, 
+	0x20, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x74, 0x6f, 0x20, 0x00, 0x04, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x04, 0x0d, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x6c, 0x65, 0x61, 0x72, 0x65, 
+	0x64, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x1c, 0x00, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 
+	0x3c, 0x02, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, 
+	0x3c, 0x02, 0x00, 0x00, 0x3e, 0x02, 0x00, 0x00, 0x3e, 0x02, 0x00, 0x00, 
+	0x3f, 0x02, 0x00, 0x00, 0x3f, 0x02, 0x00, 0x00, 0x3f, 0x02, 0x00, 0x00, 
+	0x3f, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 
+	0x40, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 
+	0x40, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 
+	0x43, 0x02, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 
+	0x43, 0x02, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 
+	0x44, 0x02, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x78, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6d, 0x79, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 
+	0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x55, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x1d, 0xc0, 0x80, 0x00, 0x18, 0x40, 0x40, 0x00, 0x17, 0x40, 
+	0x01, 0x80, 0x18, 0x40, 0xc0, 0x00, 0x17, 0xc0, 0x00, 0x80, 0x86, 0x80, 
+	0x40, 0x00, 0xc1, 0xc0, 0x00, 0x00, 0x9d, 0x40, 0x00, 0x01, 0x1f, 0x00, 
+	0x80, 0x00, 0x86, 0x40, 0x41, 0x00, 0x9d, 0x80, 0x80, 0x00, 0x08, 0x80, 
+	0x00, 0x82, 0x86, 0x00, 0x40, 0x00, 0xc1, 0x40, 0x00, 0x00, 0x01, 0x41, 
+	0x00, 0x00, 0x9d, 0x40, 0x80, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x06, 0x00, 
+	0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 
+	0x61, 0x72, 0x6b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 
+	0xbf, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 
+	0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x4e, 0x6f, 0x20, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x21, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x70, 0x61, 0x73, 0x74, 0x65, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 
+	0x72, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 
+	0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x12, 0x00, 0x00, 0x00, 0x4d, 0x02, 0x00, 0x00, 0x4d, 0x02, 
+	0x00, 0x00, 0x4e, 0x02, 0x00, 0x00, 0x4e, 0x02, 0x00, 0x00, 0x4e, 0x02, 
+	0x00, 0x00, 0x4e, 0x02, 0x00, 0x00, 0x4f, 0x02, 0x00, 0x00, 0x4f, 0x02, 
+	0x00, 0x00, 0x4f, 0x02, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x53, 0x02, 
+	0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0x54, 0x02, 
+	0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x54, 0x02, 
+	0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x78, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6d, 0x79, 0x00, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5f, 0x45, 0x4e, 0x56, 0x00, 0x5b, 0x02, 0x00, 0x00, 0x77, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x07, 0x2e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 
+	0x1d, 0xc0, 0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0x9d, 0xc0, 0x80, 0x00, 
+	0x18, 0x80, 0x40, 0x00, 0x17, 0x40, 0x01, 0x80, 0x18, 0x80, 0xc0, 0x00, 
+	0x17, 0xc0, 0x00, 0x80, 0x06, 0xc1, 0x40, 0x00, 0x41, 0x01, 0x01, 0x00, 
+	0x1d, 0x41, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x06, 0x81, 0x41, 0x00, 
+	0x1d, 0x81, 0x80, 0x00, 0x08, 0x00, 0x81, 0x82, 0x59, 0xc0, 0x80, 0x00, 
+	0x17, 0x00, 0x02, 0x80, 0x19, 0x80, 0x00, 0x00, 0x17, 0x80, 0x00, 0x80, 
+	0x18, 0x40, 0x80, 0x01, 0x17, 0x00, 0x00, 0x80, 0x17, 0xc0, 0x00, 0x80, 
+	0x06, 0x41, 0x40, 0x00, 0x40, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80, 0x00, 
+	0x1d, 0x41, 0x80, 0x01, 0x06, 0xc1, 0x41, 0x00, 0x41, 0x01, 0x02, 0x00, 
+	0x1d, 0x41, 0x00, 0x01, 0x06, 0x41, 0x41, 0x00, 0x15, 0x01, 0x00, 0x02, 
+	0x08, 0x00, 0x81, 0x84, 0x06, 0x41, 0x42, 0x00, 0x19, 0x00, 0x01, 0x85, 
+	0x17, 0x40, 0x01, 0x80, 0x06, 0xc1, 0x42, 0x00, 0x1d, 0x41, 0x80, 0x00, 
+	0x06, 0x41, 0x42, 0x00, 0x0e, 0x01, 0x43, 0x02, 0x08, 0x00, 0x81, 0x84, 
+	0x17, 0x80, 0xfd, 0x7f, 0x06, 0x01, 0x40, 0x00, 0x41, 0x81, 0x00, 0x00, 
+	0x81, 0x81, 0x00, 0x00, 0x1d, 0x41, 0x80, 0x01, 0x1f, 0x00, 0x80, 0x00, 
+	0x0d, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x0e, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x6f, 0x20, 0x73, 0x65, 
+	0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x21, 0x00, 0x04, 0x0d, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x73, 0x74, 0x65, 0x5f, 
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 
+	0x6f, 0x76, 0x65, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x2e, 
+	0x00, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x00, 0x5c, 0x02, 0x00, 0x00, 0x5d, 
+	0x02, 0x00, 0x00, 0x5d, 0x02, 0x00, 0x00, 0x5e, 0x02, 0x00, 0x00, 0x5e, 
+	0x02, 0x00, 0x00, 0x5e, 0x02, 0x00, 0x00, 0x5e, 0x02, 0x00, 0x00, 0x5f, 
+	0x02, 0x00, 0x00, 0x5f, 0x02, 0x00, 0x00, 0x5f, 0x02, 0x00, 0x00, 0x60, 
+	0x02, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x64, 
+	0x02, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x67, 
+	0x02, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x67, 
+	0x02, 0x00, 0x00, 0x67, 0x02, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x6a, 
+	0x02, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x6c, 
+	0x02, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x6f, 
+	0x02, 0x00, 0x00, 0x6f, 0x02, 0x00, 0x00, 0x6f, 0x02, 0x00, 0x00, 0x70, 
+	0x02, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0x70, 0x02, 0x00, 0x00, 0x71, 
+	0x02, 0x00, 0x00, 0x71, 0x02, 0x00, 0x00, 0x72, 0x02, 0x00, 0x00, 0x72, 
+	0x02, 0x00, 0x00, 0x72, 0x02, 0x00, 0x00, 0x72, 0x02, 0x00, 0x00, 0x76, 
+	0x02, 0x00, 0x00, 0x76, 0x02, 0x00, 0x00, 0x76, 0x02, 0x00, 0x00, 0x76, 
+	0x02, 0x00, 0x00, 0x77, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x78, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6d, 0x79, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x78, 0x00, 
+	0x04, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x79, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x8c, 0x02, 0x00, 0x00, 
+	0x95, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x12, 0x00, 0x00, 0x00, 0x06, 
+	0x00, 0x40, 0x00, 0x41, 0x40, 0x00, 0x00, 0x1d, 0x80, 0x00, 0x01, 0x46, 
+	0x80, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 0x5d, 0x80, 0x00, 0x01, 0x18, 
+	0xc0, 0xc0, 0x00, 0x17, 0xc0, 0x00, 0x80, 0x46, 0x00, 0x41, 0x00, 0x81, 
+	0x40, 0x01, 0x00, 0x5d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x46, 
+	0x80, 0x41, 0x00, 0x86, 0x80, 0x40, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x9d, 
+	0x00, 0x00, 0x01, 0x5d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x07, 
+	0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x00, 0x04, 0x2f, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x52, 0x65, 0x70, 0x6c, 0x61, 0x79, 0x20, 0x6d, 
+	0x61, 0x63, 0x72, 0x6f, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x6d, 0x61, 0x6e, 
+	0x79, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x28, 0x30, 0x20, 0x3d, 
+	0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6e, 0x64, 0x29, 
+	0x3f, 0x20, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x74, 0x6f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 
+	0x73, 0x00, 0x04, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 
+	0x6f, 0x75, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x65, 0x6e, 0x74, 0x65, 
+	0x72, 0x20, 0x61, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x21, 0x00, 
+	0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x63, 
+	0x72, 0x6f, 0x5f, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x79, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x12, 0x00, 0x00, 0x00, 0x8d, 0x02, 0x00, 0x00, 0x8d, 
+	0x02, 0x00, 0x00, 0x8d, 0x02, 0x00, 0x00, 0x8f, 0x02, 0x00, 0x00, 0x8f, 
+	0x02, 0x00, 0x00, 0x8f, 0x02, 0x00, 0x00, 0x8f, 0x02, 0x00, 0x00, 0x8f, 
+	0x02, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x90, 
+	0x02, 0x00, 0x00, 0x91, 0x02, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0x94, 
+	0x02, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0x94, 
+	0x02, 0x00, 0x00, 0x95, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x75, 0x6e, 0x74, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 
+	0x56, 0x00, 0xa5, 0x02, 0x00, 0x00, 0xb1, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x07, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0xc0, 0x80, 
+	0x00, 0x86, 0x00, 0x40, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x0d, 0x41, 0xc0, 
+	0x00, 0x9d, 0x40, 0x80, 0x01, 0x86, 0x00, 0x40, 0x00, 0x9d, 0xc0, 0x80, 
+	0x00, 0x18, 0x40, 0x80, 0x01, 0x17, 0xc0, 0x00, 0x80, 0x06, 0x81, 0x40, 
+	0x00, 0x41, 0xc1, 0x00, 0x00, 0x1d, 0x41, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x06, 0x01, 0x41, 0x00, 0x40, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80, 
+	0x00, 0x1d, 0x41, 0x80, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x6f, 
+	0x69, 0x6e, 0x74, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 
+	0x3f, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 
+	0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x4e, 0x6f, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x6c, 0x69, 
+	0x6e, 0x65, 0x73, 0x21, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x61, 0x64, 0x64, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 
+	0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x13, 0x00, 0x00, 0x00, 0xa6, 0x02, 
+	0x00, 0x00, 0xa6, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xa8, 0x02, 
+	0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xaa, 0x02, 
+	0x00, 0x00, 0xaa, 0x02, 0x00, 0x00, 0xab, 0x02, 0x00, 0x00, 0xab, 0x02, 
+	0x00, 0x00, 0xac, 0x02, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00, 0xac, 0x02, 
+	0x00, 0x00, 0xad, 0x02, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0xb0, 0x02, 
+	0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0xb1, 0x02, 
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x78, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6e, 0x78, 0x00, 0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x79, 0x00, 
+	0x08, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 
+	0x00, 0xba, 0x02, 0x00, 0x00, 0xe3, 0x02, 0x00, 0x00, 0x01, 0x00, 0x09, 
+	0x57, 0x00, 0x00, 0x00, 0x18, 0x00, 0x40, 0x00, 0x17, 0xc0, 0x00, 0x80, 
+	0x46, 0x40, 0x40, 0x00, 0x81, 0x80, 0x00, 0x00, 0x5d, 0x80, 0x00, 0x01, 
+	0x00, 0x00, 0x80, 0x00, 0x58, 0x00, 0x40, 0x00, 0x17, 0x40, 0x00, 0x80, 
+	0x18, 0xc0, 0x40, 0x00, 0x17, 0xc0, 0x00, 0x80, 0x46, 0x00, 0x41, 0x00, 
+	0x81, 0x40, 0x01, 0x00, 0x5d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 
+	0x46, 0x80, 0x41, 0x00, 0x5d, 0x40, 0x80, 0x00, 0x46, 0xc0, 0x41, 0x00, 
+	0x5d, 0x40, 0x80, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x86, 0x00, 0x42, 0x00, 
+	0xc0, 0x00, 0x00, 0x00, 0x9d, 0x80, 0x00, 0x01, 0x9b, 0x00, 0x00, 0x00, 
+	0x17, 0x80, 0x08, 0x80, 0x86, 0x40, 0x42, 0x00, 0x9d, 0xc0, 0x80, 0x00, 
+	0x15, 0x01, 0x80, 0x00, 0x19, 0x00, 0x01, 0x85, 0x17, 0x40, 0x04, 0x80, 
+	0x07, 0xc1, 0xc2, 0x00, 0x07, 0xc1, 0x42, 0x02, 0x18, 0x80, 0x00, 0x02, 
+	0x17, 0xc0, 0x00, 0x80, 0x07, 0xc1, 0xc2, 0x00, 0x07, 0x01, 0x43, 0x02, 
+	0x58, 0xc0, 0x00, 0x02, 0x17, 0x40, 0x05, 0x80, 0x15, 0x01, 0x80, 0x00, 
+	0x07, 0x01, 0x81, 0x00, 0x07, 0xc1, 0x42, 0x02, 0x18, 0x80, 0x00, 0x02, 
+	0x17, 0x00, 0x01, 0x80, 0x15, 0x01, 0x80, 0x00, 0x07, 0x01, 0x81, 0x00, 
+	0x07, 0x01, 0x43, 0x02, 0x58, 0xc0, 0x00, 0x02, 0x17, 0xc0, 0x02, 0x80, 
+	0x06, 0x41, 0x43, 0x00, 0x07, 0x81, 0x43, 0x02, 0x40, 0x01, 0x80, 0x00, 
+	0x8b, 0x01, 0x00, 0x01, 0xc0, 0x01, 0x00, 0x01, 0x00, 0x02, 0x80, 0x01, 
+	0xa4, 0x41, 0x00, 0x01, 0x1d, 0x41, 0x80, 0x01, 0x06, 0xc1, 0x43, 0x00, 
+	0x41, 0x01, 0x04, 0x00, 0x1d, 0x41, 0x00, 0x01, 0x17, 0xc0, 0xf5, 0x7f, 
+	0x95, 0x00, 0x80, 0x00, 0x18, 0x80, 0x42, 0x01, 0x17, 0x00, 0x00, 0x80, 
+	0x1f, 0x00, 0x80, 0x00, 0x86, 0x40, 0x42, 0x00, 0xc7, 0xc0, 0xc2, 0x00, 
+	0xc7, 0xc0, 0xc2, 0x01, 0x07, 0xc1, 0xc2, 0x00, 0x07, 0x01, 0x43, 0x02, 
+	0x9d, 0x40, 0x80, 0x01, 0x81, 0x00, 0x03, 0x00, 0xd5, 0x00, 0x80, 0x00, 
+	0x01, 0xc1, 0x02, 0x00, 0xa1, 0x40, 0x01, 0x80, 0x86, 0x41, 0x44, 0x00, 
+	0xc7, 0x41, 0x81, 0x00, 0xc7, 0xc1, 0xc2, 0x03, 0x07, 0x42, 0x81, 0x00, 
+	0x07, 0x02, 0x43, 0x04, 0x9d, 0x41, 0x80, 0x01, 0xa0, 0x00, 0xfe, 0x7f, 
+	0x86, 0x00, 0x41, 0x00, 0xc1, 0x80, 0x04, 0x00, 0x15, 0x01, 0x80, 0x00, 
+	0x41, 0xc1, 0x04, 0x00, 0xd6, 0x40, 0x81, 0x01, 0x9d, 0x40, 0x00, 0x01, 
+	0x1f, 0x00, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 
+	0x00, 0x04, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x72, 
+	0x65, 0x67, 0x65, 0x78, 0x70, 0x29, 0x20, 0x41, 0x64, 0x64, 0x20, 0x63, 
+	0x75, 0x72, 0x73, 0x6f, 0x72, 0x73, 0x20, 0x61, 0x74, 0x3f, 0x20, 0x00, 
+	0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 
+	0x73, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 
+	0x61, 0x6e, 0x63, 0x65, 0x6c, 0x6c, 0x65, 0x64, 0x00, 0x04, 0x0e, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x5f, 
+	0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x73, 0x00, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x6f, 0x66, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 
+	0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x6f, 
+	0x69, 0x6e, 0x74, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x06, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 
+	0x74, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 
+	0x6f, 0x76, 0x65, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x72, 0x69, 0x67, 0x68, 0x74, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x5f, 0x63, 0x75, 0x72, 0x73, 
+	0x6f, 0x72, 0x00, 0x04, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x41, 0x64, 0x64, 0x65, 0x64, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 
+	0x73, 0x20, 0x61, 0x74, 0x20, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x20, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 
+	0x2e, 0x6c, 0x75, 0x61, 0x00, 0x57, 0x00, 0x00, 0x00, 0xbb, 0x02, 0x00, 
+	0x00, 0xbb, 0x02, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00, 0xbc, 0x02, 0x00, 
+	0x00, 0xbc, 0x02, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00, 0xbf, 0x02, 0x00, 
+	0x00, 0xbf, 0x02, 0x00, 0x00, 0xbf, 0x02, 0x00, 0x00, 0xbf, 0x02, 0x00, 
+	0x00, 0xc0, 0x02, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0xc0, 0x02, 0x00, 
+	0x00, 0xc1, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 
+	0x00, 0xc5, 0x02, 0x00, 0x00, 0xc5, 0x02, 0x00, 0x00, 0xca, 0x02, 0x00, 
+	0x00, 0xcc, 0x02, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00, 0xcc, 0x02, 0x00, 
+	0x00, 0xcc, 0x02, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00, 0xcd, 0x02, 0x00, 
+	0x00, 0xcd, 0x02, 0x00, 0x00, 0xcf, 0x02, 0x00, 0x00, 0xcf, 0x02, 0x00, 
+	0x00, 0xcf, 0x02, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, 0xd0, 0x02, 0x00, 
+	0x00, 0xd0, 0x02, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, 0xd0, 0x02, 0x00, 
+	0x00, 0xd0, 0x02, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, 0xd0, 0x02, 0x00, 
+	0x00, 0xd1, 0x02, 0x00, 0x00, 0xd1, 0x02, 0x00, 0x00, 0xd1, 0x02, 0x00, 
+	0x00, 0xd1, 0x02, 0x00, 0x00, 0xd1, 0x02, 0x00, 0x00, 0xd1, 0x02, 0x00, 
+	0x00, 0xd1, 0x02, 0x00, 0x00, 0xd1, 0x02, 0x00, 0x00, 0xd1, 0x02, 0x00, 
+	0x00, 0xd1, 0x02, 0x00, 0x00, 0xd4, 0x02, 0x00, 0x00, 0xd4, 0x02, 0x00, 
+	0x00, 0xd4, 0x02, 0x00, 0x00, 0xd4, 0x02, 0x00, 0x00, 0xd4, 0x02, 0x00, 
+	0x00, 0xd4, 0x02, 0x00, 0x00, 0xd4, 0x02, 0x00, 0x00, 0xd4, 0x02, 0x00, 
+	0x00, 0xd5, 0x02, 0x00, 0x00, 0xd5, 0x02, 0x00, 0x00, 0xd5, 0x02, 0x00, 
+	0x00, 0xd5, 0x02, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0xd8, 0x02, 0x00, 
+	0x00, 0xd8, 0x02, 0x00, 0x00, 0xd9, 0x02, 0x00, 0x00, 0xdc, 0x02, 0x00, 
+	0x00, 0xdc, 0x02, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, 0xdc, 0x02, 0x00, 
+	0x00, 0xdc, 0x02, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, 0xde, 0x02, 0x00, 
+	0x00, 0xde, 0x02, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00, 0xde, 0x02, 0x00, 
+	0x00, 0xdf, 0x02, 0x00, 0x00, 0xdf, 0x02, 0x00, 0x00, 0xdf, 0x02, 0x00, 
+	0x00, 0xdf, 0x02, 0x00, 0x00, 0xdf, 0x02, 0x00, 0x00, 0xdf, 0x02, 0x00, 
+	0x00, 0xde, 0x02, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x00, 0xe2, 0x02, 0x00, 
+	0x00, 0xe2, 0x02, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x00, 0xe2, 0x02, 0x00, 
+	0x00, 0xe2, 0x02, 0x00, 0x00, 0xe3, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x65, 0x72, 
+	0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x00, 
+	0x13, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x3a, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 
+	0x1a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x6e, 0x64, 
+	0x65, 0x78, 0x29, 0x00, 0x48, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 
+	0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x29, 0x00, 0x48, 0x00, 0x00, 0x00, 
+	0x50, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x65, 0x70, 0x29, 0x00, 0x48, 
+	0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x69, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xf1, 0x02, 0x00, 0x00, 0x06, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x1d, 0x80, 0x80, 0x00, 0x1b, 0x40, 0x00, 0x00, 0x17, 0x80, 0x00, 
+	0x80, 0x06, 0x40, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 
+	0x00, 0x06, 0x80, 0x40, 0x00, 0x41, 0xc0, 0x00, 0x00, 0x1d, 0x40, 0x00, 
+	0x01, 0x06, 0x40, 0x41, 0x00, 0x1d, 0x80, 0x80, 0x00, 0x08, 0x00, 0x00, 
+	0x82, 0x06, 0x00, 0x41, 0x00, 0x58, 0x80, 0x41, 0x00, 0x17, 0x80, 0x00, 
+	0x80, 0x06, 0x00, 0x41, 0x00, 0x18, 0xc0, 0x41, 0x00, 0x17, 0x40, 0x01, 
+	0x80, 0x06, 0x40, 0x40, 0x00, 0x1d, 0x40, 0x80, 0x00, 0x06, 0x80, 0x40, 
+	0x00, 0x41, 0x00, 0x02, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x06, 0x00, 0x41, 0x00, 0x58, 0x40, 0x42, 0x00, 0x17, 0x80, 0x00, 
+	0x80, 0x06, 0x00, 0x41, 0x00, 0x18, 0x80, 0x42, 0x00, 0x17, 0x80, 0xfa, 
+	0x7f, 0x06, 0x80, 0x40, 0x00, 0x41, 0xc0, 0x02, 0x00, 0x1d, 0x40, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x17, 0x40, 0xf9, 0x7f, 0x1f, 0x00, 0x80, 
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x64, 0x69, 0x72, 0x74, 0x79, 0x00, 0x04, 0x0c, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x62, 0x75, 
+	0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x25, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 
+	0x20, 0x69, 0x73, 0x20, 0x64, 0x69, 0x72, 0x74, 0x79, 0x2e, 0x20, 0x20, 
+	0x52, 0x65, 0x61, 0x6c, 0x6c, 0x79, 0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x20, 
+	0x28, 0x79, 0x2f, 0x6e, 0x29, 0x3f, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x59, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x4b, 0x69, 0x6c, 0x6c, 0x65, 0x64, 0x00, 0x04, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x43, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x6c, 0x65, 
+	0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 
+	0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x25, 0x00, 0x00, 0x00, 0xf2, 
+	0x02, 0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0xf2, 
+	0x02, 0x00, 0x00, 0xf3, 0x02, 0x00, 0x00, 0xf3, 0x02, 0x00, 0x00, 0xf4, 
+	0x02, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, 0xf8, 
+	0x02, 0x00, 0x00, 0xfb, 0x02, 0x00, 0x00, 0xfb, 0x02, 0x00, 0x00, 0xfb, 
+	0x02, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x00, 0xfc, 
+	0x02, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x00, 0xfc, 
+	0x02, 0x00, 0x00, 0xfd, 0x02, 0x00, 0x00, 0xfd, 0x02, 0x00, 0x00, 0xfe, 
+	0x02, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00, 0xff, 
+	0x02, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 
+	0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x01, 
+	0x03, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x02, 
+	0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x06, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x11, 0x03, 0x00, 0x00, 0x39, 0x03, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2e, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x46, 0x40, 0x40, 0x00, 0x86, 
+	0x80, 0x40, 0x00, 0x9d, 0x00, 0x80, 0x00, 0x5d, 0x00, 0x01, 0x00, 0x17, 
+	0xc0, 0x01, 0x80, 0x86, 0xc1, 0x40, 0x00, 0xce, 0x01, 0x41, 0x02, 0x9d, 
+	0x81, 0x00, 0x01, 0x8c, 0x41, 0x41, 0x03, 0x9d, 0x81, 0x00, 0x01, 0x9b, 
+	0x01, 0x00, 0x00, 0x17, 0x00, 0x00, 0x80, 0x0d, 0x00, 0x41, 0x00, 0x62, 
+	0x80, 0x00, 0x00, 0xe3, 0x40, 0xfd, 0x7f, 0x19, 0x00, 0x00, 0x80, 0x17, 
+	0x00, 0x06, 0x80, 0x46, 0x80, 0x41, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc1, 
+	0xc0, 0x01, 0x00, 0x06, 0x81, 0x40, 0x00, 0x1d, 0x81, 0x80, 0x00, 0x15, 
+	0x01, 0x00, 0x02, 0x41, 0x01, 0x02, 0x00, 0x96, 0x40, 0x01, 0x01, 0x5d, 
+	0x40, 0x00, 0x01, 0x46, 0x80, 0x42, 0x00, 0x5d, 0x80, 0x80, 0x00, 0x08, 
+	0x40, 0x80, 0x84, 0x46, 0x40, 0x42, 0x00, 0x58, 0xc0, 0xc2, 0x00, 0x17, 
+	0x80, 0x00, 0x80, 0x46, 0x40, 0x42, 0x00, 0x18, 0x00, 0xc3, 0x00, 0x17, 
+	0x80, 0x00, 0x80, 0x46, 0x40, 0x43, 0x00, 0x5d, 0x40, 0x80, 0x00, 0x17, 
+	0x40, 0x01, 0x80, 0x46, 0x80, 0x41, 0x00, 0x81, 0x80, 0x03, 0x00, 0x5d, 
+	0x40, 0x00, 0x01, 0x17, 0x40, 0x00, 0x80, 0x46, 0x40, 0x43, 0x00, 0x5d, 
+	0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x00, 
+	0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 0x66, 
+	0x66, 0x65, 0x72, 0x73, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x67, 0x65, 0x74, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 0x06, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x69, 0x72, 0x74, 0x79, 
+	0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 
+	0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x2f, 0x00, 0x04, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 
+	0x65, 0x20, 0x64, 0x69, 0x72, 0x74, 0x79, 0x2e, 0x20, 0x20, 0x52, 0x65, 
+	0x61, 0x6c, 0x6c, 0x79, 0x20, 0x71, 0x75, 0x69, 0x74, 0x3f, 0x20, 0x20, 
+	0x28, 0x79, 0x2f, 0x6e, 0x29, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6b, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6b, 0x65, 0x79, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x79, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x59, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x65, 0x78, 0x69, 0x74, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x43, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x6c, 0x65, 0x64, 
+	0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 
+	0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x15, 
+	0x03, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x00, 0x1a, 
+	0x03, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x00, 0x1e, 
+	0x03, 0x00, 0x00, 0x1e, 0x03, 0x00, 0x00, 0x1e, 0x03, 0x00, 0x00, 0x1e, 
+	0x03, 0x00, 0x00, 0x1e, 0x03, 0x00, 0x00, 0x1e, 0x03, 0x00, 0x00, 0x1e, 
+	0x03, 0x00, 0x00, 0x1f, 0x03, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x00, 0x1a, 
+	0x03, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2b, 
+	0x03, 0x00, 0x00, 0x2b, 0x03, 0x00, 0x00, 0x2b, 0x03, 0x00, 0x00, 0x2b, 
+	0x03, 0x00, 0x00, 0x2b, 0x03, 0x00, 0x00, 0x2b, 0x03, 0x00, 0x00, 0x2b, 
+	0x03, 0x00, 0x00, 0x2b, 0x03, 0x00, 0x00, 0x2b, 0x03, 0x00, 0x00, 0x30, 
+	0x03, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x31, 
+	0x03, 0x00, 0x00, 0x31, 0x03, 0x00, 0x00, 0x31, 0x03, 0x00, 0x00, 0x31, 
+	0x03, 0x00, 0x00, 0x31, 0x03, 0x00, 0x00, 0x31, 0x03, 0x00, 0x00, 0x32, 
+	0x03, 0x00, 0x00, 0x32, 0x03, 0x00, 0x00, 0x32, 0x03, 0x00, 0x00, 0x34, 
+	0x03, 0x00, 0x00, 0x34, 0x03, 0x00, 0x00, 0x34, 0x03, 0x00, 0x00, 0x35, 
+	0x03, 0x00, 0x00, 0x37, 0x03, 0x00, 0x00, 0x37, 0x03, 0x00, 0x00, 0x39, 
+	0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x64, 0x69, 0x72, 0x74, 0x79, 0x5f, 0x63, 0x6f, 0x75, 
+	0x6e, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x10, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 
+	0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 
+	0x65, 0x29, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0e, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 
+	0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 
+	0x61, 0x6d, 0x65, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5f, 0x45, 0x4e, 0x56, 0x00, 0x40, 0x03, 0x00, 0x00, 0x4a, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x05, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 
+	0x41, 0x40, 0x00, 0x00, 0x1d, 0x80, 0x00, 0x01, 0x1b, 0x00, 0x00, 0x00, 
+	0x17, 0x40, 0x02, 0x80, 0x46, 0x80, 0x40, 0x00, 0x80, 0x00, 0x00, 0x00, 
+	0x5d, 0x80, 0x00, 0x01, 0x5d, 0xc0, 0x80, 0x00, 0x5b, 0x00, 0x00, 0x00, 
+	0x17, 0x80, 0x01, 0x80, 0xc6, 0xc0, 0x40, 0x00, 0x00, 0x01, 0x00, 0x01, 
+	0xdd, 0x40, 0x00, 0x01, 0x17, 0x80, 0x00, 0x80, 0x46, 0xc0, 0x40, 0x00, 
+	0x81, 0x00, 0x01, 0x00, 0x5d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x00, 0x04, 0x06, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x76, 0x61, 0x6c, 0x3a, 0x00, 0x04, 
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x61, 0x64, 
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 
+	0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x76, 0x61, 0x6c, 
+	0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x61, 0x6e, 0x63, 0x65, 
+	0x6c, 0x6c, 0x65, 0x64, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x13, 
+	0x00, 0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0x41, 
+	0x03, 0x00, 0x00, 0x42, 0x03, 0x00, 0x00, 0x42, 0x03, 0x00, 0x00, 0x43, 
+	0x03, 0x00, 0x00, 0x43, 0x03, 0x00, 0x00, 0x43, 0x03, 0x00, 0x00, 0x43, 
+	0x03, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0x45, 
+	0x03, 0x00, 0x00, 0x45, 0x03, 0x00, 0x00, 0x45, 0x03, 0x00, 0x00, 0x46, 
+	0x03, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0x48, 
+	0x03, 0x00, 0x00, 0x4a, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x78, 0x74, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x65, 0x72, 0x72, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0e, 
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 
+	0x65, 0x73, 0x75, 0x6c, 0x74, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0e, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x51, 0x03, 0x00, 0x00, 0x5f, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x07, 0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x41, 0x40, 0x00, 0x00, 0x1d, 0x80, 0x00, 0x01, 0x58, 0x80, 
+	0x40, 0x00, 0x17, 0x40, 0x00, 0x80, 0x18, 0xc0, 0x40, 0x00, 0x17, 0xc0, 
+	0x00, 0x80, 0x46, 0x00, 0x41, 0x00, 0x81, 0x40, 0x01, 0x00, 0x5d, 0x40, 
+	0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x46, 0x80, 0x41, 0x00, 0x47, 0xc0, 
+	0xc1, 0x00, 0x80, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x01, 0x01, 0x17, 0x40, 
+	0x01, 0x80, 0x46, 0x01, 0x42, 0x00, 0x80, 0x01, 0x00, 0x02, 0x5d, 0x41, 
+	0x00, 0x01, 0x46, 0x01, 0x42, 0x00, 0x81, 0x41, 0x02, 0x00, 0x5d, 0x41, 
+	0x00, 0x01, 0x62, 0x40, 0x00, 0x00, 0xe3, 0xc0, 0xfd, 0x7f, 0x1f, 0x00, 
+	0x80, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x00, 0x04, 0x09, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x73, 0x65, 0x72, 
+	0x74, 0x3f, 0x20, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x43, 0x61, 0x6e, 0x63, 0x65, 0x6c, 0x6c, 0x65, 
+	0x64, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 
+	0x6f, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 
+	0x69, 0x6e, 0x65, 0x73, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x00, 0x04, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x19, 0x00, 0x00, 0x00, 0x53, 0x03, 0x00, 0x00, 0x53, 0x03, 0x00, 
+	0x00, 0x53, 0x03, 0x00, 0x00, 0x55, 0x03, 0x00, 0x00, 0x55, 0x03, 0x00, 
+	0x00, 0x55, 0x03, 0x00, 0x00, 0x55, 0x03, 0x00, 0x00, 0x56, 0x03, 0x00, 
+	0x00, 0x56, 0x03, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x57, 0x03, 0x00, 
+	0x00, 0x5b, 0x03, 0x00, 0x00, 0x5b, 0x03, 0x00, 0x00, 0x5b, 0x03, 0x00, 
+	0x00, 0x5b, 0x03, 0x00, 0x00, 0x5b, 0x03, 0x00, 0x00, 0x5c, 0x03, 0x00, 
+	0x00, 0x5c, 0x03, 0x00, 0x00, 0x5c, 0x03, 0x00, 0x00, 0x5d, 0x03, 0x00, 
+	0x00, 0x5d, 0x03, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x5b, 0x03, 0x00, 
+	0x00, 0x5b, 0x03, 0x00, 0x00, 0x5f, 0x03, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x69, 0x6c, 
+	0x65, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x67, 
+	0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x0f, 0x00, 
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 
+	0x29, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0e, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 
+	0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x0f, 0x00, 0x00, 0x00, 
+	0x18, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6c, 0x69, 0x6e, 0x65, 0x00, 0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x6e, 0x03, 0x00, 0x00, 0xa3, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x40, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x1d, 0x80, 0x80, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x86, 0x40, 0x40, 
+	0x00, 0xc6, 0x80, 0x40, 0x00, 0xdd, 0x00, 0x80, 0x00, 0x9d, 0x00, 0x01, 
+	0x00, 0x17, 0x00, 0x0a, 0x80, 0xc6, 0x01, 0x40, 0x00, 0x0e, 0xc2, 0xc0, 
+	0x02, 0xdd, 0x41, 0x00, 0x01, 0xc6, 0x01, 0x41, 0x00, 0xdd, 0x81, 0x80, 
+	0x00, 0x06, 0x42, 0x41, 0x00, 0x1d, 0x82, 0x80, 0x00, 0x1b, 0x02, 0x00, 
+	0x00, 0x17, 0x40, 0x01, 0x80, 0x58, 0x80, 0x41, 0x04, 0x17, 0xc0, 0x00, 
+	0x80, 0x41, 0xc2, 0x01, 0x00, 0x80, 0x02, 0x00, 0x04, 0xc1, 0x02, 0x02, 
+	0x00, 0x16, 0xc2, 0x82, 0x04, 0x46, 0x42, 0x42, 0x00, 0x5d, 0x82, 0x80, 
+	0x00, 0x5b, 0x02, 0x00, 0x00, 0x17, 0xc0, 0x02, 0x80, 0x46, 0x82, 0x42, 
+	0x00, 0x47, 0xc2, 0xc2, 0x04, 0x80, 0x02, 0x80, 0x00, 0xc0, 0x02, 0x80, 
+	0x02, 0x01, 0x03, 0x03, 0x00, 0x40, 0x03, 0x80, 0x03, 0x81, 0x43, 0x03, 
+	0x00, 0xc1, 0x03, 0x03, 0x00, 0x00, 0x04, 0x00, 0x04, 0xd6, 0x02, 0x84, 
+	0x05, 0x5d, 0x42, 0x80, 0x01, 0x17, 0x40, 0x02, 0x80, 0x46, 0x82, 0x42, 
+	0x00, 0x47, 0xc2, 0xc2, 0x04, 0x80, 0x02, 0x80, 0x00, 0xc0, 0x02, 0x80, 
+	0x02, 0x01, 0x03, 0x03, 0x00, 0x40, 0x03, 0x80, 0x03, 0x81, 0x03, 0x03, 
+	0x00, 0xc0, 0x03, 0x00, 0x04, 0xd6, 0xc2, 0x83, 0x05, 0x5d, 0x42, 0x80, 
+	0x01, 0xa2, 0x80, 0x00, 0x00, 0x23, 0x01, 0xf5, 0x7f, 0x86, 0x80, 0x43, 
+	0x00, 0xc0, 0x00, 0x80, 0x00, 0x9d, 0x80, 0x00, 0x01, 0x18, 0xc0, 0x43, 
+	0x01, 0x17, 0xc0, 0x00, 0x80, 0xc6, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0xdd, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0xc6, 0x00, 0x40, 
+	0x00, 0x00, 0x01, 0x00, 0x01, 0xdd, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 
+	0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 
+	0x66, 0x66, 0x65, 0x72, 0x73, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0xf0, 0x3f, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x00, 
+	0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6e, 
+	0x74, 0x61, 0x78, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 
+	0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x69, 0x72, 
+	0x74, 0x79, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x00, 0x04, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x0c, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3c, 0x6d, 0x6f, 0x64, 0x69, 
+	0x66, 0x69, 0x65, 0x64, 0x3e, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6d, 0x65, 0x6e, 0x75, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0xf0, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x40, 0x00, 
+	0x00, 0x00, 0x73, 0x03, 0x00, 0x00, 0x73, 0x03, 0x00, 0x00, 0x78, 0x03, 
+	0x00, 0x00, 0x7d, 0x03, 0x00, 0x00, 0x7d, 0x03, 0x00, 0x00, 0x7d, 0x03, 
+	0x00, 0x00, 0x7d, 0x03, 0x00, 0x00, 0x7d, 0x03, 0x00, 0x00, 0x80, 0x03, 
+	0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x83, 0x03, 
+	0x00, 0x00, 0x83, 0x03, 0x00, 0x00, 0x84, 0x03, 0x00, 0x00, 0x84, 0x03, 
+	0x00, 0x00, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 0x00, 0x00, 0x85, 0x03, 
+	0x00, 0x00, 0x85, 0x03, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x86, 0x03, 
+	0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x86, 0x03, 0x00, 0x00, 0x8a, 0x03, 
+	0x00, 0x00, 0x8a, 0x03, 0x00, 0x00, 0x8a, 0x03, 0x00, 0x00, 0x8a, 0x03, 
+	0x00, 0x00, 0x8b, 0x03, 0x00, 0x00, 0x8b, 0x03, 0x00, 0x00, 0x8b, 0x03, 
+	0x00, 0x00, 0x8b, 0x03, 0x00, 0x00, 0x8b, 0x03, 0x00, 0x00, 0x8b, 0x03, 
+	0x00, 0x00, 0x8b, 0x03, 0x00, 0x00, 0x8b, 0x03, 0x00, 0x00, 0x8b, 0x03, 
+	0x00, 0x00, 0x8b, 0x03, 0x00, 0x00, 0x8b, 0x03, 0x00, 0x00, 0x8b, 0x03, 
+	0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, 0x8d, 0x03, 
+	0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, 0x8d, 0x03, 
+	0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, 0x8d, 0x03, 
+	0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, 0x7d, 0x03, 0x00, 0x00, 0x7d, 0x03, 
+	0x00, 0x00, 0x94, 0x03, 0x00, 0x00, 0x94, 0x03, 0x00, 0x00, 0x94, 0x03, 
+	0x00, 0x00, 0x9a, 0x03, 0x00, 0x00, 0x9a, 0x03, 0x00, 0x00, 0x9b, 0x03, 
+	0x00, 0x00, 0x9b, 0x03, 0x00, 0x00, 0x9b, 0x03, 0x00, 0x00, 0x9c, 0x03, 
+	0x00, 0x00, 0xa2, 0x03, 0x00, 0x00, 0xa2, 0x03, 0x00, 0x00, 0xa2, 0x03, 
+	0x00, 0x00, 0xa3, 0x03, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 
+	0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 
+	0x07, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 
+	0x74, 0x65, 0x29, 0x00, 0x07, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 
+	0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 
+	0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x07, 0x00, 
+	0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x08, 0x00, 0x00, 0x00, 
+	0x31, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6e, 0x61, 0x6d, 0x65, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x61, 0x6d, 
+	0x65, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x00, 0x0f, 
+	0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x72, 0x00, 0x36, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xa9, 0x03, 0x00, 0x00, 0xb2, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x1d, 0x80, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x46, 0x40, 0x40, 
+	0x00, 0x5d, 0x80, 0x80, 0x00, 0x8d, 0x80, 0xc0, 0x00, 0x19, 0x00, 0x00, 
+	0x01, 0x17, 0xc0, 0x00, 0x80, 0x86, 0x40, 0x40, 0x00, 0xcd, 0x80, 0xc0, 
+	0x00, 0x9d, 0x40, 0x00, 0x01, 0x17, 0x80, 0x00, 0x80, 0x86, 0x40, 0x40, 
+	0x00, 0xc1, 0xc0, 0x00, 0x00, 0x9d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 0x66, 0x66, 0x65, 
+	0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x10, 0x00, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0xaa, 0x03, 0x00, 
+	0x00, 0xaa, 0x03, 0x00, 0x00, 0xab, 0x03, 0x00, 0x00, 0xab, 0x03, 0x00, 
+	0x00, 0xad, 0x03, 0x00, 0x00, 0xad, 0x03, 0x00, 0x00, 0xad, 0x03, 0x00, 
+	0x00, 0xae, 0x03, 0x00, 0x00, 0xae, 0x03, 0x00, 0x00, 0xae, 0x03, 0x00, 
+	0x00, 0xae, 0x03, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0xb0, 0x03, 0x00, 
+	0x00, 0xb0, 0x03, 0x00, 0x00, 0xb2, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x78, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xb7, 0x03, 
+	0x00, 0x00, 0xbf, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x80, 0x80, 0x00, 0x19, 0x00, 0x80, 
+	0x80, 0x17, 0xc0, 0x00, 0x80, 0x46, 0x00, 0x40, 0x00, 0x8e, 0x80, 0x40, 
+	0x00, 0x5d, 0x40, 0x00, 0x01, 0x17, 0x40, 0x01, 0x80, 0x46, 0xc0, 0x40, 
+	0x00, 0x5d, 0x80, 0x80, 0x00, 0x55, 0x00, 0x80, 0x00, 0x86, 0x00, 0x40, 
+	0x00, 0xce, 0x80, 0xc0, 0x00, 0x9d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0xf0, 0x3f, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x0f, 0x00, 0x00, 0x00, 0xb8, 0x03, 0x00, 0x00, 0xb8, 0x03, 0x00, 
+	0x00, 0xb9, 0x03, 0x00, 0x00, 0xb9, 0x03, 0x00, 0x00, 0xba, 0x03, 0x00, 
+	0x00, 0xba, 0x03, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0xba, 0x03, 0x00, 
+	0x00, 0xbc, 0x03, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x00, 0xbc, 0x03, 0x00, 
+	0x00, 0xbd, 0x03, 0x00, 0x00, 0xbd, 0x03, 0x00, 0x00, 0xbd, 0x03, 0x00, 
+	0x00, 0xbf, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x75, 0x72, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6d, 0x61, 0x78, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xcc, 0x03, 0x00, 0x00, 0xf2, 0x03, 
+	0x00, 0x00, 0x01, 0x00, 0x0c, 0x31, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 
+	0x00, 0x5d, 0x80, 0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0xc6, 0x80, 0x40, 
+	0x00, 0xdd, 0x00, 0x80, 0x00, 0x9d, 0x00, 0x01, 0x00, 0x17, 0xc0, 0x05, 
+	0x80, 0xc6, 0x01, 0x40, 0x00, 0x0e, 0xc2, 0xc0, 0x02, 0xdd, 0x41, 0x00, 
+	0x01, 0xc6, 0x01, 0x41, 0x00, 0x01, 0x42, 0x01, 0x00, 0x46, 0x82, 0x41, 
+	0x00, 0x81, 0xc2, 0x01, 0x00, 0x16, 0x82, 0x02, 0x04, 0xdd, 0x81, 0x00, 
+	0x01, 0x06, 0x02, 0x41, 0x00, 0x41, 0x42, 0x01, 0x00, 0x86, 0x82, 0x41, 
+	0x00, 0xc1, 0x02, 0x02, 0x00, 0x56, 0xc2, 0x82, 0x04, 0x1d, 0x82, 0x00, 
+	0x01, 0x58, 0x40, 0xc2, 0x03, 0x17, 0x80, 0x01, 0x80, 0x58, 0x40, 0x42, 
+	0x04, 0x17, 0x00, 0x01, 0x80, 0x46, 0x82, 0x42, 0x00, 0x80, 0x02, 0x80, 
+	0x03, 0xc0, 0x02, 0x00, 0x04, 0x5d, 0x42, 0x80, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0xa2, 0x80, 0x00, 0x00, 0x23, 0x41, 0xf9, 0x7f, 0x86, 0xc0, 0x42, 
+	0x00, 0xc1, 0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x41, 0x41, 0x03, 
+	0x00, 0xd6, 0x40, 0x81, 0x01, 0x9d, 0x40, 0x00, 0x01, 0x86, 0x80, 0x43, 
+	0x00, 0xcb, 0x00, 0x00, 0x01, 0x01, 0xc1, 0x03, 0x00, 0x40, 0x01, 0x00, 
+	0x00, 0xe4, 0x40, 0x00, 0x01, 0x9d, 0x40, 0x00, 0x01, 0x86, 0x00, 0x40, 
+	0x00, 0xc0, 0x00, 0x80, 0x00, 0x9d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 
+	0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 
+	0x66, 0x66, 0x65, 0x72, 0x73, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0xf0, 0x3f, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x00, 
+	0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x6f, 0x6f, 
+	0x6b, 0x6d, 0x61, 0x72, 0x6b, 0x5f, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x78, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x79, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 
+	0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x61, 0x69, 0x6c, 
+	0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x66, 0x69, 0x6e, 0x64, 0x20, 0x62, 
+	0x6f, 0x6f, 0x6b, 0x6d, 0x61, 0x72, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 
+	0x27, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 
+	0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x6e, 
+	0x62, 0x69, 0x6e, 0x64, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x4d, 0x2d, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x31, 
+	0x00, 0x00, 0x00, 0xcf, 0x03, 0x00, 0x00, 0xcf, 0x03, 0x00, 0x00, 0xd1, 
+	0x03, 0x00, 0x00, 0xd1, 0x03, 0x00, 0x00, 0xd1, 0x03, 0x00, 0x00, 0xd1, 
+	0x03, 0x00, 0x00, 0xd1, 0x03, 0x00, 0x00, 0xd5, 0x03, 0x00, 0x00, 0xd5, 
+	0x03, 0x00, 0x00, 0xd5, 0x03, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0xda, 
+	0x03, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0xda, 
+	0x03, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0xdb, 0x03, 0x00, 0x00, 0xdb, 
+	0x03, 0x00, 0x00, 0xdb, 0x03, 0x00, 0x00, 0xdb, 0x03, 0x00, 0x00, 0xdb, 
+	0x03, 0x00, 0x00, 0xdb, 0x03, 0x00, 0x00, 0xdd, 0x03, 0x00, 0x00, 0xdd, 
+	0x03, 0x00, 0x00, 0xdd, 0x03, 0x00, 0x00, 0xdd, 0x03, 0x00, 0x00, 0xde, 
+	0x03, 0x00, 0x00, 0xde, 0x03, 0x00, 0x00, 0xde, 0x03, 0x00, 0x00, 0xde, 
+	0x03, 0x00, 0x00, 0xdf, 0x03, 0x00, 0x00, 0xd1, 0x03, 0x00, 0x00, 0xd1, 
+	0x03, 0x00, 0x00, 0xe6, 0x03, 0x00, 0x00, 0xe6, 0x03, 0x00, 0x00, 0xe6, 
+	0x03, 0x00, 0x00, 0xe6, 0x03, 0x00, 0x00, 0xe6, 0x03, 0x00, 0x00, 0xe6, 
+	0x03, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0xeb, 
+	0x03, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0xeb, 
+	0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xf0, 
+	0x03, 0x00, 0x00, 0xf2, 0x03, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6f, 0x6c, 0x64, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 
+	0x72, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x67, 
+	0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x06, 0x00, 
+	0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 
+	0x29, 0x00, 0x06, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0e, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 
+	0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x06, 0x00, 0x00, 0x00, 
+	0x21, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x69, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1f, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x61, 
+	0x6d, 0x65, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x10, 0x00, 0x00, 
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x79, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x45, 0x4e, 0x56, 0x00, 0xfb, 0x03, 0x00, 0x00, 0x09, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x0a, 0x28, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 
+	0x40, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x01, 0x06, 0xc0, 0x40, 0x00, 0x1d, 
+	0x80, 0x80, 0x00, 0x08, 0x00, 0x00, 0x81, 0x06, 0x00, 0x41, 0x00, 0x1d, 
+	0xc0, 0x80, 0x00, 0x86, 0x40, 0x41, 0x00, 0xc1, 0x80, 0x01, 0x00, 0x06, 
+	0x81, 0x40, 0x00, 0x41, 0xc1, 0x01, 0x00, 0xd6, 0x40, 0x81, 0x01, 0x00, 
+	0x01, 0x00, 0x00, 0x9d, 0x40, 0x80, 0x01, 0x86, 0x40, 0x41, 0x00, 0xc1, 
+	0x80, 0x01, 0x00, 0x06, 0x81, 0x40, 0x00, 0x41, 0x01, 0x02, 0x00, 0xd6, 
+	0x40, 0x81, 0x01, 0x00, 0x01, 0x80, 0x00, 0x9d, 0x40, 0x80, 0x01, 0x86, 
+	0x40, 0x42, 0x00, 0xcb, 0x00, 0x00, 0x01, 0x01, 0x81, 0x02, 0x00, 0x46, 
+	0x81, 0x40, 0x00, 0xe4, 0x40, 0x00, 0x01, 0x25, 0x01, 0x00, 0x00, 0x9d, 
+	0x40, 0x80, 0x01, 0x86, 0x00, 0x40, 0x00, 0xc1, 0xc0, 0x02, 0x00, 0x06, 
+	0x81, 0x40, 0x00, 0x41, 0x01, 0x03, 0x00, 0x80, 0x01, 0x00, 0x00, 0xc1, 
+	0x41, 0x03, 0x00, 0x00, 0x02, 0x80, 0x00, 0x41, 0x82, 0x03, 0x00, 0xd6, 
+	0x40, 0x82, 0x01, 0x9d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x0f, 
+	0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x1e, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6b, 0x65, 
+	0x79, 0x20, 0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x20, 0x66, 0x6f, 0x72, 
+	0x20, 0x62, 0x6f, 0x6f, 0x6b, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0x04, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x00, 0x04, 0x06, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x6f, 0x69, 0x6e, 0x74, 
+	0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 
+	0x66, 0x66, 0x65, 0x72, 0x5f, 0x64, 0x61, 0x74, 0x61, 0x00, 0x04, 0x0a, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x6f, 0x6f, 0x6b, 0x6d, 
+	0x61, 0x72, 0x6b, 0x5f, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x78, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x79, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x62, 0x69, 0x6e, 0x64, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x4d, 0x2d, 0x62, 0x00, 0x04, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x2d, 0x62, 0x2d, 0x00, 0x04, 0x17, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x77, 0x69, 0x6c, 0x6c, 
+	0x20, 0x6e, 0x6f, 0x77, 0x20, 0x74, 0x61, 0x6b, 0x65, 0x20, 0x79, 0x6f, 
+	0x75, 0x20, 0x74, 0x6f, 0x20, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x2c, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x62, 
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x04, 
+	0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0x1d, 0x40, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x6f, 0x6f, 0x6b, 0x6d, 0x61, 
+	0x72, 0x6b, 0x5f, 0x6c, 0x6f, 0x61, 0x64, 0x00, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x04, 0x00, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 
+	0x07, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5f, 0x45, 0x4e, 0x56, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 
+	0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x28, 0x00, 0x00, 0x00, 0xfc, 0x03, 
+	0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0xfd, 0x03, 
+	0x00, 0x00, 0xfd, 0x03, 0x00, 0x00, 0xfd, 0x03, 0x00, 0x00, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03, 0x04, 
+	0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03, 0x04, 
+	0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x04, 0x04, 
+	0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 
+	0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 
+	0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x04, 
+	0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x04, 
+	0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x08, 0x04, 
+	0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x08, 0x04, 
+	0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x08, 0x04, 
+	0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x09, 0x04, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x78, 0x00, 0x08, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x08, 0x00, 
+	0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x1b, 
+	0x04, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x80, 0x80, 0x00, 0x58, 0x40, 
+	0x40, 0x00, 0x17, 0x40, 0x00, 0x80, 0x18, 0x80, 0x40, 0x00, 0x17, 0x00, 
+	0x00, 0x80, 0x1f, 0x00, 0x80, 0x00, 0x46, 0xc0, 0x40, 0x00, 0xa5, 0x00, 
+	0x00, 0x00, 0x5d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x04, 0x00, 
+	0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x68, 0x69, 0x67, 0x68, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x33, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 
+	0x40, 0x40, 0x00, 0x5d, 0x00, 0x80, 0x00, 0x1d, 0x80, 0x00, 0x00, 0x58, 
+	0x80, 0x40, 0x00, 0x17, 0x00, 0x01, 0x80, 0x58, 0xc0, 0x40, 0x00, 0x17, 
+	0x80, 0x00, 0x80, 0x46, 0x00, 0x41, 0x00, 0x80, 0x00, 0x00, 0x00, 0x5d, 
+	0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 
+	0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x6e, 0x5f, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x5f, 0x68, 0x69, 0x67, 0x68, 0x6c, 0x69, 
+	0x67, 0x68, 0x74, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x74, 0x65, 0x78, 0x74, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x5f, 0x63, 0x6f, 0x6c, 
+	0x6f, 0x75, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x0c, 0x00, 
+	0x00, 0x00, 0x2b, 0x04, 0x00, 0x00, 0x2b, 0x04, 0x00, 0x00, 0x2b, 0x04, 
+	0x00, 0x00, 0x2b, 0x04, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x30, 0x04, 
+	0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x31, 0x04, 
+	0x00, 0x00, 0x31, 0x04, 0x00, 0x00, 0x31, 0x04, 0x00, 0x00, 0x33, 0x04, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x73, 0x00, 0x04, 0x00, 
+	0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x0b, 0x00, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 0x21, 0x04, 0x00, 0x00, 
+	0x22, 0x04, 0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 
+	0x22, 0x04, 0x00, 0x00, 0x23, 0x04, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 
+	0x33, 0x04, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x73, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x1f, 0x00, 
+	0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x0a, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x69, 0x6c, 0x75, 0x61, 
+	0x5f, 0x72, 0x6f, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x01, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x4c, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x4d, 0x04, 0x00, 0x00, 
+	0x53, 0x04, 0x00, 0x00, 0x01, 0x00, 0x05, 0x10, 0x00, 0x00, 0x00, 0x46, 
+	0x00, 0x40, 0x00, 0x86, 0x40, 0x40, 0x00, 0x9d, 0x80, 0x80, 0x00, 0xc0, 
+	0x00, 0x00, 0x00, 0x05, 0x01, 0x80, 0x00, 0x5d, 0x80, 0x00, 0x02, 0x18, 
+	0x80, 0xc0, 0x00, 0x17, 0x40, 0x00, 0x80, 0x84, 0x00, 0x00, 0x00, 0x9f, 
+	0x00, 0x00, 0x01, 0x86, 0xc0, 0x40, 0x01, 0xc0, 0x00, 0x80, 0x00, 0x06, 
+	0x01, 0xc1, 0x00, 0x9e, 0x00, 0x80, 0x01, 0x9f, 0x00, 0x00, 0x00, 0x1f, 
+	0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x5f, 0x72, 0x6f, 
+	0x77, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 
+	0x69, 0x6c, 0x75, 0x61, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 
+	0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x02, 
+	0x01, 0x03, 0x01, 0x01, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x10, 
+	0x00, 0x00, 0x00, 0x4e, 0x04, 0x00, 0x00, 0x4e, 0x04, 0x00, 0x00, 0x4e, 
+	0x04, 0x00, 0x00, 0x4e, 0x04, 0x00, 0x00, 0x4e, 0x04, 0x00, 0x00, 0x4e, 
+	0x04, 0x00, 0x00, 0x4f, 0x04, 0x00, 0x00, 0x4f, 0x04, 0x00, 0x00, 0x50, 
+	0x04, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00, 0x52, 0x04, 0x00, 0x00, 0x52, 
+	0x04, 0x00, 0x00, 0x52, 0x04, 0x00, 0x00, 0x52, 0x04, 0x00, 0x00, 0x52, 
+	0x04, 0x00, 0x00, 0x53, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x74, 0x65, 0x78, 0x74, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x43, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6c, 0x65, 0x6e, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x66, 0x66, 0x69, 0x00, 0x55, 0x04, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 
+	0x01, 0x00, 0x05, 0x07, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x86, 
+	0x40, 0x40, 0x00, 0x9d, 0x80, 0x80, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x15, 
+	0x01, 0x00, 0x00, 0x5d, 0x40, 0x00, 0x02, 0x1f, 0x00, 0x80, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x04, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x5f, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 
+	0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x73, 0x00, 0x04, 0x0d, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x5f, 
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x01, 0x02, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x07, 0x00, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 
+	0x56, 0x04, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 
+	0x56, 0x04, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6c, 0x6f, 
+	0x75, 0x72, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x43, 0x00, 0x88, 0x04, 0x00, 0x00, 0xf7, 0x04, 0x00, 0x00, 0x01, 0x00, 
+	0x0a, 0x85, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 
+	0x80, 0x46, 0x40, 0x40, 0x00, 0x86, 0x80, 0x40, 0x00, 0x5d, 0x00, 0x01, 
+	0x01, 0x17, 0x00, 0x01, 0x80, 0x86, 0x01, 0x40, 0x00, 0xc0, 0x01, 0x00, 
+	0x02, 0x01, 0xc2, 0x00, 0x00, 0xd6, 0x01, 0x82, 0x03, 0x8a, 0xc1, 0x01, 
+	0x02, 0x62, 0x80, 0x00, 0x00, 0xe3, 0x00, 0xfe, 0x7f, 0x46, 0x00, 0x41, 
+	0x00, 0x47, 0x40, 0xc1, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc1, 0x80, 0x01, 
+	0x00, 0x01, 0xc1, 0x01, 0x00, 0x5d, 0x80, 0x00, 0x02, 0x18, 0x00, 0xc2, 
+	0x00, 0x17, 0xc0, 0x02, 0x80, 0x46, 0x00, 0x41, 0x00, 0x47, 0x40, 0xc1, 
+	0x00, 0x80, 0x00, 0x00, 0x00, 0xc1, 0x40, 0x02, 0x00, 0x5d, 0x80, 0x80, 
+	0x01, 0x00, 0x00, 0x80, 0x00, 0x46, 0x80, 0x42, 0x00, 0x47, 0xc0, 0xc2, 
+	0x00, 0x81, 0x00, 0x03, 0x00, 0x5d, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 
+	0x00, 0x16, 0x80, 0x80, 0x00, 0x46, 0x00, 0x41, 0x00, 0x47, 0x40, 0xc3, 
+	0x00, 0x80, 0x00, 0x00, 0x00, 0xc1, 0x80, 0x03, 0x00, 0x5d, 0x80, 0x80, 
+	0x01, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x80, 0x0a, 0x80, 0x46, 0x00, 0x41, 
+	0x00, 0x47, 0x40, 0xc3, 0x00, 0x80, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x04, 
+	0x00, 0x5d, 0x80, 0x80, 0x01, 0x08, 0x40, 0x80, 0x87, 0x46, 0xc0, 0x43, 
+	0x00, 0x18, 0x40, 0xc4, 0x00, 0x17, 0x00, 0x00, 0x80, 0x08, 0x80, 0xc4, 
+	0x87, 0x46, 0xc0, 0x44, 0x00, 0x86, 0xc0, 0x43, 0x00, 0x5d, 0x80, 0x00, 
+	0x01, 0x5b, 0x00, 0x00, 0x00, 0x17, 0xc0, 0x06, 0x80, 0x46, 0x40, 0x45, 
+	0x00, 0x86, 0xc0, 0x43, 0x00, 0x5d, 0x80, 0x00, 0x01, 0x08, 0x40, 0x00, 
+	0x8a, 0x46, 0x80, 0x45, 0x00, 0x86, 0x00, 0x45, 0x00, 0x5d, 0x00, 0x01, 
+	0x01, 0x17, 0x40, 0x04, 0x80, 0x86, 0xc1, 0x44, 0x00, 0xc0, 0x01, 0x80, 
+	0x02, 0x01, 0xc2, 0x05, 0x00, 0xd6, 0x01, 0x82, 0x03, 0x9d, 0x81, 0x00, 
+	0x01, 0x9b, 0x01, 0x00, 0x00, 0x17, 0x00, 0x02, 0x80, 0x86, 0x01, 0x40, 
+	0x00, 0xc0, 0x01, 0x80, 0x02, 0x01, 0x82, 0x04, 0x00, 0xd6, 0x01, 0x82, 
+	0x03, 0x00, 0x02, 0x80, 0x02, 0x41, 0x82, 0x04, 0x00, 0x16, 0x42, 0x02, 
+	0x04, 0x8a, 0x01, 0x82, 0x03, 0x17, 0x40, 0x00, 0x80, 0x86, 0x01, 0x40, 
+	0x00, 0x8a, 0x41, 0x81, 0x02, 0x62, 0x80, 0x00, 0x00, 0xe3, 0xc0, 0xfa, 
+	0x7f, 0x4b, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x8c, 0x46, 0x40, 0x40, 
+	0x00, 0x86, 0x00, 0x40, 0x00, 0x5d, 0x00, 0x01, 0x01, 0x17, 0x40, 0x03, 
+	0x80, 0x86, 0x01, 0x41, 0x00, 0x87, 0x41, 0x43, 0x03, 0xc0, 0x01, 0x80, 
+	0x02, 0x01, 0x42, 0x06, 0x00, 0x40, 0x02, 0x00, 0x00, 0x16, 0x42, 0x02, 
+	0x04, 0x9d, 0x81, 0x80, 0x01, 0x9b, 0x01, 0x00, 0x00, 0x17, 0x00, 0x01, 
+	0x80, 0x86, 0x81, 0x46, 0x00, 0x87, 0xc1, 0x46, 0x03, 0xc6, 0x01, 0x46, 
+	0x00, 0x00, 0x02, 0x80, 0x02, 0x9d, 0x41, 0x80, 0x01, 0x62, 0x80, 0x00, 
+	0x00, 0xe3, 0xc0, 0xfb, 0x7f, 0x46, 0x00, 0x46, 0x00, 0x55, 0x00, 0x80, 
+	0x00, 0x18, 0x80, 0xc1, 0x00, 0x17, 0x00, 0x00, 0x80, 0x1f, 0x00, 0x00, 
+	0x01, 0x46, 0x00, 0x46, 0x00, 0x55, 0x00, 0x80, 0x00, 0x18, 0xc0, 0xc1, 
+	0x00, 0x17, 0x80, 0x00, 0x80, 0x46, 0x00, 0x46, 0x00, 0x47, 0xc0, 0xc1, 
+	0x00, 0x5f, 0x00, 0x00, 0x01, 0x46, 0x80, 0x46, 0x00, 0x47, 0x00, 0xc7, 
+	0x00, 0x86, 0x00, 0x46, 0x00, 0x5d, 0x40, 0x00, 0x01, 0x46, 0x40, 0x47, 
+	0x00, 0x86, 0x00, 0x46, 0x00, 0x5d, 0x80, 0x00, 0x01, 0x18, 0x80, 0xc7, 
+	0x00, 0x17, 0x40, 0x00, 0x80, 0x1f, 0x00, 0x00, 0x01, 0x17, 0xc0, 0x00, 
+	0x80, 0x86, 0x00, 0x46, 0x00, 0xcd, 0xc0, 0xc1, 0x00, 0x87, 0xc0, 0x00, 
+	0x01, 0x9f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x1f, 0x00, 0x00, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6d, 
+	0x70, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
+	0x61, 0x69, 0x72, 0x73, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x47, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x28, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x75, 0x62, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0xf0, 0x3f, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x7e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x73, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x65, 0x74, 0x65, 
+	0x6e, 0x76, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x48, 0x4f, 0x4d, 0x45, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x04, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x2f, 0x00, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x69, 0x72, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x28, 0x2e, 0x2a, 0x29, 0x2f, 
+	0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x78, 0x69, 0x73, 0x74, 
+	0x73, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 
+	0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x04, 0x12, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 
+	0x79, 0x5f, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x70, 0x61, 0x69, 0x72, 
+	0x73, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 
+	0x2e, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 
+	0x65, 0x74, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5e, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
+	0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x6f, 0x72, 0x74, 0x00, 0x04, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x65, 0x6e, 0x75, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x85, 0x00, 0x00, 0x00, 0x8d, 0x04, 0x00, 0x00, 0x8d, 
+	0x04, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0x92, 
+	0x04, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0x93, 0x04, 0x00, 0x00, 0x93, 
+	0x04, 0x00, 0x00, 0x93, 0x04, 0x00, 0x00, 0x93, 0x04, 0x00, 0x00, 0x93, 
+	0x04, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0x9a, 
+	0x04, 0x00, 0x00, 0x9a, 0x04, 0x00, 0x00, 0x9a, 0x04, 0x00, 0x00, 0x9a, 
+	0x04, 0x00, 0x00, 0x9a, 0x04, 0x00, 0x00, 0x9a, 0x04, 0x00, 0x00, 0x9a, 
+	0x04, 0x00, 0x00, 0x9a, 0x04, 0x00, 0x00, 0x9b, 0x04, 0x00, 0x00, 0x9b, 
+	0x04, 0x00, 0x00, 0x9b, 0x04, 0x00, 0x00, 0x9b, 0x04, 0x00, 0x00, 0x9b, 
+	0x04, 0x00, 0x00, 0x9b, 0x04, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x00, 0x9c, 
+	0x04, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x00, 0x9c, 
+	0x04, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x00, 0xa2, 0x04, 0x00, 0x00, 0xa2, 
+	0x04, 0x00, 0x00, 0xa2, 0x04, 0x00, 0x00, 0xa2, 0x04, 0x00, 0x00, 0xa2, 
+	0x04, 0x00, 0x00, 0xa2, 0x04, 0x00, 0x00, 0xa2, 0x04, 0x00, 0x00, 0xa9, 
+	0x04, 0x00, 0x00, 0xa9, 0x04, 0x00, 0x00, 0xa9, 0x04, 0x00, 0x00, 0xa9, 
+	0x04, 0x00, 0x00, 0xa9, 0x04, 0x00, 0x00, 0xa9, 0x04, 0x00, 0x00, 0xaa, 
+	0x04, 0x00, 0x00, 0xaa, 0x04, 0x00, 0x00, 0xaa, 0x04, 0x00, 0x00, 0xaa, 
+	0x04, 0x00, 0x00, 0xaf, 0x04, 0x00, 0x00, 0xaf, 0x04, 0x00, 0x00, 0xaf, 
+	0x04, 0x00, 0x00, 0xaf, 0x04, 0x00, 0x00, 0xaf, 0x04, 0x00, 0x00, 0xb0, 
+	0x04, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00, 0xb0, 
+	0x04, 0x00, 0x00, 0xb1, 0x04, 0x00, 0x00, 0xb1, 0x04, 0x00, 0x00, 0xb1, 
+	0x04, 0x00, 0x00, 0xb1, 0x04, 0x00, 0x00, 0xb3, 0x04, 0x00, 0x00, 0xb3, 
+	0x04, 0x00, 0x00, 0xb3, 0x04, 0x00, 0x00, 0xb3, 0x04, 0x00, 0x00, 0xb3, 
+	0x04, 0x00, 0x00, 0xb3, 0x04, 0x00, 0x00, 0xb3, 0x04, 0x00, 0x00, 0xb4, 
+	0x04, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 0xb4, 
+	0x04, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 0xb4, 
+	0x04, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 0xb6, 
+	0x04, 0x00, 0x00, 0xb6, 0x04, 0x00, 0x00, 0xb1, 0x04, 0x00, 0x00, 0xb1, 
+	0x04, 0x00, 0x00, 0xc3, 0x04, 0x00, 0x00, 0xc3, 0x04, 0x00, 0x00, 0xc8, 
+	0x04, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x00, 0xc8, 
+	0x04, 0x00, 0x00, 0xc9, 0x04, 0x00, 0x00, 0xc9, 0x04, 0x00, 0x00, 0xc9, 
+	0x04, 0x00, 0x00, 0xc9, 0x04, 0x00, 0x00, 0xc9, 0x04, 0x00, 0x00, 0xc9, 
+	0x04, 0x00, 0x00, 0xc9, 0x04, 0x00, 0x00, 0xc9, 0x04, 0x00, 0x00, 0xc9, 
+	0x04, 0x00, 0x00, 0xca, 0x04, 0x00, 0x00, 0xca, 0x04, 0x00, 0x00, 0xca, 
+	0x04, 0x00, 0x00, 0xca, 0x04, 0x00, 0x00, 0xca, 0x04, 0x00, 0x00, 0xc8, 
+	0x04, 0x00, 0x00, 0xc8, 0x04, 0x00, 0x00, 0xd7, 0x04, 0x00, 0x00, 0xd7, 
+	0x04, 0x00, 0x00, 0xd7, 0x04, 0x00, 0x00, 0xd7, 0x04, 0x00, 0x00, 0xd8, 
+	0x04, 0x00, 0x00, 0xde, 0x04, 0x00, 0x00, 0xde, 0x04, 0x00, 0x00, 0xde, 
+	0x04, 0x00, 0x00, 0xde, 0x04, 0x00, 0x00, 0xdf, 0x04, 0x00, 0x00, 0xdf, 
+	0x04, 0x00, 0x00, 0xdf, 0x04, 0x00, 0x00, 0xe5, 0x04, 0x00, 0x00, 0xe5, 
+	0x04, 0x00, 0x00, 0xe5, 0x04, 0x00, 0x00, 0xe5, 0x04, 0x00, 0x00, 0xea, 
+	0x04, 0x00, 0x00, 0xea, 0x04, 0x00, 0x00, 0xea, 0x04, 0x00, 0x00, 0xef, 
+	0x04, 0x00, 0x00, 0xef, 0x04, 0x00, 0x00, 0xf0, 0x04, 0x00, 0x00, 0xf0, 
+	0x04, 0x00, 0x00, 0xf5, 0x04, 0x00, 0x00, 0xf5, 0x04, 0x00, 0x00, 0xf5, 
+	0x04, 0x00, 0x00, 0xf5, 0x04, 0x00, 0x00, 0xf7, 0x04, 0x00, 0x00, 0x11, 
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 
+	0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x10, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 
+	0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 
+	0x65, 0x29, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0e, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 
+	0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6b, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x06, 0x00, 0x00, 
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 
+	0x74, 0x6f, 0x72, 0x29, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 
+	0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x00, 0x3e, 0x00, 0x00, 
+	0x00, 0x53, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 
+	0x6c, 0x29, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x3f, 0x00, 0x00, 
+	0x00, 0x51, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x76, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x10, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 
+	0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x58, 
+	0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 
+	0x65, 0x29, 0x00, 0x58, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x0e, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 
+	0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x58, 0x00, 0x00, 
+	0x00, 0x69, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6b, 0x00, 0x59, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0x59, 0x00, 0x00, 
+	0x00, 0x67, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x72, 0x65, 0x73, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x04, 0x05, 0x00, 0x00, 0x0a, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x1d, 0x80, 0x80, 0x00, 0x0e, 0x40, 0x40, 0x00, 0x19, 0x00, 0x00, 
+	0x81, 0x17, 0x00, 0x01, 0x80, 0x46, 0xc0, 0x40, 0x00, 0x81, 0x00, 0x01, 
+	0x00, 0x5d, 0x40, 0x00, 0x01, 0x0e, 0x40, 0x40, 0x00, 0x17, 0x00, 0xfe, 
+	0x7f, 0x1f, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x04, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x70, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x05, 0x05, 
+	0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x06, 0x05, 0x00, 0x00, 0x06, 0x05, 
+	0x00, 0x00, 0x07, 0x05, 0x00, 0x00, 0x07, 0x05, 0x00, 0x00, 0x07, 0x05, 
+	0x00, 0x00, 0x08, 0x05, 0x00, 0x00, 0x08, 0x05, 0x00, 0x00, 0x0a, 0x05, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x68, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5f, 0x45, 0x4e, 0x56, 0x00, 0x11, 0x05, 0x00, 0x00, 0x17, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 
+	0x1d, 0x80, 0x80, 0x00, 0x0e, 0x40, 0x40, 0x00, 0x19, 0x00, 0x00, 0x81, 
+	0x17, 0x00, 0x01, 0x80, 0x46, 0xc0, 0x40, 0x00, 0x81, 0x00, 0x01, 0x00, 
+	0x5d, 0x40, 0x00, 0x01, 0x0e, 0x40, 0x40, 0x00, 0x17, 0x00, 0xfe, 0x7f, 
+	0x1f, 0x00, 0x80, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x04, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x6f, 0x77, 0x6e, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x12, 0x05, 0x00, 0x00, 0x12, 
+	0x05, 0x00, 0x00, 0x12, 0x05, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x13, 
+	0x05, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00, 0x14, 
+	0x05, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00, 0x17, 
+	0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x68, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x22, 0x05, 0x00, 0x00, 0x38, 0x05, 
+	0x00, 0x00, 0x01, 0x00, 0x03, 0x1d, 0x00, 0x00, 0x00, 0x18, 0x00, 0x40, 
+	0x00, 0x17, 0xc0, 0x00, 0x80, 0x46, 0x40, 0x40, 0x00, 0x81, 0x80, 0x00, 
+	0x00, 0x5d, 0x80, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x46, 0xc0, 0x40, 
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x5d, 0x80, 0x00, 0x01, 0x18, 0x00, 0xc0, 
+	0x00, 0x17, 0xc0, 0x00, 0x80, 0x46, 0x00, 0x41, 0x00, 0x81, 0x40, 0x01, 
+	0x00, 0x5d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x46, 0xc0, 0x40, 
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x5d, 0x80, 0x00, 0x01, 0x00, 0x00, 0x80, 
+	0x00, 0x46, 0x80, 0x41, 0x00, 0x5d, 0x40, 0x80, 0x00, 0x19, 0x00, 0x80, 
+	0x83, 0x17, 0x00, 0x01, 0x80, 0x46, 0x00, 0x42, 0x00, 0x81, 0x40, 0x02, 
+	0x00, 0x5d, 0x40, 0x00, 0x01, 0x0e, 0x80, 0x42, 0x00, 0x17, 0x00, 0xfe, 
+	0x7f, 0x1f, 0x00, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x72, 0x6f, 0x6d, 0x70, 
+	0x74, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 
+	0x6f, 0x74, 0x6f, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x3f, 0x00, 0x04, 0x09, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6e, 0x75, 0x6d, 
+	0x62, 0x65, 0x72, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x19, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x6f, 0x75, 0x20, 0x6d, 0x75, 0x73, 
+	0x74, 0x20, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x6e, 0x75, 
+	0x6d, 0x62, 0x65, 0x72, 0x21, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x73, 0x6f, 0x66, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x64, 0x6f, 0x77, 0x6e, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x1d, 0x00, 
+	0x00, 0x00, 0x23, 0x05, 0x00, 0x00, 0x23, 0x05, 0x00, 0x00, 0x24, 0x05, 
+	0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x24, 0x05, 
+	0x00, 0x00, 0x27, 0x05, 0x00, 0x00, 0x27, 0x05, 0x00, 0x00, 0x27, 0x05, 
+	0x00, 0x00, 0x27, 0x05, 0x00, 0x00, 0x27, 0x05, 0x00, 0x00, 0x28, 0x05, 
+	0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0x29, 0x05, 
+	0x00, 0x00, 0x2c, 0x05, 0x00, 0x00, 0x2c, 0x05, 0x00, 0x00, 0x2c, 0x05, 
+	0x00, 0x00, 0x2c, 0x05, 0x00, 0x00, 0x31, 0x05, 0x00, 0x00, 0x31, 0x05, 
+	0x00, 0x00, 0x34, 0x05, 0x00, 0x00, 0x34, 0x05, 0x00, 0x00, 0x35, 0x05, 
+	0x00, 0x00, 0x35, 0x05, 0x00, 0x00, 0x35, 0x05, 0x00, 0x00, 0x36, 0x05, 
+	0x00, 0x00, 0x36, 0x05, 0x00, 0x00, 0x38, 0x05, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x75, 
+	0x6d, 0x62, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x4b, 0x05, 0x00, 0x00, 0x62, 0x05, 
+	0x00, 0x00, 0x01, 0x00, 0x06, 0x1c, 0x00, 0x00, 0x00, 0x46, 0x40, 0x40, 
+	0x00, 0x47, 0x80, 0xc0, 0x00, 0x08, 0x40, 0x00, 0x80, 0x46, 0xc0, 0x40, 
+	0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0xc0, 0x01, 0x80, 0x46, 0x40, 0x40, 
+	0x00, 0x86, 0x40, 0x40, 0x00, 0x87, 0x80, 0x40, 0x01, 0xc1, 0x00, 0x01, 
+	0x00, 0x06, 0xc1, 0x40, 0x00, 0x41, 0x41, 0x01, 0x00, 0x96, 0x40, 0x01, 
+	0x01, 0x4a, 0x80, 0x00, 0x81, 0x46, 0x80, 0x41, 0x00, 0x86, 0xc0, 0x41, 
+	0x00, 0xc0, 0x00, 0x00, 0x00, 0x5d, 0xc0, 0x80, 0x01, 0xc6, 0x40, 0x40, 
+	0x00, 0x06, 0x01, 0x40, 0x00, 0xca, 0x00, 0x01, 0x81, 0x5b, 0x00, 0x00, 
+	0x00, 0x17, 0x40, 0x00, 0x80, 0x9f, 0x00, 0x00, 0x01, 0x17, 0x40, 0x00, 
+	0x80, 0xc4, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6f, 0x72, 0x69, 0x67, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x63, 0x6b, 0x61, 0x67, 0x65, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x74, 
+	0x68, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x5f, 0x70, 0x61, 0x74, 0x68, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x3f, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
+	0x63, 0x61, 0x6c, 0x6c, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x05, 0x00, 0x00, 0x4e, 
+	0x05, 0x00, 0x00, 0x4e, 0x05, 0x00, 0x00, 0x51, 0x05, 0x00, 0x00, 0x51, 
+	0x05, 0x00, 0x00, 0x51, 0x05, 0x00, 0x00, 0x52, 0x05, 0x00, 0x00, 0x52, 
+	0x05, 0x00, 0x00, 0x52, 0x05, 0x00, 0x00, 0x52, 0x05, 0x00, 0x00, 0x52, 
+	0x05, 0x00, 0x00, 0x52, 0x05, 0x00, 0x00, 0x52, 0x05, 0x00, 0x00, 0x52, 
+	0x05, 0x00, 0x00, 0x56, 0x05, 0x00, 0x00, 0x56, 0x05, 0x00, 0x00, 0x56, 
+	0x05, 0x00, 0x00, 0x56, 0x05, 0x00, 0x00, 0x59, 0x05, 0x00, 0x00, 0x59, 
+	0x05, 0x00, 0x00, 0x59, 0x05, 0x00, 0x00, 0x5b, 0x05, 0x00, 0x00, 0x5b, 
+	0x05, 0x00, 0x00, 0x5d, 0x05, 0x00, 0x00, 0x5d, 0x05, 0x00, 0x00, 0x60, 
+	0x05, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00, 0x62, 0x05, 0x00, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 
+	0x61, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 
+	0x75, 0x73, 0x00, 0x12, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x12, 
+	0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x72, 0x05, 0x00, 0x00, 0x96, 0x05, 0x00, 0x00, 0x01, 0x00, 0x07, 0x2f, 
+	0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x5d, 0x80, 0x80, 0x00, 0x58, 
+	0x40, 0xc0, 0x00, 0x17, 0x40, 0x00, 0x80, 0x18, 0x80, 0xc0, 0x00, 0x17, 
+	0x40, 0x00, 0x80, 0x81, 0x80, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x01, 0x86, 
+	0x00, 0x41, 0x00, 0xc1, 0xc0, 0x00, 0x00, 0x9d, 0x80, 0x00, 0x01, 0x08, 
+	0x80, 0x80, 0x81, 0x86, 0xc0, 0x40, 0x00, 0x9b, 0x40, 0x00, 0x00, 0x17, 
+	0x80, 0x01, 0x80, 0x86, 0x40, 0x41, 0x00, 0xc1, 0x80, 0x01, 0x00, 0x9d, 
+	0x40, 0x00, 0x01, 0x86, 0x00, 0x40, 0x00, 0xc1, 0x80, 0x00, 0x00, 0x9d, 
+	0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x86, 0x00, 0x41, 0x00, 0xc0, 
+	0x00, 0x80, 0x00, 0x9d, 0x80, 0x00, 0x01, 0x9b, 0x00, 0x00, 0x00, 0x17, 
+	0x80, 0x01, 0x80, 0xc6, 0xc0, 0x41, 0x00, 0x07, 0x01, 0x42, 0x01, 0x40, 
+	0x01, 0x00, 0x00, 0x1d, 0x01, 0x00, 0x01, 0xdd, 0x80, 0x00, 0x00, 0xdf, 
+	0x00, 0x00, 0x01, 0x17, 0xc0, 0x02, 0x80, 0xc6, 0x40, 0x41, 0x00, 0x01, 
+	0x41, 0x02, 0x00, 0x46, 0x01, 0x40, 0x00, 0x5d, 0x81, 0x80, 0x00, 0x81, 
+	0x81, 0x02, 0x00, 0x16, 0x81, 0x01, 0x02, 0xdd, 0x40, 0x00, 0x01, 0xc6, 
+	0x00, 0x40, 0x00, 0x01, 0x81, 0x00, 0x00, 0xdd, 0x40, 0x00, 0x01, 0xc1, 
+	0x80, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 0x0c, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x73, 0x79, 
+	0x6e, 0x74, 0x61, 0x78, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x3e, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x75, 0x61, 0x20, 0x4c, 0x50, 
+	0x45, 0x47, 0x20, 0x6c, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x6e, 
+	0x6f, 0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6c, 0x61, 0x62, 0x6c, 0x65, 
+	0x20, 0x2d, 0x20, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x20, 0x68, 0x69, 
+	0x67, 0x68, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 
+	0x69, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x64, 0x00, 0x04, 0x09, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x73, 0x74, 0x72, 0x69, 0x6e, 
+	0x67, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
+	0x61, 0x72, 0x73, 0x65, 0x00, 0x04, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 
+	0x6c, 0x6f, 0x61, 0x64, 0x20, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2d, 
+	0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20, 0x27, 0x00, 0x04, 0x1a, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x20, 0x64, 0x69, 0x73, 0x61, 
+	0x62, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x69, 0x67, 0x68, 0x6c, 0x69, 
+	0x67, 0x68, 0x74, 0x69, 0x6e, 0x67, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x76, 0x05, 0x00, 0x00, 0x76, 0x05, 0x00, 
+	0x00, 0x77, 0x05, 0x00, 0x00, 0x77, 0x05, 0x00, 0x00, 0x77, 0x05, 0x00, 
+	0x00, 0x77, 0x05, 0x00, 0x00, 0x78, 0x05, 0x00, 0x00, 0x78, 0x05, 0x00, 
+	0x00, 0x7f, 0x05, 0x00, 0x00, 0x7f, 0x05, 0x00, 0x00, 0x7f, 0x05, 0x00, 
+	0x00, 0x7f, 0x05, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00, 0x80, 0x05, 0x00, 
+	0x00, 0x80, 0x05, 0x00, 0x00, 0x81, 0x05, 0x00, 0x00, 0x81, 0x05, 0x00, 
+	0x00, 0x81, 0x05, 0x00, 0x00, 0x82, 0x05, 0x00, 0x00, 0x82, 0x05, 0x00, 
+	0x00, 0x82, 0x05, 0x00, 0x00, 0x83, 0x05, 0x00, 0x00, 0x8e, 0x05, 0x00, 
+	0x00, 0x8e, 0x05, 0x00, 0x00, 0x8e, 0x05, 0x00, 0x00, 0x8f, 0x05, 0x00, 
+	0x00, 0x8f, 0x05, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x90, 0x05, 0x00, 
+	0x00, 0x90, 0x05, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x90, 0x05, 0x00, 
+	0x00, 0x90, 0x05, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x92, 0x05, 0x00, 
+	0x00, 0x92, 0x05, 0x00, 0x00, 0x92, 0x05, 0x00, 0x00, 0x92, 0x05, 0x00, 
+	0x00, 0x92, 0x05, 0x00, 0x00, 0x92, 0x05, 0x00, 0x00, 0x92, 0x05, 0x00, 
+	0x00, 0x93, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 0x00, 0x93, 0x05, 0x00, 
+	0x00, 0x94, 0x05, 0x00, 0x00, 0x94, 0x05, 0x00, 0x00, 0x96, 0x05, 0x00, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x74, 0x65, 0x78, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x6f, 
+	0x64, 0x65, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x62, 0x6a, 0x00, 0x19, 
+	0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0xb2, 0x05, 0x00, 0x00, 0xc4, 0x05, 0x00, 0x00, 0x02, 0x00, 0x09, 0x19, 
+	0x00, 0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0xc0, 0x00, 0x80, 0x00, 0x9d, 
+	0x80, 0x00, 0x01, 0x18, 0x40, 0x40, 0x01, 0x17, 0x80, 0x00, 0x80, 0x86, 
+	0x80, 0x40, 0x00, 0xc0, 0x00, 0x80, 0x00, 0x9d, 0x40, 0x00, 0x01, 0x86, 
+	0xc0, 0x40, 0x00, 0x9d, 0x40, 0x80, 0x00, 0x86, 0x00, 0x41, 0x00, 0xc0, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x65, 0x01, 0x00, 0x00, 0x9d, 
+	0xc0, 0x00, 0x02, 0x9b, 0x40, 0x00, 0x00, 0x17, 0x80, 0x01, 0x80, 0x06, 
+	0x41, 0x41, 0x00, 0x41, 0x81, 0x01, 0x00, 0x80, 0x01, 0x00, 0x00, 0xc1, 
+	0xc1, 0x01, 0x00, 0x00, 0x02, 0x80, 0x01, 0x56, 0x01, 0x82, 0x02, 0x1d, 
+	0x41, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 0x66, 0x66, 
+	0x65, 0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 
+	0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x72, 0x65, 
+	0x61, 0x74, 0x65, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6f, 0x66, 0x00, 
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x70, 0x61, 
+	0x77, 0x6e, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 
+	0x6f, 0x20, 0x72, 0x75, 0x6e, 0x20, 0x27, 0x00, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x3a, 0x20, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0xbd, 0x05, 0x00, 0x00, 0xbf, 0x05, 0x00, 0x00, 0x01, 0x00, 0x06, 
+	0x08, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x81, 0x40, 0x00, 0x00, 
+	0xc5, 0x00, 0x80, 0x00, 0x01, 0x81, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 
+	0x96, 0x40, 0x01, 0x01, 0x5d, 0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x04, 0x16, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x27, 0x20, 0x65, 0x78, 0x69, 0x74, 0x65, 0x64, 
+	0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 
+	0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x08, 0x00, 0x00, 
+	0x00, 0xbe, 0x05, 0x00, 0x00, 0xbe, 0x05, 0x00, 0x00, 0xbe, 0x05, 0x00, 
+	0x00, 0xbe, 0x05, 0x00, 0x00, 0xbe, 0x05, 0x00, 0x00, 0xbe, 0x05, 0x00, 
+	0x00, 0xbe, 0x05, 0x00, 0x00, 0xbf, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x64, 
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 
+	0x6d, 0x64, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 
+	0x6c, 0x75, 0x61, 0x00, 0x19, 0x00, 0x00, 0x00, 0xb6, 0x05, 0x00, 0x00, 
+	0xb6, 0x05, 0x00, 0x00, 0xb6, 0x05, 0x00, 0x00, 0xb6, 0x05, 0x00, 0x00, 
+	0xb6, 0x05, 0x00, 0x00, 0xb7, 0x05, 0x00, 0x00, 0xb7, 0x05, 0x00, 0x00, 
+	0xb7, 0x05, 0x00, 0x00, 0xbb, 0x05, 0x00, 0x00, 0xbb, 0x05, 0x00, 0x00, 
+	0xbd, 0x05, 0x00, 0x00, 0xbd, 0x05, 0x00, 0x00, 0xbd, 0x05, 0x00, 0x00, 
+	0xbf, 0x05, 0x00, 0x00, 0xbd, 0x05, 0x00, 0x00, 0xc1, 0x05, 0x00, 0x00, 
+	0xc1, 0x05, 0x00, 0x00, 0xc2, 0x05, 0x00, 0x00, 0xc2, 0x05, 0x00, 0x00, 
+	0xc2, 0x05, 0x00, 0x00, 0xc2, 0x05, 0x00, 0x00, 0xc2, 0x05, 0x00, 0x00, 
+	0xc2, 0x05, 0x00, 0x00, 0xc2, 0x05, 0x00, 0x00, 0xc4, 0x05, 0x00, 0x00, 
+	0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x63, 0x6d, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x61, 0x6d, 0x65, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x69, 0x64, 0x00, 0x0f, 0x00, 0x00, 
+	0x00, 0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x65, 0x72, 0x72, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xd0, 0x05, 0x00, 0x00, 0xf5, 0x05, 
+	0x00, 0x00, 0x01, 0x00, 0x0c, 0x1a, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 
+	0x00, 0x5d, 0x80, 0x80, 0x00, 0x86, 0x40, 0x40, 0x00, 0x9d, 0xc0, 0x80, 
+	0x00, 0x06, 0x81, 0x40, 0x00, 0x0d, 0xc1, 0x40, 0x02, 0x08, 0x00, 0x01, 
+	0x81, 0x01, 0x01, 0x01, 0x00, 0x46, 0x81, 0x40, 0x00, 0x81, 0x41, 0x01, 
+	0x00, 0x16, 0x81, 0x01, 0x02, 0x46, 0x81, 0x41, 0x00, 0x80, 0x01, 0x00, 
+	0x00, 0xc0, 0x01, 0x00, 0x02, 0x25, 0x02, 0x00, 0x00, 0x5d, 0xc1, 0x00, 
+	0x02, 0x5b, 0x41, 0x00, 0x00, 0x17, 0x80, 0x01, 0x80, 0xc6, 0xc1, 0x41, 
+	0x00, 0x01, 0x02, 0x02, 0x00, 0x40, 0x02, 0x00, 0x00, 0x81, 0x42, 0x02, 
+	0x00, 0xc0, 0x02, 0x00, 0x03, 0x16, 0xc2, 0x02, 0x04, 0xdd, 0x41, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x65, 0x74, 0x5f, 0x62, 0x75, 
+	0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x00, 0x04, 0x10, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x5f, 
+	0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x2a, 0x43, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x2d, 
+	0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x70, 0x61, 
+	0x77, 0x6e, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x10, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x46, 0x61, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x74, 
+	0x6f, 0x20, 0x72, 0x75, 0x6e, 0x20, 0x27, 0x00, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x3a, 0x20, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0xd7, 0x05, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x01, 0x00, 0x09, 
+	0x36, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x85, 0x00, 0x80, 0x00, 
+	0x5d, 0x80, 0x00, 0x01, 0x86, 0x40, 0x40, 0x00, 0x87, 0x80, 0x40, 0x01, 
+	0xcc, 0xc0, 0xc0, 0x00, 0xdd, 0x80, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 
+	0x9d, 0x80, 0x80, 0x01, 0xc6, 0x40, 0x41, 0x00, 0xdd, 0x80, 0x80, 0x00, 
+	0x06, 0x81, 0x41, 0x00, 0x46, 0xc1, 0x41, 0x01, 0x85, 0x01, 0x00, 0x01, 
+	0x1d, 0x81, 0x80, 0x01, 0x1b, 0x01, 0x00, 0x00, 0x17, 0x40, 0x05, 0x80, 
+	0x06, 0x01, 0x42, 0x00, 0x1d, 0xc1, 0x80, 0x00, 0x86, 0x01, 0x42, 0x00, 
+	0xc5, 0x01, 0x80, 0x01, 0x05, 0x02, 0x00, 0x02, 0x9d, 0x41, 0x80, 0x01, 
+	0x86, 0x41, 0x42, 0x00, 0xc0, 0x01, 0x00, 0x01, 0x9d, 0x41, 0x00, 0x01, 
+	0x85, 0x01, 0x00, 0x02, 0x59, 0x80, 0x81, 0x02, 0x17, 0x40, 0x01, 0x80, 
+	0x85, 0x01, 0x00, 0x02, 0x18, 0x80, 0x81, 0x02, 0x17, 0x80, 0x01, 0x80, 
+	0x85, 0x01, 0x80, 0x01, 0x19, 0x80, 0x01, 0x02, 0x17, 0xc0, 0x00, 0x80, 
+	0x86, 0x01, 0x42, 0x00, 0xc0, 0x01, 0x00, 0x02, 0x00, 0x02, 0x80, 0x02, 
+	0x9d, 0x41, 0x80, 0x01, 0x0c, 0xc1, 0xc1, 0x00, 0x1d, 0x41, 0x00, 0x01, 
+	0x06, 0x81, 0x42, 0x00, 0x1d, 0x41, 0x80, 0x00, 0x06, 0xc1, 0x42, 0x00, 
+	0x40, 0x01, 0x80, 0x01, 0x1d, 0x41, 0x00, 0x01, 0x06, 0x01, 0x43, 0x00, 
+	0x41, 0x41, 0x03, 0x00, 0x85, 0x01, 0x80, 0x02, 0xc1, 0x81, 0x03, 0x00, 
+	0x00, 0x02, 0x00, 0x00, 0x56, 0x01, 0x82, 0x02, 0x1d, 0x41, 0x00, 0x01, 
+	0x1f, 0x00, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x65, 0x74, 0x5f, 0x62, 0x75, 0x66, 
+	0x66, 0x65, 0x72, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x63, 0x61, 0x74, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x6e, 0x65, 
+	0x73, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 
+	0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 
+	0x66, 0x66, 0x65, 0x72, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x04, 0x06, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x63, 0x61, 0x6c, 0x6c, 
+	0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x65, 
+	0x6c, 0x65, 0x63, 0x74, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x00, 
+	0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x69, 0x6c, 
+	0x6c, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 
+	0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 
+	0x61, 0x74, 0x75, 0x73, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x27, 0x00, 0x04, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x27, 0x20, 0x65, 0x78, 0x69, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 
+	0x74, 0x68, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01, 
+	0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x36, 0x00, 0x00, 0x00, 0xd8, 0x05, 0x00, 0x00, 0xd8, 0x05, 
+	0x00, 0x00, 0xd8, 0x05, 0x00, 0x00, 0xd9, 0x05, 0x00, 0x00, 0xd9, 0x05, 
+	0x00, 0x00, 0xd9, 0x05, 0x00, 0x00, 0xd9, 0x05, 0x00, 0x00, 0xd9, 0x05, 
+	0x00, 0x00, 0xd9, 0x05, 0x00, 0x00, 0xda, 0x05, 0x00, 0x00, 0xda, 0x05, 
+	0x00, 0x00, 0xe0, 0x05, 0x00, 0x00, 0xe0, 0x05, 0x00, 0x00, 0xe0, 0x05, 
+	0x00, 0x00, 0xe0, 0x05, 0x00, 0x00, 0xe0, 0x05, 0x00, 0x00, 0xe0, 0x05, 
+	0x00, 0x00, 0xe1, 0x05, 0x00, 0x00, 0xe1, 0x05, 0x00, 0x00, 0xe3, 0x05, 
+	0x00, 0x00, 0xe3, 0x05, 0x00, 0x00, 0xe3, 0x05, 0x00, 0x00, 0xe3, 0x05, 
+	0x00, 0x00, 0xe4, 0x05, 0x00, 0x00, 0xe4, 0x05, 0x00, 0x00, 0xe4, 0x05, 
+	0x00, 0x00, 0xe6, 0x05, 0x00, 0x00, 0xe6, 0x05, 0x00, 0x00, 0xe6, 0x05, 
+	0x00, 0x00, 0xe6, 0x05, 0x00, 0x00, 0xe6, 0x05, 0x00, 0x00, 0xe6, 0x05, 
+	0x00, 0x00, 0xe6, 0x05, 0x00, 0x00, 0xe6, 0x05, 0x00, 0x00, 0xe6, 0x05, 
+	0x00, 0x00, 0xe7, 0x05, 0x00, 0x00, 0xe7, 0x05, 0x00, 0x00, 0xe7, 0x05, 
+	0x00, 0x00, 0xe7, 0x05, 0x00, 0x00, 0xeb, 0x05, 0x00, 0x00, 0xeb, 0x05, 
+	0x00, 0x00, 0xec, 0x05, 0x00, 0x00, 0xec, 0x05, 0x00, 0x00, 0xed, 0x05, 
+	0x00, 0x00, 0xed, 0x05, 0x00, 0x00, 0xed, 0x05, 0x00, 0x00, 0xef, 0x05, 
+	0x00, 0x00, 0xef, 0x05, 0x00, 0x00, 0xef, 0x05, 0x00, 0x00, 0xef, 0x05, 
+	0x00, 0x00, 0xef, 0x05, 0x00, 0x00, 0xef, 0x05, 0x00, 0x00, 0xef, 0x05, 
+	0x00, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x64, 0x65, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x74, 0x65, 0x78, 0x74, 0x00, 0x09, 0x00, 0x00, 0x00, 0x36, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 
+	0x61, 0x6d, 0x65, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x78, 0x00, 0x13, 
+	0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x70, 0x79, 0x00, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 0x68, 0x00, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x61, 0x72, 0x67, 0x65, 
+	0x74, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6d, 0x64, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x1a, 
+	0x00, 0x00, 0x00, 0xd1, 0x05, 0x00, 0x00, 0xd1, 0x05, 0x00, 0x00, 0xd2, 
+	0x05, 0x00, 0x00, 0xd2, 0x05, 0x00, 0x00, 0xd4, 0x05, 0x00, 0x00, 0xd4, 
+	0x05, 0x00, 0x00, 0xd4, 0x05, 0x00, 0x00, 0xd5, 0x05, 0x00, 0x00, 0xd5, 
+	0x05, 0x00, 0x00, 0xd5, 0x05, 0x00, 0x00, 0xd5, 0x05, 0x00, 0x00, 0xd7, 
+	0x05, 0x00, 0x00, 0xd7, 0x05, 0x00, 0x00, 0xd7, 0x05, 0x00, 0x00, 0xf0, 
+	0x05, 0x00, 0x00, 0xd7, 0x05, 0x00, 0x00, 0xf2, 0x05, 0x00, 0x00, 0xf2, 
+	0x05, 0x00, 0x00, 0xf3, 0x05, 0x00, 0x00, 0xf3, 0x05, 0x00, 0x00, 0xf3, 
+	0x05, 0x00, 0x00, 0xf3, 0x05, 0x00, 0x00, 0xf3, 0x05, 0x00, 0x00, 0xf3, 
+	0x05, 0x00, 0x00, 0xf3, 0x05, 0x00, 0x00, 0xf5, 0x05, 0x00, 0x00, 0x07, 
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 
+	0x6d, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x61, 0x72, 0x67, 0x65, 
+	0x74, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x04, 0x00, 0x00, 0x00, 
+	0x1a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x79, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x08, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x63, 0x72, 0x61, 0x74, 0x63, 
+	0x68, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x69, 0x64, 0x00, 0x10, 0x00, 
+	0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x65, 0x72, 0x72, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1a, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0xfb, 0x05, 0x00, 0x00, 0xfd, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x41, 0x40, 0x00, 0x00, 0x81, 0x80, 0x00, 0x00, 0x1d, 0x40, 
+	0x80, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x0c, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x75, 0x6e, 0x5f, 0x63, 
+	0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6b, 0x65, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x4d, 0x61, 0x6b, 0x65, 0x2a, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 
+	0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0xfc, 0x05, 
+	0x00, 0x00, 0xfc, 0x05, 0x00, 0x00, 0xfc, 0x05, 0x00, 0x00, 0xfc, 0x05, 
+	0x00, 0x00, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0x04, 0x06, 0x00, 0x00, 0x1f, 0x06, 0x00, 0x00, 0x00, 
+	0x00, 0x0d, 0x22, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x41, 0x40, 
+	0x00, 0x00, 0x1d, 0x80, 0x00, 0x01, 0x18, 0x80, 0x40, 0x00, 0x17, 0x80, 
+	0x00, 0x80, 0x46, 0xc0, 0x40, 0x00, 0x81, 0x40, 0x00, 0x00, 0x5d, 0x40, 
+	0x00, 0x01, 0x46, 0x00, 0x41, 0x00, 0x5d, 0x40, 0x80, 0x00, 0x46, 0x40, 
+	0x41, 0x00, 0x5d, 0x80, 0x80, 0x00, 0x86, 0x80, 0x41, 0x00, 0xc1, 0xc0, 
+	0x01, 0x00, 0x15, 0x01, 0x80, 0x00, 0x41, 0x01, 0x02, 0x00, 0x81, 0x41, 
+	0x02, 0x00, 0xd6, 0x80, 0x81, 0x01, 0x9d, 0x40, 0x00, 0x01, 0x86, 0x80, 
+	0x42, 0x00, 0xc0, 0x00, 0x80, 0x00, 0x9d, 0x00, 0x01, 0x01, 0x17, 0xc0, 
+	0x01, 0x80, 0xc6, 0x81, 0x41, 0x00, 0x01, 0xc2, 0x02, 0x00, 0x40, 0x02, 
+	0x80, 0x02, 0x81, 0x02, 0x03, 0x00, 0xc0, 0x02, 0x00, 0x03, 0x01, 0x43, 
+	0x02, 0x00, 0x16, 0x02, 0x03, 0x04, 0xdd, 0x41, 0x00, 0x01, 0xa2, 0x80, 
+	0x00, 0x00, 0x23, 0x41, 0xfd, 0x7f, 0x1f, 0x00, 0x80, 0x00, 0x0d, 0x00, 
+	0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x2a, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x2a, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0x04, 0x0e, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x72, 0x65, 0x61, 0x74, 
+	0x65, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6f, 0x66, 0x00, 0x04, 0x08, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 0x66, 0x66, 0x65, 
+	0x72, 0x73, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x54, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 
+	0x65, 0x20, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x00, 0x04, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x00, 
+	0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x75, 0x66, 
+	0x66, 0x65, 0x72, 0x20, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 
+	0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x22, 0x00, 0x00, 0x00, 0x08, 0x06, 
+	0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x09, 0x06, 
+	0x00, 0x00, 0x09, 0x06, 0x00, 0x00, 0x0a, 0x06, 0x00, 0x00, 0x0a, 0x06, 
+	0x00, 0x00, 0x0a, 0x06, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00, 0x10, 0x06, 
+	0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x16, 0x06, 
+	0x00, 0x00, 0x16, 0x06, 0x00, 0x00, 0x16, 0x06, 0x00, 0x00, 0x16, 0x06, 
+	0x00, 0x00, 0x16, 0x06, 0x00, 0x00, 0x16, 0x06, 0x00, 0x00, 0x16, 0x06, 
+	0x00, 0x00, 0x1b, 0x06, 0x00, 0x00, 0x1b, 0x06, 0x00, 0x00, 0x1b, 0x06, 
+	0x00, 0x00, 0x1b, 0x06, 0x00, 0x00, 0x1c, 0x06, 0x00, 0x00, 0x1c, 0x06, 
+	0x00, 0x00, 0x1c, 0x06, 0x00, 0x00, 0x1c, 0x06, 0x00, 0x00, 0x1c, 0x06, 
+	0x00, 0x00, 0x1c, 0x06, 0x00, 0x00, 0x1c, 0x06, 0x00, 0x00, 0x1c, 0x06, 
+	0x00, 0x00, 0x1b, 0x06, 0x00, 0x00, 0x1b, 0x06, 0x00, 0x00, 0x1f, 0x06, 
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x62, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x10, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 
+	0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x16, 
+	0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 
+	0x65, 0x29, 0x00, 0x16, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0e, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 
+	0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x16, 0x00, 0x00, 
+	0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x69, 0x00, 0x17, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x17, 0x00, 0x00, 
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x26, 0x06, 
+	0x00, 0x00, 0x46, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x63, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x1d, 0x80, 0x80, 0x00, 0x46, 0x40, 0x40, 
+	0x00, 0x81, 0x80, 0x00, 0x00, 0x5d, 0x80, 0x00, 0x01, 0x58, 0xc0, 0xc0, 
+	0x00, 0x17, 0x40, 0x00, 0x80, 0x46, 0x00, 0x41, 0x00, 0x5d, 0x40, 0x80, 
+	0x00, 0x46, 0x40, 0x41, 0x00, 0x81, 0x80, 0x00, 0x00, 0x5d, 0x40, 0x00, 
+	0x01, 0x46, 0x80, 0x41, 0x00, 0x86, 0xc0, 0x41, 0x00, 0x87, 0x00, 0x42, 
+	0x01, 0xc1, 0x40, 0x02, 0x00, 0x01, 0x81, 0x02, 0x00, 0x41, 0xc1, 0x02, 
+	0x00, 0x81, 0x01, 0x03, 0x00, 0xc1, 0x41, 0x03, 0x00, 0x01, 0x82, 0x03, 
+	0x00, 0x9d, 0x00, 0x80, 0x03, 0x5d, 0x40, 0x00, 0x00, 0x46, 0xc0, 0x43, 
+	0x00, 0x87, 0x00, 0x44, 0x00, 0x5d, 0x00, 0x01, 0x01, 0x17, 0x80, 0x02, 
+	0x80, 0x86, 0x81, 0x41, 0x00, 0xc6, 0xc1, 0x41, 0x00, 0xc7, 0x01, 0xc2, 
+	0x03, 0x01, 0x42, 0x04, 0x00, 0x47, 0x82, 0xc4, 0x02, 0x87, 0xc2, 0xc4, 
+	0x02, 0xc7, 0x02, 0xc5, 0x02, 0x07, 0x43, 0xc3, 0x02, 0x47, 0x43, 0xc5, 
+	0x02, 0xdd, 0x01, 0x80, 0x03, 0x9d, 0x41, 0x00, 0x00, 0x62, 0x80, 0x00, 
+	0x00, 0xe3, 0x80, 0xfc, 0x7f, 0x46, 0x80, 0x41, 0x00, 0x81, 0x80, 0x05, 
+	0x00, 0x5d, 0x40, 0x00, 0x01, 0x46, 0x80, 0x41, 0x00, 0x86, 0xc0, 0x41, 
+	0x00, 0x87, 0x00, 0x42, 0x01, 0xc1, 0xc0, 0x05, 0x00, 0x01, 0x01, 0x06, 
+	0x00, 0x41, 0x41, 0x06, 0x00, 0x9d, 0x00, 0x00, 0x02, 0x5d, 0x40, 0x00, 
+	0x00, 0x46, 0x80, 0x41, 0x00, 0x86, 0xc0, 0x41, 0x00, 0x87, 0x00, 0x42, 
+	0x01, 0xc1, 0x80, 0x06, 0x00, 0x01, 0xc1, 0x06, 0x00, 0x47, 0x01, 0x47, 
+	0x00, 0x50, 0x41, 0xc7, 0x02, 0x9d, 0x00, 0x00, 0x02, 0x5d, 0x40, 0x00, 
+	0x00, 0x47, 0x80, 0x47, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x40, 0x04, 
+	0x80, 0x46, 0x80, 0x41, 0x00, 0x86, 0xc0, 0x41, 0x00, 0x87, 0x00, 0x42, 
+	0x01, 0xc1, 0x80, 0x06, 0x00, 0x01, 0xc1, 0x07, 0x00, 0x47, 0x01, 0x48, 
+	0x00, 0x50, 0x41, 0xc7, 0x02, 0x9d, 0x00, 0x00, 0x02, 0x5d, 0x40, 0x00, 
+	0x00, 0x46, 0x80, 0x41, 0x00, 0x86, 0xc0, 0x41, 0x00, 0x87, 0x00, 0x42, 
+	0x01, 0xc1, 0x80, 0x06, 0x00, 0x01, 0x41, 0x08, 0x00, 0x47, 0x81, 0x47, 
+	0x00, 0x50, 0x41, 0xc7, 0x02, 0x9d, 0x00, 0x00, 0x02, 0x5d, 0x40, 0x00, 
+	0x00, 0x46, 0xc0, 0x43, 0x00, 0x87, 0x80, 0x48, 0x00, 0x5d, 0x00, 0x01, 
+	0x01, 0x17, 0x00, 0x02, 0x80, 0x86, 0x81, 0x41, 0x00, 0xc6, 0xc1, 0x41, 
+	0x00, 0xc7, 0x01, 0xc2, 0x03, 0x01, 0x82, 0x06, 0x00, 0x47, 0x82, 0xc4, 
+	0x02, 0x87, 0xc2, 0xc8, 0x02, 0x90, 0x42, 0x47, 0x05, 0xdd, 0x01, 0x00, 
+	0x02, 0x9d, 0x41, 0x00, 0x00, 0x62, 0x80, 0x00, 0x00, 0xe3, 0x00, 0xfd, 
+	0x7f, 0x46, 0x00, 0x49, 0x00, 0x5d, 0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 
+	0x00, 0x25, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x73, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 
+	0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x53, 0x74, 
+	0x61, 0x74, 0x73, 0x2a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0xf0, 0xbf, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 
+	0x69, 0x6c, 0x6c, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 
+	0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x72, 0x65, 0x61, 
+	0x74, 0x65, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 
+	0x74, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x00, 0x04, 0x1a, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2d, 0x31, 0x30, 0x73, 
+	0x20, 0x25, 0x38, 0x73, 0x20, 0x25, 0x31, 0x30, 0x73, 0x20, 0x25, 0x31, 
+	0x30, 0x73, 0x20, 0x25, 0x31, 0x30, 0x73, 0x0a, 0x00, 0x04, 0x06, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x68, 0x61, 0x73, 0x65, 0x00, 
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x6f, 0x75, 
+	0x6e, 0x74, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x4d, 0x65, 0x61, 0x6e, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x70, 0x39, 0x39, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x4d, 0x61, 0x78, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x68, 0x61, 0x73, 
+	0x65, 0x73, 0x00, 0x04, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x25, 0x2d, 0x31, 0x30, 0x73, 0x20, 0x25, 0x38, 0x64, 0x20, 0x25, 0x38, 
+	0x2e, 0x33, 0x66, 0x6d, 0x73, 0x20, 0x25, 0x38, 0x2e, 0x33, 0x66, 0x6d, 
+	0x73, 0x20, 0x25, 0x38, 0x2e, 0x33, 0x66, 0x6d, 0x73, 0x0a, 0x00, 0x04, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x61, 0x6d, 0x65, 
+	0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 
+	0x75, 0x6e, 0x74, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6d, 0x65, 0x61, 0x6e, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6d, 0x61, 0x78, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x25, 0x2d, 0x33, 0x30, 0x73, 0x20, 0x25, 0x31, 0x30, 
+	0x73, 0x0a, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x4b, 0x42, 0x00, 0x04, 0x0e, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x25, 0x2d, 0x33, 0x30, 0x73, 0x20, 0x25, 0x31, 
+	0x30, 0x2e, 0x31, 0x66, 0x0a, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x4c, 0x75, 0x61, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6c, 0x75, 0x61, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x90, 0x40, 0x04, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x70, 0x6f, 0x6f, 0x6c, 0x5f, 0x72, 0x65, 0x73, 0x65, 0x72, 
+	0x76, 0x65, 0x64, 0x00, 0x04, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x4c, 0x75, 0x61, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 
+	0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x6f, 0x6f, 0x6c, 0x5f, 0x75, 0x73, 0x65, 
+	0x64, 0x00, 0x04, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 
+	0x75, 0x61, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6f, 0x62, 0x6a, 
+	0x65, 0x63, 0x74, 0x20, 0x73, 0x6c, 0x61, 0x62, 0x73, 0x00, 0x04, 0x08, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 0x66, 0x66, 0x65, 
+	0x72, 0x73, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x6f, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x63, 0x00, 0x00, 0x00, 0x27, 0x06, 0x00, 0x00, 0x27, 0x06, 0x00, 
+	0x00, 0x2c, 0x06, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x00, 0x2c, 0x06, 0x00, 
+	0x00, 0x2c, 0x06, 0x00, 0x00, 0x2c, 0x06, 0x00, 0x00, 0x2d, 0x06, 0x00, 
+	0x00, 0x2d, 0x06, 0x00, 0x00, 0x2f, 0x06, 0x00, 0x00, 0x2f, 0x06, 0x00, 
+	0x00, 0x2f, 0x06, 0x00, 0x00, 0x31, 0x06, 0x00, 0x00, 0x31, 0x06, 0x00, 
+	0x00, 0x31, 0x06, 0x00, 0x00, 0x31, 0x06, 0x00, 0x00, 0x31, 0x06, 0x00, 
+	0x00, 0x31, 0x06, 0x00, 0x00, 0x31, 0x06, 0x00, 0x00, 0x31, 0x06, 0x00, 
+	0x00, 0x31, 0x06, 0x00, 0x00, 0x31, 0x06, 0x00, 0x00, 0x31, 0x06, 0x00, 
+	0x00, 0x33, 0x06, 0x00, 0x00, 0x33, 0x06, 0x00, 0x00, 0x33, 0x06, 0x00, 
+	0x00, 0x33, 0x06, 0x00, 0x00, 0x34, 0x06, 0x00, 0x00, 0x34, 0x06, 0x00, 
+	0x00, 0x34, 0x06, 0x00, 0x00, 0x34, 0x06, 0x00, 0x00, 0x35, 0x06, 0x00, 
+	0x00, 0x35, 0x06, 0x00, 0x00, 0x35, 0x06, 0x00, 0x00, 0x35, 0x06, 0x00, 
+	0x00, 0x35, 0x06, 0x00, 0x00, 0x34, 0x06, 0x00, 0x00, 0x34, 0x06, 0x00, 
+	0x00, 0x33, 0x06, 0x00, 0x00, 0x33, 0x06, 0x00, 0x00, 0x38, 0x06, 0x00, 
+	0x00, 0x38, 0x06, 0x00, 0x00, 0x38, 0x06, 0x00, 0x00, 0x39, 0x06, 0x00, 
+	0x00, 0x39, 0x06, 0x00, 0x00, 0x39, 0x06, 0x00, 0x00, 0x39, 0x06, 0x00, 
+	0x00, 0x39, 0x06, 0x00, 0x00, 0x39, 0x06, 0x00, 0x00, 0x39, 0x06, 0x00, 
+	0x00, 0x39, 0x06, 0x00, 0x00, 0x3a, 0x06, 0x00, 0x00, 0x3a, 0x06, 0x00, 
+	0x00, 0x3a, 0x06, 0x00, 0x00, 0x3a, 0x06, 0x00, 0x00, 0x3a, 0x06, 0x00, 
+	0x00, 0x3a, 0x06, 0x00, 0x00, 0x3a, 0x06, 0x00, 0x00, 0x3a, 0x06, 0x00, 
+	0x00, 0x3a, 0x06, 0x00, 0x00, 0x3c, 0x06, 0x00, 0x00, 0x3c, 0x06, 0x00, 
+	0x00, 0x3c, 0x06, 0x00, 0x00, 0x3d, 0x06, 0x00, 0x00, 0x3d, 0x06, 0x00, 
+	0x00, 0x3d, 0x06, 0x00, 0x00, 0x3d, 0x06, 0x00, 0x00, 0x3d, 0x06, 0x00, 
+	0x00, 0x3d, 0x06, 0x00, 0x00, 0x3d, 0x06, 0x00, 0x00, 0x3d, 0x06, 0x00, 
+	0x00, 0x3d, 0x06, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x3e, 0x06, 0x00, 
+	0x00, 0x3e, 0x06, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x3e, 0x06, 0x00, 
+	0x00, 0x3e, 0x06, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x3e, 0x06, 0x00, 
+	0x00, 0x3e, 0x06, 0x00, 0x00, 0x41, 0x06, 0x00, 0x00, 0x41, 0x06, 0x00, 
+	0x00, 0x41, 0x06, 0x00, 0x00, 0x41, 0x06, 0x00, 0x00, 0x42, 0x06, 0x00, 
+	0x00, 0x42, 0x06, 0x00, 0x00, 0x42, 0x06, 0x00, 0x00, 0x42, 0x06, 0x00, 
+	0x00, 0x42, 0x06, 0x00, 0x00, 0x42, 0x06, 0x00, 0x00, 0x42, 0x06, 0x00, 
+	0x00, 0x42, 0x06, 0x00, 0x00, 0x42, 0x06, 0x00, 0x00, 0x41, 0x06, 0x00, 
+	0x00, 0x41, 0x06, 0x00, 0x00, 0x45, 0x06, 0x00, 0x00, 0x45, 0x06, 0x00, 
+	0x00, 0x46, 0x06, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
+	0x66, 0x6f, 0x72, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 
+	0x72, 0x29, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 
+	0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x28, 
+	0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
+	0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 
+	0x00, 0x1a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x26, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
+	0x00, 0x1b, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x65, 
+	0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x54, 0x00, 0x00, 
+	0x00, 0x60, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 
+	0x00, 0x54, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 
+	0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x54, 0x00, 0x00, 0x00, 0x60, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x00, 0x55, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x55, 0x00, 0x00, 0x00, 0x5e, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x50, 0x06, 0x00, 0x00, 
+	0x5f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1a, 0x00, 0x00, 0x00, 0x06, 
+	0x00, 0x40, 0x00, 0x1d, 0x80, 0x80, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x17, 
+	0xc0, 0x00, 0x80, 0x06, 0x40, 0x40, 0x00, 0x41, 0x80, 0x00, 0x00, 0x1d, 
+	0x40, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x06, 0xc0, 0x40, 0x00, 0x1d, 
+	0x80, 0x80, 0x00, 0x46, 0x00, 0x41, 0x00, 0x81, 0x40, 0x01, 0x00, 0x5d, 
+	0x80, 0x00, 0x01, 0x58, 0x80, 0xc1, 0x00, 0x17, 0x40, 0x00, 0x80, 0x46, 
+	0xc0, 0x41, 0x00, 0x5d, 0x40, 0x80, 0x00, 0x46, 0x00, 0x42, 0x00, 0x81, 
+	0x40, 0x01, 0x00, 0x5d, 0x40, 0x00, 0x01, 0x46, 0x40, 0x42, 0x00, 0x80, 
+	0x00, 0x00, 0x00, 0x5d, 0x40, 0x00, 0x01, 0x46, 0x80, 0x42, 0x00, 0x5d, 
+	0x40, 0x80, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 
+	0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x72, 0x6f, 0x66, 
+	0x69, 0x6c, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74, 0x75, 
+	0x73, 0x00, 0x04, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
+	0x72, 0x6f, 0x66, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x74, 0x61, 
+	0x72, 0x74, 0x65, 0x64, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x70, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 0x5f, 0x73, 0x74, 
+	0x6f, 0x70, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x2a, 0x50, 0x72, 0x6f, 0x66, 0x69, 0x6c, 0x65, 
+	0x2a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0x04, 
+	0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x69, 0x6c, 0x6c, 
+	0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x0e, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x5f, 
+	0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x00, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x6f, 0x66, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 
+	0x2e, 0x6c, 0x75, 0x61, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x51, 0x06, 0x00, 
+	0x00, 0x51, 0x06, 0x00, 0x00, 0x51, 0x06, 0x00, 0x00, 0x51, 0x06, 0x00, 
+	0x00, 0x52, 0x06, 0x00, 0x00, 0x52, 0x06, 0x00, 0x00, 0x52, 0x06, 0x00, 
+	0x00, 0x53, 0x06, 0x00, 0x00, 0x56, 0x06, 0x00, 0x00, 0x56, 0x06, 0x00, 
+	0x00, 0x58, 0x06, 0x00, 0x00, 0x58, 0x06, 0x00, 0x00, 0x58, 0x06, 0x00, 
+	0x00, 0x58, 0x06, 0x00, 0x00, 0x58, 0x06, 0x00, 0x00, 0x59, 0x06, 0x00, 
+	0x00, 0x59, 0x06, 0x00, 0x00, 0x5b, 0x06, 0x00, 0x00, 0x5b, 0x06, 0x00, 
+	0x00, 0x5b, 0x06, 0x00, 0x00, 0x5d, 0x06, 0x00, 0x00, 0x5d, 0x06, 0x00, 
+	0x00, 0x5d, 0x06, 0x00, 0x00, 0x5e, 0x06, 0x00, 0x00, 0x5e, 0x06, 0x00, 
+	0x00, 0x5f, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x64, 0x00, 
+	0x0a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 
+	0x00, 0x65, 0x06, 0x00, 0x00, 0x88, 0x06, 0x00, 0x00, 0x01, 0x00, 0x0d, 
+	0x27, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x81, 0x40, 0x00, 0x00, 
+	0x5d, 0x80, 0x00, 0x01, 0x18, 0x80, 0xc0, 0x00, 0x17, 0x80, 0x00, 0x80, 
+	0x86, 0xc0, 0x40, 0x00, 0xc1, 0x40, 0x00, 0x00, 0x9d, 0x40, 0x00, 0x01, 
+	0x86, 0x00, 0x41, 0x00, 0x9d, 0x40, 0x80, 0x00, 0x58, 0x40, 0x41, 0x00, 
+	0x17, 0x40, 0x00, 0x80, 0x18, 0x80, 0x41, 0x00, 0x17, 0x00, 0x00, 0x80, 
+	0x01, 0xc0, 0x01, 0x00, 0x86, 0x00, 0x42, 0x00, 0xc0, 0x00, 0x00, 0x00, 
+	0x9d, 0x80, 0x00, 0x01, 0xc6, 0x40, 0x42, 0x00, 0x01, 0x81, 0x02, 0x00, 
+	0x55, 0x01, 0x00, 0x01, 0x81, 0xc1, 0x02, 0x00, 0xc1, 0x01, 0x03, 0x00, 
+	0x16, 0xc1, 0x01, 0x02, 0xdd, 0x40, 0x00, 0x01, 0xc6, 0x40, 0x43, 0x00, 
+	0x00, 0x01, 0x00, 0x01, 0xdd, 0x00, 0x01, 0x01, 0x17, 0x80, 0x01, 0x80, 
+	0x06, 0x42, 0x42, 0x00, 0x40, 0x02, 0x00, 0x03, 0x81, 0x82, 0x03, 0x00, 
+	0xc0, 0x02, 0x80, 0x03, 0x01, 0x03, 0x03, 0x00, 0x56, 0x02, 0x83, 0x04, 
+	0x1d, 0x42, 0x00, 0x01, 0xe2, 0x80, 0x00, 0x00, 0x63, 0x81, 0xfd, 0x7f, 
+	0x1f, 0x00, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x6c, 0x73, 
+	0x2a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0x04, 
+	0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x72, 0x65, 0x61, 
+	0x74, 0x65, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00, 0x04, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6f, 0x66, 0x00, 0x00, 
+	0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x65, 0x74, 0x63, 0x00, 
+	0x04, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x69, 0x72, 
+	0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x65, 0x6e, 0x74, 0x72, 0x69, 
+	0x65, 0x73, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x54, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 
+	0x65, 0x20, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x2d, 0x3e, 0x20, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 
+	0x2e, 0x6c, 0x75, 0x61, 0x00, 0x27, 0x00, 0x00, 0x00, 0x6a, 0x06, 0x00, 
+	0x00, 0x6a, 0x06, 0x00, 0x00, 0x6a, 0x06, 0x00, 0x00, 0x6b, 0x06, 0x00, 
+	0x00, 0x6b, 0x06, 0x00, 0x00, 0x6c, 0x06, 0x00, 0x00, 0x6c, 0x06, 0x00, 
+	0x00, 0x6c, 0x06, 0x00, 0x00, 0x72, 0x06, 0x00, 0x00, 0x72, 0x06, 0x00, 
+	0x00, 0x77, 0x06, 0x00, 0x00, 0x77, 0x06, 0x00, 0x00, 0x77, 0x06, 0x00, 
+	0x00, 0x77, 0x06, 0x00, 0x00, 0x78, 0x06, 0x00, 0x00, 0x7e, 0x06, 0x00, 
+	0x00, 0x7e, 0x06, 0x00, 0x00, 0x7e, 0x06, 0x00, 0x00, 0x7f, 0x06, 0x00, 
+	0x00, 0x7f, 0x06, 0x00, 0x00, 0x7f, 0x06, 0x00, 0x00, 0x7f, 0x06, 0x00, 
+	0x00, 0x7f, 0x06, 0x00, 0x00, 0x7f, 0x06, 0x00, 0x00, 0x7f, 0x06, 0x00, 
+	0x00, 0x84, 0x06, 0x00, 0x00, 0x84, 0x06, 0x00, 0x00, 0x84, 0x06, 0x00, 
+	0x00, 0x84, 0x06, 0x00, 0x00, 0x85, 0x06, 0x00, 0x00, 0x85, 0x06, 0x00, 
+	0x00, 0x85, 0x06, 0x00, 0x00, 0x85, 0x06, 0x00, 0x00, 0x85, 0x06, 0x00, 
+	0x00, 0x85, 0x06, 0x00, 0x00, 0x85, 0x06, 0x00, 0x00, 0x84, 0x06, 0x00, 
+	0x00, 0x84, 0x06, 0x00, 0x00, 0x88, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x74, 
+	0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x12, 0x00, 0x00, 0x00, 0x27, 
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
+	0x66, 0x6f, 0x72, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 
+	0x72, 0x29, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0c, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 
+	0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x26, 
+	0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 
+	0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 
+	0x00, 0x1c, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x24, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 
+	0x00, 0x1d, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 
+	0x56, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x6b, 0x69, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x70, 0x01, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b, 
+	0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4c, 
+	0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4c, 
+	0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4d, 
+	0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 
+	0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x5a, 
+	0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x79, 
+	0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x7f, 
+	0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7f, 
+	0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 
+	0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 
+	0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x8a, 
+	0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a, 
+	0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 
+	0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x90, 
+	0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x91, 
+	0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x91, 
+	0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x92, 
+	0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 
+	0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x94, 
+	0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x94, 
+	0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 
+	0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 
+	0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x97, 
+	0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x97, 
+	0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x98, 
+	0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x99, 
+	0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x9a, 
+	0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x9a, 
+	0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9b, 
+	0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x9c, 
+	0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x9d, 
+	0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x9e, 
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 
+	0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xaa, 
+	0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xaa, 
+	0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xba, 
+	0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xc0, 
+	0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xcb, 
+	0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xcb, 
+	0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xcc, 
+	0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcd, 
+	0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xd1, 
+	0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xd1, 
+	0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xd2, 
+	0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd3, 
+	0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd8, 
+	0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xd8, 
+	0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xd9, 
+	0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0xda, 
+	0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00, 0xdb, 
+	0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdb, 
+	0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdc, 
+	0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0xdd, 
+	0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0xde, 
+	0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0xde, 
+	0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xdf, 
+	0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe0, 
+	0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe5, 
+	0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe5, 
+	0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0xea, 
+	0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xef, 
+	0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xfe, 
+	0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfe, 
+	0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 
+	0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 
+	0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 
+	0x01, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x0b, 
+	0x01, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x0c, 
+	0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x0d, 
+	0x01, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x0d, 
+	0x01, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x13, 
+	0x01, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x13, 
+	0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x14, 
+	0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x15, 
+	0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x6a, 
+	0x01, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x75, 0x01, 0x00, 0x00, 0x73, 
+	0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00, 0xcd, 
+	0x01, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x00, 0xda, 
+	0x01, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x00, 0x0c, 
+	0x02, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x34, 
+	0x02, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x3a, 
+	0x02, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x77, 
+	0x02, 0x00, 0x00, 0x5b, 0x02, 0x00, 0x00, 0x95, 0x02, 0x00, 0x00, 0x8c, 
+	0x02, 0x00, 0x00, 0xb1, 0x02, 0x00, 0x00, 0xa5, 0x02, 0x00, 0x00, 0xe3, 
+	0x02, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0xf1, 
+	0x02, 0x00, 0x00, 0x39, 0x03, 0x00, 0x00, 0x11, 0x03, 0x00, 0x00, 0x4a, 
+	0x03, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x5f, 0x03, 0x00, 0x00, 0x51, 
+	0x03, 0x00, 0x00, 0xa3, 0x03, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x00, 0xb2, 
+	0x03, 0x00, 0x00, 0xa9, 0x03, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00, 0xb7, 
+	0x03, 0x00, 0x00, 0xf2, 0x03, 0x00, 0x00, 0xcc, 0x03, 0x00, 0x00, 0x09, 
+	0x04, 0x00, 0x00, 0xfb, 0x03, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 0x1b, 
+	0x04, 0x00, 0x00, 0x3e, 0x04, 0x00, 0x00, 0x3e, 0x04, 0x00, 0x00, 0x3e, 
+	0x04, 0x00, 0x00, 0x3f, 0x04, 0x00, 0x00, 0x3f, 0x04, 0x00, 0x00, 0x3f, 
+	0x04, 0x00, 0x00, 0x3f, 0x04, 0x00, 0x00, 0x41, 0x04, 0x00, 0x00, 0x41, 
+	0x04, 0x00, 0x00, 0x42, 0x04, 0x00, 0x00, 0x47, 0x04, 0x00, 0x00, 0x42, 
+	0x04, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00, 0x4a, 0x04, 0x00, 0x00, 0x4a, 
+	0x04, 0x00, 0x00, 0x4a, 0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x4c, 
+	0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x4c, 
+	0x04, 0x00, 0x00, 0x53, 0x04, 0x00, 0x00, 0x4d, 0x04, 0x00, 0x00, 0x57, 
+	0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x58, 0x04, 0x00, 0x00, 0x59, 
+	0x04, 0x00, 0x00, 0x66, 0x04, 0x00, 0x00, 0x66, 0x04, 0x00, 0x00, 0x66, 
+	0x04, 0x00, 0x00, 0x66, 0x04, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00, 0x78, 
+	0x04, 0x00, 0x00, 0x78, 0x04, 0x00, 0x00, 0x79, 0x04, 0x00, 0x00, 0x79, 
+	0x04, 0x00, 0x00, 0x79, 0x04, 0x00, 0x00, 0xf7, 0x04, 0x00, 0x00, 0x88, 
+	0x04, 0x00, 0x00, 0x0a, 0x05, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x17, 
+	0x05, 0x00, 0x00, 0x11, 0x05, 0x00, 0x00, 0x38, 0x05, 0x00, 0x00, 0x22, 
+	0x05, 0x00, 0x00, 0x47, 0x05, 0x00, 0x00, 0x47, 0x05, 0x00, 0x00, 0x47, 
+	0x05, 0x00, 0x00, 0x47, 0x05, 0x00, 0x00, 0x47, 0x05, 0x00, 0x00, 0x47, 
+	0x05, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x48, 
+	0x05, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x48, 
+	0x05, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x48, 
+	0x05, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 0x62, 
+	0x05, 0x00, 0x00, 0x4b, 0x05, 0x00, 0x00, 0x96, 0x05, 0x00, 0x00, 0x72, 
+	0x05, 0x00, 0x00, 0x9d, 0x05, 0x00, 0x00, 0x9d, 0x05, 0x00, 0x00, 0x9d, 
+	0x05, 0x00, 0x00, 0x9d, 0x05, 0x00, 0x00, 0x9d, 0x05, 0x00, 0x00, 0xc4, 
+	0x05, 0x00, 0x00, 0xb2, 0x05, 0x00, 0x00, 0xce, 0x05, 0x00, 0x00, 0xf5, 
+	0x05, 0x00, 0x00, 0xd0, 0x05, 0x00, 0x00, 0xfd, 0x05, 0x00, 0x00, 0xfb, 
+	0x05, 0x00, 0x00, 0x1f, 0x06, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x46, 
+	0x06, 0x00, 0x00, 0x26, 0x06, 0x00, 0x00, 0x5f, 0x06, 0x00, 0x00, 0x50, 
+	0x06, 0x00, 0x00, 0x88, 0x06, 0x00, 0x00, 0x65, 0x06, 0x00, 0x00, 0x88, 
+	0x06, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x74, 0x65, 
+	0x72, 0x6d, 0x00, 0x11, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x6b, 0x00, 0x20, 0x01, 
+	0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x66, 0x66, 0x69, 0x00, 0x20, 0x01, 0x00, 0x00, 0x34, 0x01, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 
+	0x26, 0x01, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x00, 0x29, 0x01, 0x00, 0x00, 
+	0x33, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x00, 
+};
+unsigned int kilua_luac_len = 36885;
+unsigned char syntax_cc_luac[] = {
+	0x1b, 0x4c, 0x75, 0x61, 0x52, 0x00, 0x01, 0x04, 0x08, 0x04, 0x08, 0x00, 
+	0x19, 0x93, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x35, 0xc1, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x40, 0x00, 0x00, 0x1d, 0x80, 0x00, 0x01, 0x4b, 0x00, 0x00, 
+	0x00, 0x81, 0x80, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x08, 0xc0, 0x80, 
+	0x81, 0xc6, 0x00, 0x41, 0x00, 0xc7, 0x40, 0xc1, 0x01, 0x06, 0x01, 0x41, 
+	0x00, 0x07, 0x81, 0x41, 0x02, 0x46, 0x01, 0x41, 0x00, 0x47, 0xc1, 0xc1, 
+	0x02, 0x86, 0x01, 0x41, 0x00, 0x87, 0x01, 0x42, 0x03, 0xc7, 0x41, 0x42, 
+	0x00, 0xdd, 0x81, 0x80, 0x00, 0x25, 0x42, 0x00, 0x00, 0xd0, 0x01, 0x82, 
+	0x03, 0x00, 0x02, 0x80, 0x01, 0x41, 0x82, 0x02, 0x00, 0x1d, 0x82, 0x00, 
+	0x01, 0x12, 0xc2, 0x42, 0x04, 0x40, 0x02, 0x80, 0x01, 0x81, 0x02, 0x03, 
+	0x00, 0x5d, 0x82, 0x00, 0x01, 0x0f, 0x42, 0x02, 0x04, 0x40, 0x02, 0x80, 
+	0x01, 0x81, 0x42, 0x03, 0x00, 0x5d, 0x82, 0x00, 0x01, 0x80, 0x02, 0x80, 
+	0x01, 0xc1, 0x82, 0x03, 0x00, 0x9d, 0x82, 0x00, 0x01, 0x4f, 0x82, 0x82, 
+	0x04, 0x80, 0x02, 0x80, 0x02, 0xc1, 0xc2, 0x03, 0x00, 0x9d, 0x82, 0x00, 
+	0x01, 0x8e, 0x82, 0x02, 0x87, 0x4d, 0x82, 0x82, 0x04, 0x52, 0x82, 0xc3, 
+	0x04, 0x0f, 0x42, 0x02, 0x04, 0x40, 0x02, 0x80, 0x01, 0x81, 0x02, 0x03, 
+	0x00, 0x5d, 0x82, 0x00, 0x01, 0x0f, 0x42, 0x02, 0x04, 0x40, 0x02, 0x80, 
+	0x01, 0x81, 0x82, 0x02, 0x00, 0x5d, 0x82, 0x00, 0x01, 0x52, 0xc2, 0xc2, 
+	0x04, 0x80, 0x02, 0x80, 0x01, 0xc1, 0x02, 0x04, 0x00, 0x9d, 0x82, 0x00, 
+	0x01, 0x4f, 0x82, 0x82, 0x04, 0x80, 0x02, 0x80, 0x01, 0xc1, 0x42, 0x03, 
+	0x00, 0x9d, 0x82, 0x00, 0x01, 0xc0, 0x02, 0x80, 0x01, 0x01, 0x83, 0x03, 
+	0x00, 0xdd, 0x82, 0x00, 0x01, 0x8f, 0xc2, 0x02, 0x05, 0xc0, 0x02, 0x80, 
+	0x02, 0x01, 0x43, 0x04, 0x00, 0xdd, 0x82, 0x00, 0x01, 0xce, 0xc2, 0x02, 
+	0x87, 0x8d, 0xc2, 0x02, 0x05, 0x92, 0x82, 0x44, 0x05, 0x4f, 0x82, 0x82, 
+	0x04, 0x80, 0x02, 0x80, 0x01, 0xc1, 0x02, 0x04, 0x00, 0x9d, 0x82, 0x00, 
+	0x01, 0x4f, 0x82, 0x82, 0x04, 0x8d, 0x42, 0x02, 0x04, 0xe5, 0x82, 0x00, 
+	0x00, 0x90, 0xc2, 0x02, 0x05, 0xc0, 0x02, 0x80, 0x01, 0x01, 0xc3, 0x04, 
+	0x00, 0xdd, 0x82, 0x00, 0x01, 0x00, 0x03, 0x80, 0x01, 0x41, 0x03, 0x05, 
+	0x00, 0x1d, 0x83, 0x00, 0x01, 0x0e, 0x03, 0x03, 0x87, 0x12, 0x83, 0x44, 
+	0x06, 0xcf, 0x02, 0x83, 0x05, 0x00, 0x03, 0x80, 0x01, 0x41, 0x03, 0x05, 
+	0x00, 0x1d, 0x83, 0x00, 0x01, 0xcf, 0x02, 0x83, 0x05, 0x00, 0x03, 0x80, 
+	0x01, 0x41, 0x43, 0x05, 0x00, 0x1d, 0x83, 0x00, 0x01, 0x40, 0x03, 0x80, 
+	0x01, 0x81, 0x83, 0x05, 0x00, 0x5d, 0x83, 0x00, 0x01, 0x4e, 0x43, 0x03, 
+	0x87, 0x52, 0x83, 0xc4, 0x06, 0x0f, 0x43, 0x03, 0x06, 0x4d, 0x03, 0x83, 
+	0x05, 0xa5, 0xc3, 0x00, 0x00, 0x50, 0x83, 0x83, 0x06, 0x80, 0x03, 0x80, 
+	0x02, 0xc1, 0xc3, 0x05, 0x00, 0x9d, 0x83, 0x00, 0x01, 0x92, 0x83, 0x43, 
+	0x07, 0xc0, 0x03, 0x80, 0x02, 0x01, 0x84, 0x05, 0x00, 0xdd, 0x83, 0x00, 
+	0x01, 0x8f, 0xc3, 0x03, 0x07, 0xe5, 0x03, 0x01, 0x00, 0x90, 0xc3, 0x03, 
+	0x07, 0xcd, 0x43, 0x02, 0x04, 0x25, 0x44, 0x01, 0x00, 0xd0, 0x03, 0x84, 
+	0x07, 0x07, 0x04, 0x46, 0x00, 0x4b, 0x04, 0x80, 0x0c, 0x81, 0x44, 0x06, 
+	0x00, 0xc1, 0x84, 0x06, 0x00, 0x01, 0xc5, 0x06, 0x00, 0x41, 0x05, 0x07, 
+	0x00, 0x81, 0x45, 0x07, 0x00, 0xc1, 0x85, 0x07, 0x00, 0x01, 0xc6, 0x07, 
+	0x00, 0x41, 0x06, 0x08, 0x00, 0x81, 0x46, 0x08, 0x00, 0xc1, 0x86, 0x08, 
+	0x00, 0x01, 0xc7, 0x08, 0x00, 0x41, 0x07, 0x09, 0x00, 0x81, 0x47, 0x09, 
+	0x00, 0xc1, 0x87, 0x09, 0x00, 0x01, 0xc8, 0x09, 0x00, 0x41, 0x08, 0x0a, 
+	0x00, 0x81, 0x48, 0x0a, 0x00, 0xc1, 0x88, 0x0a, 0x00, 0x01, 0xc9, 0x0a, 
+	0x00, 0x41, 0x09, 0x0b, 0x00, 0x81, 0x49, 0x0b, 0x00, 0xc1, 0x89, 0x0b, 
+	0x00, 0x01, 0xca, 0x0b, 0x00, 0x41, 0x0a, 0x0c, 0x00, 0x81, 0x4a, 0x0c, 
+	0x00, 0xc1, 0x8a, 0x0c, 0x00, 0x01, 0xcb, 0x0c, 0x00, 0x41, 0x0b, 0x0d, 
+	0x00, 0x81, 0x4b, 0x0d, 0x00, 0xc1, 0x8b, 0x0d, 0x00, 0x01, 0xcc, 0x0d, 
+	0x00, 0x41, 0x0c, 0x0e, 0x00, 0x81, 0x4c, 0x0e, 0x00, 0xc1, 0x8c, 0x0e, 
+	0x00, 0x01, 0xcd, 0x0e, 0x00, 0x64, 0x44, 0x80, 0x11, 0x1d, 0x84, 0x00, 
+	0x01, 0x65, 0x84, 0x01, 0x00, 0x10, 0x44, 0x04, 0x08, 0x47, 0x04, 0x46, 
+	0x00, 0x8b, 0x04, 0x00, 0x08, 0xc1, 0x04, 0x0f, 0x00, 0x01, 0x45, 0x0f, 
+	0x00, 0x41, 0x85, 0x0f, 0x00, 0x81, 0xc5, 0x0f, 0x00, 0xc1, 0x05, 0x10, 
+	0x00, 0x01, 0x46, 0x10, 0x00, 0x41, 0x86, 0x10, 0x00, 0x81, 0xc6, 0x10, 
+	0x00, 0xc1, 0x06, 0x11, 0x00, 0x01, 0x47, 0x11, 0x00, 0x41, 0x87, 0x11, 
+	0x00, 0x81, 0xc7, 0x11, 0x00, 0xc1, 0x07, 0x12, 0x00, 0x01, 0x48, 0x12, 
+	0x00, 0x41, 0x88, 0x12, 0x00, 0x81, 0xc8, 0x12, 0x00, 0xa4, 0x44, 0x00, 
+	0x08, 0x5d, 0x84, 0x00, 0x01, 0xa5, 0xc4, 0x01, 0x00, 0x50, 0x84, 0x84, 
+	0x08, 0x80, 0x04, 0x00, 0x03, 0xc0, 0x04, 0x80, 0x01, 0x01, 0x85, 0x03, 
+	0x00, 0xdd, 0x04, 0x00, 0x01, 0x9d, 0x84, 0x00, 0x00, 0xe5, 0x04, 0x02, 
+	0x00, 0x90, 0xc4, 0x04, 0x09, 0xcd, 0x44, 0x84, 0x06, 0xcd, 0x04, 0x84, 
+	0x09, 0xcd, 0xc4, 0x81, 0x09, 0xcd, 0x84, 0x82, 0x09, 0xcd, 0x84, 0x83, 
+	0x09, 0xcd, 0x84, 0x84, 0x09, 0xd2, 0x84, 0xc4, 0x09, 0x25, 0x45, 0x02, 
+	0x00, 0x4a, 0x00, 0x05, 0xa6, 0x5f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x4d, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x04, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 0x5f, 
+	0x75, 0x74, 0x69, 0x6c, 0x73, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x52, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x53, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x43, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x00, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0xf0, 0xbf, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x27, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x27, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x04, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x22, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x2a, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x2a, 0x2f, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x2f, 0x2f, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x20, 0x09, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x75, 0x74, 0x6f, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x6f, 0x6f, 
+	0x6c, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 
+	0x72, 0x65, 0x61, 0x6b, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x63, 0x61, 0x73, 0x65, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x63, 0x68, 0x61, 0x72, 0x00, 0x04, 0x06, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x00, 
+	0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 
+	0x74, 0x69, 0x6e, 0x75, 0x65, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x6f, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x6f, 0x75, 0x62, 
+	0x6c, 0x65, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x65, 0x6c, 0x73, 0x65, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x65, 0x6e, 0x75, 0x6d, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x6f, 0x61, 
+	0x74, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 
+	0x6f, 0x72, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x67, 0x6f, 0x74, 0x6f, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x69, 0x66, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x74, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 
+	0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x67, 
+	0x69, 0x73, 0x74, 0x65, 0x72, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x00, 
+	0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x73, 0x68, 0x6f, 0x72, 0x74, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x69, 0x7a, 0x65, 
+	0x6f, 0x66, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x77, 0x69, 0x74, 
+	0x63, 0x68, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x00, 0x04, 0x06, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x00, 0x04, 
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x6e, 0x73, 0x69, 
+	0x67, 0x6e, 0x65, 0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x76, 0x6f, 0x69, 0x64, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 
+	0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x68, 
+	0x69, 0x6c, 0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x64, 0x6f, 0x75, 0x74, 0x00, 
+	0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x72, 0x69, 
+	0x6e, 0x74, 0x66, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x73, 0x74, 0x72, 0x6c, 0x65, 0x6e, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x63, 0x73, 0x6c, 0x65, 0x6e, 0x00, 
+	0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x6c, 
+	0x6c, 0x6f, 0x63, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x66, 0x72, 0x65, 0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x00, 0x04, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x65, 0x77, 0x00, 0x04, 
+	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x70, 0x72, 0x69, 
+	0x6e, 0x74, 0x66, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x76, 0x73, 0x6e, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x63, 
+	0x70, 0x79, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x73, 0x74, 0x72, 0x6e, 0x63, 0x70, 0x79, 0x00, 0x04, 0x08, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x66, 
+	0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x65, 
+	0x74, 0x65, 0x6e, 0x76, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x69, 0x6f, 0x63, 0x74, 0x6c, 0x00, 0x04, 0x06, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x73, 0x65, 0x00, 0x0a, 
+	0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 
+	0x00, 0x05, 0x14, 0x00, 0x00, 0x00, 0x86, 0x40, 0x40, 0x00, 0x87, 0x80, 
+	0x40, 0x01, 0xc0, 0x00, 0x80, 0x00, 0x9d, 0x80, 0x00, 0x01, 0x08, 0x80, 
+	0x00, 0x80, 0x86, 0x00, 0x40, 0x00, 0x19, 0x80, 0x80, 0x81, 0x17, 0x80, 
+	0x02, 0x80, 0x85, 0x00, 0x80, 0x00, 0xc6, 0x40, 0x40, 0x00, 0xc7, 0x00, 
+	0xc1, 0x01, 0x00, 0x01, 0x00, 0x00, 0xdd, 0x80, 0x00, 0x01, 0x96, 0xc0, 
+	0x00, 0x01, 0x89, 0x00, 0x80, 0x00, 0x86, 0x00, 0x40, 0x00, 0x8e, 0x40, 
+	0x41, 0x01, 0x08, 0x80, 0x00, 0x80, 0x17, 0x40, 0xfc, 0x7f, 0x1f, 0x00, 
+	0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 
+	0x67, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 
+	0x65, 0x6e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x68, 0x61, 
+	0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x00, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0f, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 
+	0x61, 0x78, 0x2f, 0x63, 0x63, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x14, 0x00, 
+	0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 
+	0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 
+	0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 
+	0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 
+	0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 
+	0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 
+	0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 
+	0x6c, 0x6f, 0x75, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 
+	0x56, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 
+	0x74, 0x76, 0x61, 0x6c, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 
+	0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 
+	0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x45, 0x4c, 0x4c, 0x4f, 0x57, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 
+	0x61, 0x78, 0x2f, 0x63, 0x63, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 
+	0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 
+	0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x4c, 0x55, 0x45, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 
+	0x61, 0x78, 0x2f, 0x63, 0x63, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 
+	0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 
+	0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x45, 0x44, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 
+	0x78, 0x2f, 0x63, 0x63, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 
+	0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 
+	0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x09, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x45, 0x56, 0x5f, 0x43, 
+	0x59, 0x41, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x63, 0x63, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x49, 0x00, 
+	0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 
+	0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 
+	0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 
+	0x4c, 0x55, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x63, 0x63, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x72, 0x00, 
+	0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 
+	0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 
+	0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 
+	0x59, 0x41, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x63, 0x63, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 
+	0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x89, 0x00, 
+	0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 
+	0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 
+	0x64, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 
+	0x52, 0x45, 0x45, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x63, 0x63, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x89, 0x00, 
+	0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x89, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x8f, 
+	0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 
+	0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 
+	0x64, 0x64, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x57, 0x48, 0x49, 0x54, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x63, 0x63, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 
+	0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x9c, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0a, 
+	0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x46, 
+	0x40, 0xc0, 0x00, 0x47, 0x80, 0xc0, 0x00, 0x85, 0x00, 0x00, 0x01, 0xc0, 
+	0x00, 0x00, 0x00, 0x5d, 0x40, 0x80, 0x01, 0x45, 0x00, 0x00, 0x00, 0x5f, 
+	0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x74, 0x63, 
+	0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x02, 
+	0x00, 0x00, 0x01, 0x13, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x63, 0x63, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x9e, 
+	0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x9f, 
+	0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 
+	0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x63, 0x63, 
+	0x2e, 0x6c, 0x75, 0x61, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
+	0x00, 0x15, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 
+	0x00, 0x25, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 
+	0x00, 0x26, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 
+	0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 
+	0x00, 0x37, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 
+	0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 
+	0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 
+	0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 
+	0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 
+	0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 
+	0x00, 0x50, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 
+	0x00, 0x53, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 
+	0x00, 0x56, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 
+	0x00, 0x59, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 
+	0x00, 0x5c, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 
+	0x00, 0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 
+	0x00, 0x65, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 
+	0x00, 0x68, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 
+	0x00, 0x6b, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 
+	0x00, 0x6e, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 
+	0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 
+	0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 
+	0x00, 0x78, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 
+	0x00, 0x7b, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 
+	0x00, 0x7e, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 
+	0x00, 0x81, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 
+	0x00, 0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 
+	0x00, 0x87, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 
+	0x00, 0x78, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 
+	0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 
+	0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 
+	0x00, 0x8f, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 
+	0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 
+	0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 
+	0x00, 0x9c, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6c, 0x70, 0x65, 0x67, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6d, 0x79, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 
+	0x00, 0x04, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x09, 0x00, 0x00, 0x00, 0xc1, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 
+	0x0b, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xc1, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 
+	0x0f, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x00, 
+	0x13, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x63, 0x68, 0x61, 0x72, 0x6c, 0x69, 0x74, 0x00, 
+	0x2d, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x6c, 0x69, 
+	0x74, 0x00, 0x47, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x08, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+	0x73, 0x00, 0x4a, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x09, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 
+	0x6e, 0x74, 0x00, 0x57, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x65, 0x77, 0x63, 0x6f, 
+	0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x60, 0x00, 0x00, 0x00, 0xc1, 0x00, 
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 
+	0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x63, 0x00, 0x00, 0x00, 0xc1, 0x00, 
+	0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x72, 
+	0x61, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x5f, 0x73, 0x70, 0x61, 0x63, 0x65, 
+	0x00, 0x6d, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x74, 0x65, 0x72, 0x61, 0x6c, 
+	0x00, 0x70, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72, 0x64, 
+	0x00, 0x99, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x73, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x6e, 0x79, 0x00, 0xb6, 
+	0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73, 0x00, 0xbd, 0x00, 
+	0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x00, 
+};
+unsigned int syntax_cc_luac_len = 5003;
+unsigned char syntax_email_luac[] = {
+	0x1b, 0x4c, 0x75, 0x61, 0x52, 0x00, 0x01, 0x04, 0x08, 0x04, 0x08, 0x00, 
+	0x19, 0x93, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+	0x00, 0x46, 0x00, 0x40, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x4a, 0x80, 0x80, 
+	0x80, 0x46, 0x00, 0x40, 0x00, 0xa5, 0x40, 0x00, 0x00, 0x4a, 0x80, 0x00, 
+	0x81, 0x65, 0x80, 0x00, 0x00, 0x0a, 0x40, 0x80, 0x81, 0x1f, 0x00, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+	0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 
+	0x5f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x73, 
+	0x65, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x18, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x08, 0x0a, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 
+	0x00, 0xa5, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x40, 
+	0x00, 0x81, 0x41, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x01, 0x1d, 0x81, 0x00, 
+	0x02, 0xdd, 0x40, 0x00, 0x01, 0x5f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x67, 0x73, 0x75, 0x62, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x2e, 0x2d, 0x29, 0x0d, 0x3f, 0x0a, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x47, 
+	0x40, 0xc0, 0x00, 0x85, 0x00, 0x80, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x5d, 
+	0x40, 0x80, 0x01, 0x41, 0x80, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x1f, 
+	0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 
+	0x74, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 
+	0x74, 0x61, 0x78, 0x2f, 0x65, 0x6d, 0x61, 0x69, 0x6c, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x08, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 
+	0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 
+	0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6c, 0x69, 0x6e, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 
+	0x74, 0x61, 0x78, 0x2f, 0x65, 0x6d, 0x61, 0x69, 0x6c, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x15, 0x00, 
+	0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 
+	0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 
+	0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x1e, 0x00, 0x00, 0x00, 
+	0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x0f, 0x00, 0x00, 0x00, 0x86, 
+	0x00, 0x40, 0x00, 0x87, 0x40, 0x40, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x01, 
+	0x81, 0x00, 0x00, 0x46, 0x01, 0x40, 0x00, 0x47, 0xc1, 0xc0, 0x02, 0x80, 
+	0x01, 0x80, 0x00, 0x5d, 0x01, 0x00, 0x01, 0x9d, 0x80, 0x00, 0x00, 0x58, 
+	0x40, 0x00, 0x01, 0x17, 0x00, 0x00, 0x80, 0x83, 0x40, 0x00, 0x00, 0x83, 
+	0x00, 0x80, 0x00, 0x9f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x75, 0x62, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6c, 0x65, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x65, 0x6d, 0x61, 0x69, 
+	0x6c, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x00, 
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 
+	0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x74, 
+	0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 
+	0x72, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x45, 0x4e, 0x56, 0x00, 0x27, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x0d, 0x6c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x86, 
+	0x80, 0x40, 0x00, 0x87, 0xc0, 0x40, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x9d, 
+	0x80, 0x00, 0x01, 0x08, 0x80, 0x80, 0x80, 0x83, 0x00, 0x80, 0x00, 0xc3, 
+	0x00, 0x00, 0x00, 0x06, 0x01, 0x41, 0x00, 0x46, 0x41, 0x40, 0x00, 0x1d, 
+	0x01, 0x01, 0x01, 0x17, 0x00, 0x16, 0x80, 0x9b, 0x00, 0x00, 0x00, 0x17, 
+	0xc0, 0x03, 0x80, 0x55, 0x02, 0x00, 0x04, 0x08, 0x40, 0x82, 0x82, 0x46, 
+	0x42, 0x41, 0x00, 0x19, 0x40, 0x02, 0x83, 0x17, 0x80, 0x01, 0x80, 0x40, 
+	0x02, 0x80, 0x00, 0x86, 0xc2, 0x41, 0x00, 0x56, 0x80, 0x82, 0x04, 0x46, 
+	0x42, 0x41, 0x00, 0x4e, 0x02, 0xc2, 0x04, 0x08, 0x40, 0x82, 0x82, 0x17, 
+	0x40, 0xfd, 0x7f, 0x18, 0x00, 0x40, 0x04, 0x17, 0x40, 0x11, 0x80, 0x83, 
+	0x00, 0x00, 0x00, 0x17, 0xc0, 0x10, 0x80, 0xdb, 0x00, 0x00, 0x00, 0x17, 
+	0x00, 0x03, 0x80, 0x55, 0x02, 0x00, 0x04, 0x08, 0x40, 0x82, 0x82, 0x46, 
+	0x42, 0x41, 0x00, 0x19, 0x40, 0x02, 0x83, 0x17, 0x00, 0x0f, 0x80, 0x40, 
+	0x02, 0x80, 0x00, 0x86, 0x42, 0x42, 0x00, 0x56, 0x80, 0x82, 0x04, 0x46, 
+	0x42, 0x41, 0x00, 0x4e, 0x02, 0xc2, 0x04, 0x08, 0x40, 0x82, 0x82, 0x17, 
+	0x40, 0xfd, 0x7f, 0x17, 0x00, 0x0d, 0x80, 0x46, 0x82, 0x42, 0x00, 0x86, 
+	0x82, 0x40, 0x00, 0x87, 0xc2, 0x42, 0x05, 0xc0, 0x02, 0x00, 0x04, 0x01, 
+	0x03, 0x03, 0x00, 0x9d, 0x82, 0x80, 0x01, 0x9b, 0x02, 0x00, 0x00, 0x17, 
+	0x00, 0x00, 0x80, 0x46, 0x42, 0x43, 0x00, 0x86, 0x82, 0x40, 0x00, 0x87, 
+	0xc2, 0x42, 0x05, 0xc0, 0x02, 0x00, 0x04, 0x01, 0x83, 0x03, 0x00, 0x9d, 
+	0x82, 0x80, 0x01, 0x9b, 0x02, 0x00, 0x00, 0x17, 0x00, 0x00, 0x80, 0x46, 
+	0x42, 0x43, 0x00, 0x86, 0x82, 0x40, 0x00, 0x87, 0xc2, 0x42, 0x05, 0xc0, 
+	0x02, 0x00, 0x04, 0x01, 0xc3, 0x03, 0x00, 0x9d, 0x82, 0x80, 0x01, 0x9b, 
+	0x02, 0x00, 0x00, 0x17, 0x00, 0x00, 0x80, 0x46, 0x02, 0x44, 0x00, 0x86, 
+	0x82, 0x40, 0x00, 0x87, 0xc2, 0x42, 0x05, 0xc0, 0x02, 0x00, 0x04, 0x01, 
+	0x43, 0x04, 0x00, 0x9d, 0x82, 0x80, 0x01, 0x9b, 0x02, 0x00, 0x00, 0x17, 
+	0x00, 0x00, 0x80, 0x46, 0x02, 0x44, 0x00, 0x95, 0x02, 0x00, 0x04, 0x08, 
+	0x80, 0x82, 0x82, 0x86, 0x42, 0x41, 0x00, 0x19, 0x80, 0x02, 0x83, 0x17, 
+	0x40, 0x02, 0x80, 0x80, 0x02, 0x80, 0x00, 0xc6, 0x82, 0x40, 0x00, 0xc7, 
+	0x82, 0xc4, 0x05, 0x00, 0x03, 0x80, 0x04, 0xdd, 0x82, 0x00, 0x01, 0x56, 
+	0xc0, 0x02, 0x05, 0x86, 0x42, 0x41, 0x00, 0x8e, 0x02, 0x42, 0x05, 0x08, 
+	0x80, 0x82, 0x82, 0x17, 0x80, 0xfc, 0x7f, 0x58, 0xc0, 0x44, 0x04, 0x17, 
+	0x40, 0x00, 0x80, 0x18, 0x00, 0x45, 0x04, 0x17, 0x00, 0x00, 0x80, 0xc3, 
+	0x00, 0x80, 0x00, 0x40, 0x02, 0x80, 0x00, 0x86, 0x82, 0x42, 0x00, 0x56, 
+	0x80, 0x82, 0x04, 0x22, 0x81, 0x00, 0x00, 0xa3, 0x01, 0xe9, 0x7f, 0x06, 
+	0x41, 0x45, 0x00, 0x40, 0x01, 0x80, 0x00, 0x1d, 0x81, 0x00, 0x01, 0x1f, 
+	0x01, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6d, 0x70, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 
+	0x67, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
+	0x6f, 0x5f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x00, 
+	0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x4c, 0x55, 0x45, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x45, 0x4c, 0x4c, 0x4f, 0x57, 
+	0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x48, 
+	0x49, 0x54, 0x45, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x00, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x52, 0x45, 0x44, 0x00, 0x04, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x20, 0x00, 0x04, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x20, 0x3e, 0x20, 0x00, 0x04, 0x06, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x52, 0x45, 0x45, 0x4e, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x3e, 
+	0x20, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 
+	0x68, 0x61, 0x72, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x2d, 0x2d, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x2d, 0x2d, 0x20, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x74, 0x6f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 
+	0x2f, 0x65, 0x6d, 0x61, 0x69, 0x6c, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x6c, 
+	0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 
+	0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 
+	0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x39, 
+	0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 
+	0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x40, 
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 
+	0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 
+	0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 
+	0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x49, 
+	0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4b, 
+	0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x53, 
+	0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x54, 
+	0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x55, 
+	0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 
+	0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x57, 
+	0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67, 
+	0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67, 
+	0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x67, 
+	0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 
+	0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 
+	0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x69, 
+	0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x69, 
+	0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x69, 
+	0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6a, 
+	0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6a, 
+	0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6a, 
+	0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x70, 
+	0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x71, 
+	0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x71, 
+	0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x72, 
+	0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 
+	0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 
+	0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x81, 
+	0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x39, 
+	0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 
+	0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x85, 
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x72, 0x65, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x65, 0x61, 
+	0x64, 0x65, 0x72, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x69, 0x67, 0x00, 
+	0x08, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x65, 0x6e, 
+	0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+	0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x00, 
+	0x0b, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 
+	0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x67, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 
+	0x0c, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x65, 0x00, 
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 
+	0x6c, 0x6f, 0x75, 0x72, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 
+	0x74, 0x61, 0x78, 0x2f, 0x65, 0x6d, 0x61, 0x69, 0x6c, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x13, 0x00, 
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1e, 0x00, 
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x85, 0x00, 
+	0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8a, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6d, 0x79, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x00, 
+};
+unsigned int syntax_email_luac_len = 2520;
+unsigned char syntax_go_luac[] = {
+	0x1b, 0x4c, 0x75, 0x61, 0x52, 0x00, 0x01, 0x04, 0x08, 0x04, 0x08, 0x00, 
+	0x19, 0x93, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x3f, 0xce, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x40, 0x00, 0x00, 0x1d, 0x80, 0x00, 0x01, 0x4b, 0x00, 0x00, 
+	0x00, 0x81, 0x80, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x08, 0xc0, 0x80, 
+	0x81, 0xc6, 0x00, 0x41, 0x00, 0xc7, 0x40, 0xc1, 0x01, 0x06, 0x01, 0x41, 
+	0x00, 0x07, 0x81, 0x41, 0x02, 0x46, 0x01, 0x41, 0x00, 0x47, 0xc1, 0xc1, 
+	0x02, 0x86, 0x01, 0x41, 0x00, 0x87, 0x01, 0x42, 0x03, 0xc7, 0x41, 0x42, 
+	0x00, 0xdd, 0x81, 0x80, 0x00, 0x25, 0x42, 0x00, 0x00, 0xd0, 0x01, 0x82, 
+	0x03, 0x00, 0x02, 0x80, 0x01, 0x41, 0x82, 0x02, 0x00, 0x1d, 0x82, 0x00, 
+	0x01, 0x12, 0xc2, 0x42, 0x04, 0x40, 0x02, 0x80, 0x01, 0x81, 0x02, 0x03, 
+	0x00, 0x5d, 0x82, 0x00, 0x01, 0x0f, 0x42, 0x02, 0x04, 0x40, 0x02, 0x80, 
+	0x01, 0x81, 0x42, 0x03, 0x00, 0x5d, 0x82, 0x00, 0x01, 0x80, 0x02, 0x80, 
+	0x01, 0xc1, 0x82, 0x03, 0x00, 0x9d, 0x82, 0x00, 0x01, 0x4f, 0x82, 0x82, 
+	0x04, 0x80, 0x02, 0x80, 0x02, 0xc1, 0xc2, 0x03, 0x00, 0x9d, 0x82, 0x00, 
+	0x01, 0x8e, 0x82, 0x02, 0x87, 0x4d, 0x82, 0x82, 0x04, 0x52, 0x82, 0xc3, 
+	0x04, 0x0f, 0x42, 0x02, 0x04, 0x40, 0x02, 0x80, 0x01, 0x81, 0x02, 0x03, 
+	0x00, 0x5d, 0x82, 0x00, 0x01, 0x0f, 0x42, 0x02, 0x04, 0x40, 0x02, 0x80, 
+	0x01, 0x81, 0x82, 0x02, 0x00, 0x5d, 0x82, 0x00, 0x01, 0x52, 0xc2, 0xc2, 
+	0x04, 0x80, 0x02, 0x80, 0x01, 0xc1, 0x02, 0x04, 0x00, 0x9d, 0x82, 0x00, 
+	0x01, 0x4f, 0x82, 0x82, 0x04, 0x80, 0x02, 0x80, 0x01, 0xc1, 0x42, 0x03, 
+	0x00, 0x9d, 0x82, 0x00, 0x01, 0xc0, 0x02, 0x80, 0x01, 0x01, 0x83, 0x03, 
+	0x00, 0xdd, 0x82, 0x00, 0x01, 0x8f, 0xc2, 0x02, 0x05, 0xc0, 0x02, 0x80, 
+	0x02, 0x01, 0x43, 0x04, 0x00, 0xdd, 0x82, 0x00, 0x01, 0xce, 0xc2, 0x02, 
+	0x87, 0x8d, 0xc2, 0x02, 0x05, 0x92, 0x82, 0x44, 0x05, 0x4f, 0x82, 0x82, 
+	0x04, 0x80, 0x02, 0x80, 0x01, 0xc1, 0x02, 0x04, 0x00, 0x9d, 0x82, 0x00, 
+	0x01, 0x4f, 0x82, 0x82, 0x04, 0x8d, 0x42, 0x02, 0x04, 0xe5, 0x82, 0x00, 
+	0x00, 0x90, 0xc2, 0x02, 0x05, 0xc0, 0x02, 0x80, 0x01, 0x01, 0xc3, 0x04, 
+	0x00, 0xdd, 0x82, 0x00, 0x01, 0x00, 0x03, 0x80, 0x01, 0x41, 0x03, 0x05, 
+	0x00, 0x1d, 0x83, 0x00, 0x01, 0x0e, 0x03, 0x03, 0x87, 0x12, 0x83, 0x44, 
+	0x06, 0xcf, 0x02, 0x83, 0x05, 0x00, 0x03, 0x80, 0x01, 0x41, 0x03, 0x05, 
+	0x00, 0x1d, 0x83, 0x00, 0x01, 0xcf, 0x02, 0x83, 0x05, 0x00, 0x03, 0x80, 
+	0x01, 0x41, 0x43, 0x05, 0x00, 0x1d, 0x83, 0x00, 0x01, 0x40, 0x03, 0x80, 
+	0x01, 0x81, 0x83, 0x05, 0x00, 0x5d, 0x83, 0x00, 0x01, 0x4e, 0x43, 0x03, 
+	0x87, 0x52, 0x83, 0xc4, 0x06, 0x0f, 0x43, 0x03, 0x06, 0x4d, 0x03, 0x83, 
+	0x05, 0xa5, 0xc3, 0x00, 0x00, 0x50, 0x83, 0x83, 0x06, 0x80, 0x03, 0x80, 
+	0x02, 0xc1, 0xc3, 0x05, 0x00, 0x9d, 0x83, 0x00, 0x01, 0x92, 0x83, 0x43, 
+	0x07, 0xc0, 0x03, 0x80, 0x02, 0x01, 0x84, 0x05, 0x00, 0xdd, 0x83, 0x00, 
+	0x01, 0x8f, 0xc3, 0x03, 0x07, 0xe5, 0x03, 0x01, 0x00, 0x90, 0xc3, 0x03, 
+	0x07, 0xcd, 0x43, 0x02, 0x04, 0x25, 0x44, 0x01, 0x00, 0xd0, 0x03, 0x84, 
+	0x07, 0x07, 0x04, 0x46, 0x00, 0x4b, 0x04, 0x00, 0x0e, 0x81, 0x44, 0x06, 
+	0x00, 0xc1, 0x84, 0x06, 0x00, 0x01, 0xc5, 0x06, 0x00, 0x41, 0x05, 0x07, 
+	0x00, 0x81, 0x45, 0x07, 0x00, 0xc1, 0x85, 0x07, 0x00, 0x01, 0xc6, 0x07, 
+	0x00, 0x41, 0x06, 0x08, 0x00, 0x81, 0x46, 0x08, 0x00, 0xc1, 0x86, 0x08, 
+	0x00, 0x01, 0xc7, 0x08, 0x00, 0x41, 0x07, 0x09, 0x00, 0x81, 0x47, 0x09, 
+	0x00, 0xc1, 0x87, 0x09, 0x00, 0x01, 0xc8, 0x09, 0x00, 0x41, 0x08, 0x0a, 
+	0x00, 0x81, 0x48, 0x0a, 0x00, 0xc1, 0x88, 0x0a, 0x00, 0x01, 0xc9, 0x0a, 
+	0x00, 0x41, 0x09, 0x0b, 0x00, 0x81, 0x49, 0x0b, 0x00, 0xc1, 0x89, 0x0b, 
+	0x00, 0x01, 0xca, 0x0b, 0x00, 0x41, 0x0a, 0x0c, 0x00, 0x81, 0x4a, 0x0c, 
+	0x00, 0xc1, 0x8a, 0x0c, 0x00, 0x01, 0xcb, 0x0c, 0x00, 0x41, 0x0b, 0x0d, 
+	0x00, 0x81, 0x4b, 0x0d, 0x00, 0xc1, 0x8b, 0x0d, 0x00, 0x01, 0xcc, 0x0d, 
+	0x00, 0x41, 0x0c, 0x0e, 0x00, 0x81, 0x4c, 0x0e, 0x00, 0xc1, 0x8c, 0x0e, 
+	0x00, 0x01, 0xcd, 0x0e, 0x00, 0x41, 0x0d, 0x0f, 0x00, 0x81, 0x4d, 0x0f, 
+	0x00, 0xc1, 0x8d, 0x0f, 0x00, 0x01, 0xce, 0x0f, 0x00, 0x41, 0x0e, 0x10, 
+	0x00, 0x81, 0x4e, 0x10, 0x00, 0xc1, 0x8e, 0x10, 0x00, 0x01, 0xcf, 0x10, 
+	0x00, 0x41, 0x0f, 0x11, 0x00, 0x81, 0x4f, 0x11, 0x00, 0x64, 0x44, 0x80, 
+	0x16, 0x1d, 0x84, 0x00, 0x01, 0x65, 0x84, 0x01, 0x00, 0x10, 0x44, 0x04, 
+	0x08, 0x47, 0x04, 0x46, 0x00, 0x8b, 0x04, 0x00, 0x09, 0xc1, 0x84, 0x11, 
+	0x00, 0x01, 0xc5, 0x11, 0x00, 0x41, 0x05, 0x12, 0x00, 0x81, 0x45, 0x12, 
+	0x00, 0xc1, 0x85, 0x12, 0x00, 0x01, 0xc6, 0x12, 0x00, 0x41, 0x06, 0x13, 
+	0x00, 0x81, 0x46, 0x13, 0x00, 0xc1, 0x86, 0x13, 0x00, 0x01, 0xc7, 0x13, 
+	0x00, 0x41, 0x07, 0x14, 0x00, 0x81, 0x47, 0x14, 0x00, 0xc1, 0x87, 0x14, 
+	0x00, 0x01, 0xc8, 0x14, 0x00, 0x41, 0x08, 0x15, 0x00, 0x81, 0x48, 0x15, 
+	0x00, 0xc1, 0x88, 0x15, 0x00, 0x01, 0xc9, 0x15, 0x00, 0x41, 0x09, 0x16, 
+	0x00, 0xa4, 0x44, 0x80, 0x09, 0x5d, 0x84, 0x00, 0x01, 0xa5, 0xc4, 0x01, 
+	0x00, 0x50, 0x84, 0x84, 0x08, 0x80, 0x04, 0x00, 0x03, 0xc0, 0x04, 0x80, 
+	0x01, 0x01, 0x85, 0x03, 0x00, 0xdd, 0x04, 0x00, 0x01, 0x9d, 0x84, 0x00, 
+	0x00, 0xe5, 0x04, 0x02, 0x00, 0x90, 0xc4, 0x04, 0x09, 0xcd, 0x44, 0x84, 
+	0x06, 0xcd, 0x04, 0x84, 0x09, 0xcd, 0xc4, 0x81, 0x09, 0xcd, 0x84, 0x82, 
+	0x09, 0xcd, 0x84, 0x83, 0x09, 0xcd, 0x84, 0x84, 0x09, 0xd2, 0x84, 0xc4, 
+	0x09, 0x25, 0x45, 0x02, 0x00, 0x4a, 0x00, 0x85, 0xac, 0x5f, 0x00, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 
+	0x65, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 
+	0x70, 0x65, 0x67, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x00, 0x04, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x04, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x00, 
+	0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0xf0, 0x3f, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5c, 0x27, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x22, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 
+	0x22, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x2a, 0x00, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2f, 0x00, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x2f, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x09, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 
+	0x73, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 
+	0x72, 0x65, 0x61, 0x6b, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x63, 0x61, 0x73, 0x65, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x63, 0x68, 0x61, 0x6e, 0x00, 0x04, 0x06, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x00, 
+	0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6e, 
+	0x74, 0x69, 0x6e, 0x75, 0x65, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x65, 0x66, 0x65, 
+	0x72, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 
+	0x6c, 0x73, 0x65, 0x00, 0x04, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x66, 0x61, 0x6c, 0x6c, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6f, 
+	0x72, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 
+	0x75, 0x6e, 0x63, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x67, 0x6f, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x67, 0x6f, 0x74, 0x6f, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x69, 0x66, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x00, 0x04, 0x0a, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x74, 0x65, 0x72, 
+	0x66, 0x61, 0x63, 0x65, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6d, 0x61, 0x70, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x70, 0x61, 0x63, 0x6b, 0x61, 0x67, 0x65, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x61, 0x6e, 0x67, 
+	0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 
+	0x74, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 
+	0x77, 0x69, 0x74, 0x63, 0x68, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x74, 0x79, 0x70, 0x65, 0x00, 0x04, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x61, 0x72, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x6f, 0x6f, 0x6c, 0x00, 0x04, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x79, 0x74, 0x65, 
+	0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 
+	0x6d, 0x70, 0x6c, 0x65, 0x78, 0x36, 0x34, 0x00, 0x04, 0x0b, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78, 
+	0x31, 0x32, 0x38, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x32, 0x00, 
+	0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6c, 0x6f, 
+	0x61, 0x74, 0x36, 0x34, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x69, 0x6e, 0x74, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x69, 0x6e, 0x74, 0x38, 0x00, 0x04, 0x06, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x74, 0x33, 
+	0x32, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 
+	0x6e, 0x74, 0x36, 0x34, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x72, 0x75, 0x6e, 0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x69, 0x6e, 0x74, 
+	0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x69, 
+	0x6e, 0x74, 0x38, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x75, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x00, 
+	0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x69, 0x6e, 
+	0x74, 0x36, 0x34, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x75, 0x69, 0x6e, 0x74, 0x70, 0x74, 0x72, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x72, 0x75, 0x65, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x61, 0x6c, 0x73, 
+	0x65, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 
+	0x6f, 0x74, 0x61, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6e, 0x69, 0x6c, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x61, 0x70, 0x00, 0x04, 0x06, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6c, 0x6f, 0x73, 0x65, 
+	0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 
+	0x6d, 0x70, 0x6c, 0x65, 0x78, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x63, 0x6f, 0x70, 0x79, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x65, 0x6c, 0x65, 0x74, 0x65, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6d, 0x61, 
+	0x67, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 
+	0x65, 0x6e, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6d, 0x61, 0x6b, 0x65, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6e, 0x65, 0x77, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x70, 0x61, 0x6e, 0x69, 0x63, 0x00, 0x04, 0x06, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 
+	0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x72, 0x69, 
+	0x6e, 0x74, 0x6c, 0x6e, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x72, 0x65, 0x61, 0x6c, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x00, 
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 
+	0x73, 0x65, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x20, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x14, 0x00, 0x00, 0x00, 0x86, 0x40, 
+	0x40, 0x00, 0x87, 0x80, 0x40, 0x01, 0xc0, 0x00, 0x80, 0x00, 0x9d, 0x80, 
+	0x00, 0x01, 0x08, 0x80, 0x00, 0x80, 0x86, 0x00, 0x40, 0x00, 0x19, 0x80, 
+	0x80, 0x81, 0x17, 0x80, 0x02, 0x80, 0x85, 0x00, 0x80, 0x00, 0xc6, 0x40, 
+	0x40, 0x00, 0xc7, 0x00, 0xc1, 0x01, 0x00, 0x01, 0x00, 0x00, 0xdd, 0x80, 
+	0x00, 0x01, 0x96, 0xc0, 0x00, 0x01, 0x89, 0x00, 0x80, 0x00, 0x86, 0x00, 
+	0x40, 0x00, 0x8e, 0x40, 0x41, 0x01, 0x08, 0x80, 0x00, 0x80, 0x17, 0x40, 
+	0xfc, 0x7f, 0x1f, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
+	0x68, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x63, 0x68, 0x61, 0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x02, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x67, 0x6f, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 
+	0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 
+	0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 
+	0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 
+	0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 
+	0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 
+	0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x2f, 0x00, 0x00, 
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 
+	0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 
+	0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 
+	0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x45, 
+	0x4c, 0x4c, 0x4f, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x67, 0x6f, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 
+	0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x37, 
+	0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 
+	0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 
+	0x64, 0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x42, 0x4c, 0x55, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x67, 0x6f, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 
+	0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x3f, 
+	0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 
+	0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 
+	0x64, 0x64, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x52, 0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x67, 0x6f, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 
+	0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x44, 0x00, 
+	0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 
+	0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 
+	0x64, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 
+	0x45, 0x56, 0x5f, 0x43, 0x59, 0x41, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x67, 0x6f, 
+	0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 
+	0x56, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 
+	0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x42, 0x4c, 0x55, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x67, 0x6f, 
+	0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 
+	0x56, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 
+	0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x43, 0x59, 0x41, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x67, 0x6f, 
+	0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 
+	0x56, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 
+	0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x47, 0x52, 0x45, 0x45, 0x4e, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x67, 
+	0x6f, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x9d, 0x00, 
+	0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 
+	0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 
+	0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x57, 0x48, 0x49, 0x54, 0x45, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 
+	0x67, 0x6f, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0xa3, 
+	0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xa3, 
+	0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x45, 0x4e, 0x56, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x49, 
+	0x00, 0x00, 0x00, 0x46, 0x40, 0xc0, 0x00, 0x47, 0x80, 0xc0, 0x00, 0x85, 
+	0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x5d, 0x40, 0x80, 0x01, 0x45, 
+	0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x70, 
+	0x65, 0x67, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x13, 0x0f, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 
+	0x67, 0x6f, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xb1, 
+	0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xb2, 
+	0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xb2, 
+	0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xb4, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 
+	0x65, 0x6e, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 
+	0x78, 0x2f, 0x67, 0x6f, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0xce, 0x00, 0x00, 
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 
+	0x00, 0x1a, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 
+	0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 
+	0x00, 0x27, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 
+	0x00, 0x2f, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 
+	0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 
+	0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 
+	0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 
+	0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 
+	0x00, 0x51, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 
+	0x00, 0x54, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 
+	0x00, 0x57, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 
+	0x00, 0x5a, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 
+	0x00, 0x5d, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 
+	0x00, 0x60, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 
+	0x00, 0x63, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 
+	0x00, 0x66, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 
+	0x00, 0x69, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 
+	0x00, 0x6e, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 
+	0x00, 0x71, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 
+	0x00, 0x77, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 
+	0x00, 0x7a, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 
+	0x00, 0x7d, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 
+	0x00, 0x88, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 
+	0x00, 0x8b, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 
+	0x00, 0x90, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 
+	0x00, 0x93, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 
+	0x00, 0x96, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 
+	0x00, 0x99, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 
+	0x00, 0x9d, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 
+	0x00, 0xa3, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 
+	0x00, 0xa3, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 
+	0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 
+	0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 
+	0x00, 0xaa, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 
+	0x00, 0xb9, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x70, 0x65, 
+	0x67, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0xce, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6d, 0x79, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0xce, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x05, 0x00, 0x00, 0x00, 
+	0xce, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x50, 0x00, 0x09, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+	0xce, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x53, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x0f, 0x00, 0x00, 0x00, 
+	0xce, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x00, 0x13, 0x00, 0x00, 0x00, 
+	0xce, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x63, 0x68, 0x61, 0x72, 0x6c, 0x69, 0x74, 0x00, 0x2d, 0x00, 0x00, 0x00, 
+	0xce, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x6c, 0x69, 0x74, 0x00, 0x47, 0x00, 
+	0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x00, 0x4a, 0x00, 
+	0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x63, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x57, 
+	0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6e, 0x65, 0x77, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 
+	0x74, 0x00, 0x60, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x08, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 
+	0x74, 0x00, 0x63, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x0f, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x69, 
+	0x6e, 0x67, 0x5f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x00, 0x6d, 0x00, 0x00, 
+	0x00, 0xce, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6c, 0x69, 0x74, 0x65, 0x72, 0x61, 0x6c, 0x00, 0x70, 0x00, 0x00, 
+	0x00, 0xce, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72, 0x64, 0x00, 0xa3, 0x00, 0x00, 
+	0x00, 0xce, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0xbc, 
+	0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x61, 0x6e, 0x79, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xce, 
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
+	0x6f, 0x6b, 0x65, 0x6e, 0x73, 0x00, 0xca, 0x00, 0x00, 0x00, 0xce, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x00, 
+};
+unsigned int syntax_go_luac_len = 5287;
+unsigned char syntax_html_luac[] = {
+	0x1b, 0x4c, 0x75, 0x61, 0x52, 0x00, 0x01, 0x04, 0x08, 0x04, 0x08, 0x00, 
+	0x19, 0x93, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x10, 0x5b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+	0x00, 0x41, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x08, 0x80, 0x80, 
+	0x80, 0x86, 0x80, 0x40, 0x00, 0x87, 0xc0, 0x40, 0x01, 0xc6, 0x80, 0x40, 
+	0x00, 0xc7, 0x00, 0xc1, 0x01, 0x06, 0x81, 0x40, 0x00, 0x07, 0x41, 0x41, 
+	0x02, 0x46, 0x81, 0x40, 0x00, 0x47, 0x81, 0xc1, 0x02, 0x80, 0x01, 0x00, 
+	0x01, 0xc1, 0xc1, 0x01, 0x00, 0x9d, 0x81, 0x00, 0x01, 0xc0, 0x01, 0x00, 
+	0x01, 0x01, 0x02, 0x02, 0x00, 0xdd, 0x81, 0x00, 0x01, 0x00, 0x02, 0x00, 
+	0x01, 0x41, 0x42, 0x02, 0x00, 0x1d, 0x82, 0x00, 0x01, 0xcf, 0x01, 0x82, 
+	0x03, 0x00, 0x02, 0x00, 0x02, 0x41, 0x82, 0x02, 0x00, 0x1d, 0x82, 0x00, 
+	0x01, 0x0e, 0x02, 0x82, 0x84, 0xcd, 0x01, 0x82, 0x03, 0xd2, 0xc1, 0xc2, 
+	0x03, 0x8f, 0xc1, 0x01, 0x03, 0xc0, 0x01, 0x00, 0x01, 0x01, 0xc2, 0x01, 
+	0x00, 0xdd, 0x81, 0x00, 0x01, 0x8f, 0xc1, 0x01, 0x03, 0xe5, 0x41, 0x00, 
+	0x00, 0xd0, 0xc1, 0x01, 0x03, 0x00, 0x02, 0x00, 0x01, 0x41, 0x02, 0x03, 
+	0x00, 0x1d, 0x82, 0x00, 0x01, 0x40, 0x02, 0x00, 0x01, 0x81, 0x42, 0x03, 
+	0x00, 0x5d, 0x82, 0x00, 0x01, 0x4e, 0x42, 0x82, 0x84, 0x52, 0xc2, 0xc2, 
+	0x04, 0x0f, 0x42, 0x02, 0x04, 0x40, 0x02, 0x00, 0x01, 0x81, 0x42, 0x03, 
+	0x00, 0x5d, 0x82, 0x00, 0x01, 0x0f, 0x42, 0x02, 0x04, 0x65, 0x82, 0x00, 
+	0x00, 0x50, 0x42, 0x02, 0x04, 0x80, 0x02, 0x00, 0x02, 0xc1, 0x82, 0x03, 
+	0x00, 0x9d, 0x82, 0x00, 0x01, 0x92, 0x42, 0x42, 0x05, 0xc0, 0x02, 0x00, 
+	0x02, 0x01, 0xc3, 0x03, 0x00, 0xdd, 0x82, 0x00, 0x01, 0x8f, 0xc2, 0x02, 
+	0x05, 0xe5, 0xc2, 0x00, 0x00, 0x90, 0xc2, 0x02, 0x05, 0xc0, 0x02, 0x00, 
+	0x01, 0x01, 0x03, 0x04, 0x00, 0xdd, 0x82, 0x00, 0x01, 0x00, 0x03, 0x00, 
+	0x01, 0x41, 0x43, 0x04, 0x00, 0x1d, 0x83, 0x00, 0x01, 0x0e, 0x03, 0x83, 
+	0x84, 0x12, 0xc3, 0x42, 0x06, 0xcf, 0x02, 0x83, 0x05, 0x00, 0x03, 0x00, 
+	0x01, 0x41, 0x43, 0x04, 0x00, 0x1d, 0x83, 0x00, 0x01, 0xcf, 0x02, 0x83, 
+	0x05, 0x25, 0x03, 0x01, 0x00, 0x10, 0x03, 0x83, 0x05, 0x40, 0x03, 0x80, 
+	0x02, 0x80, 0x03, 0x00, 0x01, 0xc1, 0x43, 0x02, 0x00, 0x9d, 0x03, 0x00, 
+	0x01, 0x5d, 0x83, 0x00, 0x00, 0xa5, 0x43, 0x01, 0x00, 0x50, 0x83, 0x83, 
+	0x06, 0x8d, 0x43, 0x82, 0x03, 0x8d, 0x83, 0x02, 0x07, 0x8d, 0x03, 0x03, 
+	0x07, 0x8d, 0x43, 0x03, 0x07, 0x92, 0xc3, 0x42, 0x07, 0xe5, 0x83, 0x01, 
+	0x00, 0x0a, 0xc0, 0x03, 0x89, 0x1f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x61, 0x64, 0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x52, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x53, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x43, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
+	0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x22, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x2d, 0x3e, 0x00, 0x04, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x09, 0x00, 0x04, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x73, 0x65, 0x00, 0x07, 0x00, 
+	0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x05, 0x14, 0x00, 0x00, 0x00, 0x86, 0x40, 0x40, 0x00, 0x87, 0x80, 0x40, 
+	0x01, 0xc0, 0x00, 0x80, 0x00, 0x9d, 0x80, 0x00, 0x01, 0x08, 0x80, 0x00, 
+	0x80, 0x86, 0x00, 0x40, 0x00, 0x19, 0x80, 0x80, 0x81, 0x17, 0x80, 0x02, 
+	0x80, 0x85, 0x00, 0x80, 0x00, 0xc6, 0x40, 0x40, 0x00, 0xc7, 0x00, 0xc1, 
+	0x01, 0x00, 0x01, 0x00, 0x00, 0xdd, 0x80, 0x00, 0x01, 0x96, 0xc0, 0x00, 
+	0x01, 0x89, 0x00, 0x80, 0x00, 0x86, 0x00, 0x40, 0x00, 0x8e, 0x40, 0x41, 
+	0x01, 0x08, 0x80, 0x00, 0x80, 0x17, 0x40, 0xfc, 0x7f, 0x1f, 0x00, 0x80, 
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 
+	0x6e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x68, 0x61, 0x72, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x11, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 
+	0x78, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x14, 
+	0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 
+	0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x16, 
+	0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 
+	0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 
+	0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 
+	0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 
+	0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 
+	0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 
+	0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 
+	0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 
+	0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x59, 0x41, 0x4e, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 
+	0x78, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 
+	0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x2f, 0x00, 0x00, 0x00, 
+	0x2f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 
+	0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 
+	0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 
+	0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x45, 0x4c, 
+	0x4c, 0x4f, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 
+	0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 
+	0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x61, 0x64, 0x64, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x52, 0x45, 0x56, 0x5f, 0x43, 0x59, 0x41, 0x4e, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 
+	0x68, 0x74, 0x6d, 0x6c, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 
+	0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 
+	0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x4c, 0x55, 0x45, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 
+	0x78, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 
+	0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x3f, 0x00, 0x00, 0x00, 
+	0x3f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 
+	0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 
+	0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x48, 0x49, 
+	0x54, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 
+	0x6e, 0x74, 0x61, 0x78, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 
+	0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x4a, 
+	0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0a, 0x00, 
+	0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x46, 0x40, 
+	0xc0, 0x00, 0x47, 0x80, 0xc0, 0x00, 0x85, 0x00, 0x00, 0x01, 0xc0, 0x00, 
+	0x00, 0x00, 0x5d, 0x40, 0x80, 0x01, 0x45, 0x00, 0x00, 0x00, 0x5f, 0x00, 
+	0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 0x06, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x74, 0x63, 0x68, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 
+	0x00, 0x01, 0x0e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x2e, 
+	0x6c, 0x75, 0x61, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 
+	0x4b, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 
+	0x4c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 
+	0x4d, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x68, 
+	0x74, 0x6d, 0x6c, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x5b, 0x00, 0x00, 0x00, 
+	0x09, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 
+	0x14, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 
+	0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 
+	0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 
+	0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 
+	0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 
+	0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 
+	0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 
+	0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 
+	0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 
+	0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 
+	0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 
+	0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 
+	0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 
+	0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 
+	0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 
+	0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 
+	0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 
+	0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 
+	0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 
+	0x39, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 
+	0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 
+	0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 
+	0x3f, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 
+	0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 
+	0x4e, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 
+	0x53, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6d, 0x79, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 
+	0x02, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x00, 0x00, 0x5b, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 
+	0x08, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x5b, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 
+	0x0c, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x21, 
+	0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x00, 0x23, 
+	0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x68, 0x74, 0x6d, 0x6c, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 
+	0x65, 0x6e, 0x74, 0x00, 0x30, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6d, 0x6d, 
+	0x65, 0x6e, 0x74, 0x73, 0x00, 0x32, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 
+	0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x72, 0x61, 
+	0x69, 0x6c, 0x69, 0x6e, 0x67, 0x5f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x00, 
+	0x3c, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x74, 0x61, 0x67, 0x67, 0x65, 0x64, 0x00, 0x49, 
+	0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x74, 0x61, 0x67, 0x73, 0x00, 0x4b, 0x00, 0x00, 0x00, 
+	0x5b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x61, 0x6e, 0x79, 0x00, 0x52, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 0x65, 
+	0x6e, 0x73, 0x00, 0x57, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x45, 0x4e, 0x56, 0x00, 0x00, 
+};
+unsigned int syntax_html_luac_len = 2752;
+unsigned char syntax_ini_luac[] = {
+	0x1b, 0x4c, 0x75, 0x61, 0x52, 0x00, 0x01, 0x04, 0x08, 0x04, 0x08, 0x00, 
+	0x19, 0x93, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x0f, 0x48, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+	0x00, 0x41, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x08, 0x80, 0x80, 
+	0x80, 0x86, 0x80, 0x40, 0x00, 0x87, 0xc0, 0x40, 0x01, 0xc6, 0x80, 0x40, 
+	0x00, 0xc7, 0x00, 0xc1, 0x01, 0x06, 0x81, 0x40, 0x00, 0x07, 0x41, 0x41, 
+	0x02, 0x46, 0x81, 0x40, 0x00, 0x47, 0x81, 0xc1, 0x02, 0x80, 0x01, 0x00, 
+	0x01, 0xc1, 0xc1, 0x01, 0x00, 0x9d, 0x81, 0x00, 0x01, 0xc0, 0x01, 0x00, 
+	0x01, 0x01, 0x02, 0x02, 0x00, 0xdd, 0x81, 0x00, 0x01, 0xce, 0xc1, 0x81, 
+	0x84, 0xd2, 0x81, 0xc2, 0x03, 0x8f, 0xc1, 0x01, 0x03, 0xc0, 0x01, 0x00, 
+	0x01, 0x01, 0x02, 0x02, 0x00, 0xdd, 0x81, 0x00, 0x01, 0x8f, 0xc1, 0x01, 
+	0x03, 0xe5, 0x41, 0x00, 0x00, 0xd0, 0xc1, 0x01, 0x03, 0x00, 0x02, 0x80, 
+	0x01, 0x41, 0xc2, 0x02, 0x00, 0x1d, 0x82, 0x00, 0x01, 0x40, 0x02, 0x80, 
+	0x01, 0x81, 0x02, 0x03, 0x00, 0xc1, 0x42, 0x03, 0x00, 0x5d, 0x82, 0x80, 
+	0x01, 0x0d, 0x42, 0x02, 0x04, 0x40, 0x02, 0x00, 0x02, 0x81, 0x82, 0x03, 
+	0x00, 0x5d, 0x82, 0x00, 0x01, 0x0d, 0x42, 0x02, 0x04, 0x52, 0x42, 0x42, 
+	0x04, 0x80, 0x02, 0x00, 0x01, 0xc1, 0xc2, 0x03, 0x00, 0x9d, 0x82, 0x00, 
+	0x01, 0x92, 0x42, 0x42, 0x05, 0x4f, 0x82, 0x82, 0x04, 0xa5, 0x82, 0x00, 
+	0x00, 0x90, 0x82, 0x82, 0x04, 0xc0, 0x02, 0x00, 0x02, 0x01, 0x83, 0x03, 
+	0x00, 0xdd, 0x82, 0x00, 0x01, 0xd2, 0x42, 0xc2, 0x05, 0x00, 0x03, 0x00, 
+	0x02, 0x41, 0x03, 0x04, 0x00, 0x1d, 0x83, 0x00, 0x01, 0xcf, 0x02, 0x83, 
+	0x05, 0x25, 0xc3, 0x00, 0x00, 0xd0, 0x02, 0x83, 0x05, 0x00, 0x03, 0x80, 
+	0x02, 0x40, 0x03, 0x00, 0x01, 0x81, 0x43, 0x02, 0x00, 0x5d, 0x03, 0x00, 
+	0x01, 0x1d, 0x83, 0x00, 0x00, 0x65, 0x03, 0x01, 0x00, 0x10, 0x43, 0x03, 
+	0x06, 0x4d, 0x83, 0x82, 0x03, 0x4d, 0xc3, 0x82, 0x06, 0x4d, 0x03, 0x83, 
+	0x06, 0x52, 0x83, 0xc2, 0x06, 0xa5, 0x43, 0x01, 0x00, 0x0a, 0x80, 0x83, 
+	0x88, 0x1f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x12, 0x00, 0x00, 
+	0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x70, 0x65, 
+	0x67, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
+	0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 
+	0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x04, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x04, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
+	0x39, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 
+	0x7a, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 
+	0x5a, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
+	0x09, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 
+	0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 
+	0x73, 0x65, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x22, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x14, 0x00, 0x00, 0x00, 0x86, 0x40, 
+	0x40, 0x00, 0x87, 0x80, 0x40, 0x01, 0xc0, 0x00, 0x80, 0x00, 0x9d, 0x80, 
+	0x00, 0x01, 0x08, 0x80, 0x00, 0x80, 0x86, 0x00, 0x40, 0x00, 0x19, 0x80, 
+	0x80, 0x81, 0x17, 0x80, 0x02, 0x80, 0x85, 0x00, 0x80, 0x00, 0xc6, 0x40, 
+	0x40, 0x00, 0xc7, 0x00, 0xc1, 0x01, 0x00, 0x01, 0x00, 0x00, 0xdd, 0x80, 
+	0x00, 0x01, 0x96, 0xc0, 0x00, 0x01, 0x89, 0x00, 0x80, 0x00, 0x86, 0x00, 
+	0x40, 0x00, 0x8e, 0x40, 0x41, 0x01, 0x08, 0x80, 0x00, 0x80, 0x17, 0x40, 
+	0xfc, 0x7f, 0x1f, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
+	0x68, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x63, 0x68, 0x61, 0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x69, 0x6e, 0x69, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 
+	0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 
+	0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 
+	0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 
+	0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 
+	0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x22, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x31, 0x00, 
+	0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 
+	0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 
+	0x64, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 
+	0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 
+	0x6e, 0x74, 0x61, 0x78, 0x2f, 0x69, 0x6e, 0x69, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x38, 0x00, 
+	0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 
+	0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 
+	0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 
+	0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 
+	0x4c, 0x55, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x69, 0x6e, 0x69, 0x2e, 0x6c, 0x75, 
+	0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 
+	0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x3d, 
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 
+	0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 
+	0x64, 0x64, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x52, 0x45, 0x56, 0x5f, 0x43, 0x59, 0x41, 0x4e, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x69, 
+	0x6e, 0x69, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x45, 0x4e, 0x56, 0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 
+	0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 
+	0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x06, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x48, 0x49, 0x54, 0x45, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 
+	0x2f, 0x69, 0x6e, 0x69, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 
+	0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x51, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x46, 0x40, 0xc0, 0x00, 0x47, 0x80, 0xc0, 
+	0x00, 0x85, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x5d, 0x40, 0x80, 
+	0x01, 0x45, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x0d, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 
+	0x78, 0x2f, 0x69, 0x6e, 0x69, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x0a, 0x00, 
+	0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4f, 0x00, 
+	0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f, 0x00, 
+	0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 
+	0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 
+	0x61, 0x6c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x45, 0x4e, 0x56, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 
+	0x6e, 0x74, 0x61, 0x78, 0x2f, 0x69, 0x6e, 0x69, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x48, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 
+	0x00, 0x22, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 
+	0x00, 0x27, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 
+	0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 
+	0x00, 0x2a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 
+	0x00, 0x36, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 
+	0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 
+	0x00, 0x37, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 
+	0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 
+	0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 
+	0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 
+	0x00, 0x51, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 
+	0x00, 0x56, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x79, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 
+	0x65, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x00, 0x00, 0x48, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x48, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 
+	0x00, 0x0c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x65, 0x63, 0x74, 0x00, 0x19, 0x00, 
+	0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x1b, 0x00, 
+	0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6b, 0x65, 0x79, 0x5f, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x27, 
+	0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x5f, 0x72, 0x75, 0x6c, 0x65, 0x00, 
+	0x2d, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x5f, 0x6d, 0x61, 0x74, 0x63, 
+	0x68, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0f, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x69, 
+	0x6e, 0x67, 0x5f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x00, 0x39, 0x00, 0x00, 
+	0x00, 0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x61, 0x6e, 0x79, 0x00, 0x40, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 
+	0x65, 0x6e, 0x73, 0x00, 0x44, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5f, 0x45, 0x4e, 0x56, 0x00, 0x00, 
+};
+unsigned int syntax_ini_luac_len = 2405;
+unsigned char syntax_lisp_luac[] = {
+	0x1b, 0x4c, 0x75, 0x61, 0x52, 0x00, 0x01, 0x04, 0x08, 0x04, 0x08, 0x00, 
+	0x19, 0x93, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x02, 0x05, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+	0x00, 0x65, 0x00, 0x00, 0x00, 0x0a, 0x40, 0x00, 0x80, 0x1f, 0x00, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x73, 0x65, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x09, 0x1d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x8c, 
+	0x40, 0x40, 0x00, 0x01, 0x81, 0x00, 0x00, 0x9d, 0x00, 0x81, 0x01, 0x17, 
+	0x00, 0x04, 0x80, 0x58, 0xc0, 0xc0, 0x02, 0x17, 0x40, 0x00, 0x80, 0x18, 
+	0x00, 0xc1, 0x02, 0x17, 0x80, 0x01, 0x80, 0x80, 0x01, 0x80, 0x00, 0xc6, 
+	0x41, 0x41, 0x00, 0xc7, 0x81, 0xc1, 0x03, 0x06, 0xc2, 0x41, 0x00, 0xdd, 
+	0x81, 0x00, 0x01, 0x56, 0xc0, 0x01, 0x03, 0x17, 0x40, 0x01, 0x80, 0x80, 
+	0x01, 0x80, 0x00, 0xc6, 0x41, 0x41, 0x00, 0xc7, 0x81, 0xc1, 0x03, 0x06, 
+	0x02, 0x42, 0x00, 0xdd, 0x81, 0x00, 0x01, 0x56, 0xc0, 0x01, 0x03, 0xa2, 
+	0x40, 0x00, 0x00, 0x23, 0x01, 0xfb, 0x7f, 0x86, 0x40, 0x42, 0x00, 0xc0, 
+	0x00, 0x80, 0x00, 0x9d, 0x80, 0x00, 0x01, 0x9f, 0x00, 0x00, 0x01, 0x1f, 
+	0x00, 0x80, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x67, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x04, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x68, 0x61, 0x72, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x59, 0x41, 
+	0x4e, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 
+	0x48, 0x49, 0x54, 0x45, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x74, 0x6f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 
+	0x2f, 0x6c, 0x69, 0x73, 0x70, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x1d, 0x00, 
+	0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 
+	0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 
+	0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 
+	0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1a, 0x00, 
+	0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 
+	0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 
+	0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 
+	0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x65, 0x6e, 
+	0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x04, 0x00, 0x00, 0x00, 
+	0x18, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x00, 
+	0x04, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 
+	0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x04, 0x00, 0x00, 0x00, 0x18, 0x00, 
+	0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 
+	0x74, 0x74, 0x65, 0x72, 0x00, 0x05, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 
+	0x74, 0x61, 0x78, 0x2f, 0x6c, 0x69, 0x73, 0x70, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6d, 0x79, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x00, 
+};
+unsigned int syntax_lisp_luac_len = 779;
+unsigned char syntax_lpeg_utils_luac[] = {
+	0x1b, 0x4c, 0x75, 0x61, 0x52, 0x00, 0x01, 0x04, 0x08, 0x04, 0x08, 0x00, 
+	0x19, 0x93, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x02, 0x07, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+	0x00, 0x65, 0x00, 0x00, 0x00, 0x0a, 0x40, 0x00, 0x80, 0x65, 0x40, 0x00, 
+	0x00, 0x0a, 0x40, 0x80, 0x80, 0x1f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73, 0x00, 0x04, 0x08, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 
+	0x73, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x0b, 0x19, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 
+	0x00, 0x86, 0x00, 0x40, 0x00, 0x87, 0x40, 0x40, 0x01, 0xc1, 0x80, 0x00, 
+	0x00, 0x9d, 0x80, 0x00, 0x01, 0xe5, 0x00, 0x00, 0x00, 0x06, 0xc1, 0x40, 
+	0x00, 0x40, 0x01, 0x00, 0x00, 0x1d, 0x01, 0x01, 0x01, 0x17, 0x80, 0x02, 
+	0x80, 0x5b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x01, 0x80, 0x40, 0x02, 0x80, 
+	0x01, 0x80, 0x02, 0x00, 0x04, 0x5d, 0x82, 0x00, 0x01, 0x4d, 0x40, 0x82, 
+	0x00, 0x17, 0xc0, 0x00, 0x80, 0x40, 0x02, 0x80, 0x01, 0x80, 0x02, 0x00, 
+	0x04, 0x5d, 0x82, 0x00, 0x01, 0x40, 0x00, 0x80, 0x04, 0x22, 0x81, 0x00, 
+	0x00, 0xa3, 0x81, 0xfc, 0x7f, 0x5f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x61, 0x7a, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x05, 0x1b, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x47, 0x40, 0xc0, 
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x5d, 0x80, 0x00, 0x01, 0x85, 0x00, 0x80, 
+	0x00, 0x93, 0x00, 0x00, 0x01, 0x4f, 0x80, 0x80, 0x00, 0x86, 0x00, 0x40, 
+	0x00, 0x87, 0x80, 0x40, 0x01, 0xc5, 0x00, 0x80, 0x00, 0xce, 0xc0, 0x80, 
+	0x81, 0x9d, 0x80, 0x00, 0x01, 0xc6, 0x00, 0x40, 0x00, 0xc7, 0x40, 0xc0, 
+	0x01, 0x00, 0x01, 0x00, 0x00, 0xdd, 0x80, 0x00, 0x01, 0x05, 0x01, 0x80, 
+	0x00, 0x13, 0x01, 0x00, 0x02, 0xcf, 0x00, 0x81, 0x01, 0x8f, 0xc0, 0x00, 
+	0x01, 0xc6, 0x00, 0x40, 0x00, 0xc7, 0x00, 0xc1, 0x01, 0x12, 0x41, 0xc1, 
+	0x00, 0x0f, 0x01, 0x01, 0x01, 0xdd, 0x80, 0x00, 0x01, 0xdf, 0x00, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x43, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x02, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6c, 0x70, 0x65, 0x67, 0x5f, 0x75, 
+	0x74, 0x69, 0x6c, 0x73, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x1b, 0x00, 0x00, 
+	0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 
+	0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 
+	0x00, 0x21, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 
+	0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 
+	0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 
+	0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 
+	0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 
+	0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 
+	0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x09, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x6f, 0x73, 0x75, 0x66, 
+	0x66, 0x69, 0x78, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x6f, 0x70, 0x72, 
+	0x65, 0x66, 0x69, 0x78, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x69, 0x64, 0x63, 0x68, 0x61, 0x72, 0x73, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6c, 0x70, 0x65, 0x67, 
+	0x5f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x19, 
+	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 
+	0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x24, 
+	0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 
+	0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2a, 
+	0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2b, 
+	0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2d, 
+	0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 
+	0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x30, 
+	0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x6f, 0x72, 0x64, 0x73, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6d, 0x70, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x69, 0x64, 0x63, 0x68, 0x61, 0x72, 0x73, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x00, 
+	0x06, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x65, 0x6e, 
+	0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x09, 0x00, 0x00, 0x00, 
+	0x17, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x00, 
+	0x09, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 
+	0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x09, 0x00, 0x00, 0x00, 0x17, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 
+	0x0a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x37, 0x00, 0x00, 0x00, 0x4d, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x60, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x07, 0x40, 0x40, 0x00, 0x46, 0x00, 0x40, 0x00, 0x47, 0x80, 
+	0xc0, 0x00, 0x86, 0x00, 0x40, 0x00, 0x87, 0xc0, 0x40, 0x01, 0xc6, 0x00, 
+	0x40, 0x00, 0xc7, 0x00, 0xc1, 0x01, 0x00, 0x01, 0x80, 0x00, 0x41, 0x41, 
+	0x01, 0x00, 0x1d, 0x81, 0x00, 0x01, 0x40, 0x01, 0x80, 0x00, 0x81, 0x81, 
+	0x01, 0x00, 0xc1, 0xc1, 0x01, 0x00, 0x5d, 0x81, 0x80, 0x01, 0x80, 0x01, 
+	0x00, 0x00, 0xc1, 0x01, 0x02, 0x00, 0x9d, 0x81, 0x00, 0x01, 0x4d, 0x81, 
+	0x81, 0x02, 0x8d, 0x01, 0x81, 0x02, 0xc0, 0x01, 0x80, 0x00, 0x01, 0x42, 
+	0x02, 0x00, 0x41, 0x82, 0x02, 0x00, 0x81, 0x42, 0x01, 0x00, 0xdd, 0x81, 
+	0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x41, 0xc2, 0x02, 0x00, 0x1d, 0x82, 
+	0x00, 0x01, 0x40, 0x02, 0x00, 0x01, 0x81, 0x02, 0x03, 0x00, 0x5d, 0x82, 
+	0x00, 0x01, 0x52, 0x42, 0xc3, 0x04, 0x0f, 0x42, 0x02, 0x04, 0x52, 0x82, 
+	0x43, 0x02, 0x0f, 0x42, 0x02, 0x04, 0x40, 0x02, 0x00, 0x01, 0x81, 0xc2, 
+	0x03, 0x00, 0x5d, 0x82, 0x00, 0x01, 0x80, 0x02, 0x00, 0x01, 0xc1, 0x02, 
+	0x04, 0x00, 0x9d, 0x82, 0x00, 0x01, 0x92, 0x42, 0x44, 0x05, 0xc0, 0x02, 
+	0x00, 0x00, 0x01, 0x83, 0x04, 0x00, 0xdd, 0x82, 0x00, 0x01, 0x00, 0x03, 
+	0x00, 0x01, 0x41, 0xc3, 0x04, 0x00, 0x1d, 0x83, 0x00, 0x01, 0xcf, 0x02, 
+	0x83, 0x05, 0x12, 0x83, 0xc3, 0x03, 0xcf, 0x02, 0x83, 0x05, 0x12, 0x43, 
+	0x43, 0x05, 0xcf, 0x02, 0x83, 0x05, 0x00, 0x03, 0x00, 0x00, 0x41, 0x83, 
+	0x04, 0x00, 0x1d, 0x83, 0x00, 0x01, 0x52, 0x83, 0x43, 0x02, 0x0f, 0x43, 
+	0x03, 0x06, 0x52, 0x43, 0x43, 0x05, 0x0f, 0x43, 0x03, 0x06, 0x52, 0x83, 
+	0x43, 0x02, 0x92, 0x43, 0x43, 0x05, 0x4f, 0x83, 0x83, 0x06, 0x92, 0x83, 
+	0x43, 0x02, 0x8f, 0x03, 0x02, 0x07, 0xd2, 0x43, 0xc3, 0x04, 0x8f, 0xc3, 
+	0x03, 0x07, 0xd2, 0x43, 0x44, 0x02, 0x00, 0x04, 0x00, 0x00, 0x41, 0x04, 
+	0x05, 0x00, 0x1d, 0x84, 0x00, 0x01, 0xcf, 0x03, 0x84, 0x07, 0x12, 0x84, 
+	0x43, 0x02, 0xcf, 0x03, 0x84, 0x07, 0x12, 0x44, 0x43, 0x04, 0xcf, 0x03, 
+	0x84, 0x07, 0x12, 0x44, 0xc3, 0x04, 0xcf, 0x03, 0x84, 0x07, 0x8d, 0xc3, 
+	0x03, 0x07, 0xd2, 0x83, 0x43, 0x02, 0x00, 0x04, 0x00, 0x00, 0x41, 0x04, 
+	0x05, 0x00, 0x1d, 0x84, 0x00, 0x01, 0xcf, 0x03, 0x84, 0x07, 0x12, 0x44, 
+	0x44, 0x02, 0xcf, 0x03, 0x84, 0x07, 0x12, 0x44, 0x43, 0x04, 0xcf, 0x03, 
+	0x84, 0x07, 0x12, 0x44, 0xc3, 0x04, 0xcf, 0x03, 0x84, 0x07, 0x8d, 0xc3, 
+	0x03, 0x07, 0xcd, 0x03, 0x83, 0x05, 0xcd, 0x83, 0x83, 0x07, 0xcd, 0x43, 
+	0x83, 0x07, 0xdf, 0x03, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 0x15, 0x00, 
+	0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 
+	0x70, 0x65, 0x67, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x50, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x52, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
+	0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 
+	0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x39, 0x00, 
+	0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x7a, 0x00, 
+	0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x5a, 0x00, 
+	0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x66, 0x00, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x46, 0x00, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x45, 0x00, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2d, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x66, 0x46, 0x6c, 0x4c, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x75, 0x55, 0x6c, 0x4c, 0x00, 0x03, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x30, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x78, 0x58, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6c, 0x70, 0x65, 0x67, 0x5f, 0x75, 
+	0x74, 0x69, 0x6c, 0x73, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x60, 0x00, 0x00, 
+	0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 
+	0x00, 0x39, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 
+	0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 
+	0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 
+	0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 
+	0x00, 0x3e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 
+	0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 
+	0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 
+	0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 
+	0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 
+	0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 
+	0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 
+	0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 
+	0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 
+	0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 
+	0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 
+	0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 
+	0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 
+	0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 
+	0x00, 0x48, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 
+	0x00, 0x48, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 
+	0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 
+	0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 
+	0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 
+	0x00, 0x4c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 
+	0x00, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x50, 0x00, 0x02, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x04, 0x00, 0x00, 
+	0x00, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x53, 0x00, 0x06, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x08, 0x00, 0x00, 
+	0x00, 0x60, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x64, 0x69, 0x67, 0x69, 0x74, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x60, 
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 
+	0x65, 0x74, 0x74, 0x65, 0x72, 0x00, 0x13, 0x00, 0x00, 0x00, 0x60, 0x00, 
+	0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x6c, 
+	0x70, 0x68, 0x61, 0x6e, 0x75, 0x6d, 0x00, 0x14, 0x00, 0x00, 0x00, 0x60, 
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 
+	0x65, 0x78, 0x00, 0x19, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x78, 0x70, 0x00, 0x23, 
+	0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x66, 0x73, 0x00, 0x26, 0x00, 0x00, 0x00, 0x60, 0x00, 
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x73, 
+	0x00, 0x2a, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x65, 0x78, 0x6e, 0x75, 0x6d, 0x00, 
+	0x35, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6f, 0x63, 0x74, 0x6e, 0x75, 0x6d, 0x00, 0x3c, 
+	0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x64, 0x65, 0x63, 0x6e, 0x75, 0x6d, 0x00, 0x3f, 0x00, 
+	0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x6e, 0x75, 0x6d, 0x00, 0x5b, 
+	0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6c, 0x70, 
+	0x65, 0x67, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x2e, 0x6c, 0x75, 0x61, 
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 
+	0x00, 0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x79, 0x6d, 
+	0x6f, 0x64, 0x75, 0x6c, 0x65, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x00, 
+};
+unsigned int syntax_lpeg_utils_luac_len = 2635;
+unsigned char syntax_lua_luac[] = {
+	0x1b, 0x4c, 0x75, 0x61, 0x52, 0x00, 0x01, 0x04, 0x08, 0x04, 0x08, 0x00, 
+	0x19, 0x93, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x27, 0xc7, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x41, 0x40, 0x00, 0x00, 0x1d, 0x80, 0x00, 0x01, 0x4b, 0x00, 0x00, 
+	0x00, 0x81, 0x80, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x08, 0xc0, 0x80, 
+	0x81, 0xc6, 0x00, 0x41, 0x00, 0xc7, 0x40, 0xc1, 0x01, 0x06, 0x01, 0x41, 
+	0x00, 0x07, 0x81, 0x41, 0x02, 0x46, 0x01, 0x41, 0x00, 0x47, 0xc1, 0xc1, 
+	0x02, 0x86, 0x01, 0x41, 0x00, 0x87, 0x01, 0x42, 0x03, 0xc7, 0x41, 0x42, 
+	0x00, 0xdd, 0x81, 0x80, 0x00, 0x25, 0x42, 0x00, 0x00, 0xd0, 0x01, 0x82, 
+	0x03, 0x00, 0x02, 0x80, 0x01, 0x41, 0x82, 0x02, 0x00, 0x1d, 0x82, 0x00, 
+	0x01, 0x12, 0xc2, 0x42, 0x04, 0x40, 0x02, 0x80, 0x01, 0x81, 0x02, 0x03, 
+	0x00, 0x5d, 0x82, 0x00, 0x01, 0x0f, 0x42, 0x02, 0x04, 0x40, 0x02, 0x80, 
+	0x01, 0x81, 0x42, 0x03, 0x00, 0x5d, 0x82, 0x00, 0x01, 0x80, 0x02, 0x80, 
+	0x01, 0xc1, 0x82, 0x03, 0x00, 0x9d, 0x82, 0x00, 0x01, 0x4f, 0x82, 0x82, 
+	0x04, 0x80, 0x02, 0x80, 0x02, 0xc1, 0xc2, 0x03, 0x00, 0x9d, 0x82, 0x00, 
+	0x01, 0x8e, 0x82, 0x02, 0x87, 0x4d, 0x82, 0x82, 0x04, 0x52, 0x82, 0xc3, 
+	0x04, 0x0f, 0x42, 0x02, 0x04, 0x40, 0x02, 0x80, 0x01, 0x81, 0x02, 0x03, 
+	0x00, 0x5d, 0x82, 0x00, 0x01, 0x0f, 0x42, 0x02, 0x04, 0x40, 0x02, 0x80, 
+	0x01, 0x81, 0x82, 0x02, 0x00, 0x5d, 0x82, 0x00, 0x01, 0x52, 0xc2, 0xc2, 
+	0x04, 0x80, 0x02, 0x80, 0x01, 0xc1, 0x02, 0x04, 0x00, 0x9d, 0x82, 0x00, 
+	0x01, 0x4f, 0x82, 0x82, 0x04, 0x80, 0x02, 0x80, 0x01, 0xc1, 0x42, 0x03, 
+	0x00, 0x9d, 0x82, 0x00, 0x01, 0xc0, 0x02, 0x80, 0x01, 0x01, 0x83, 0x03, 
+	0x00, 0xdd, 0x82, 0x00, 0x01, 0x8f, 0xc2, 0x02, 0x05, 0xc0, 0x02, 0x80, 
+	0x02, 0x01, 0x43, 0x04, 0x00, 0xdd, 0x82, 0x00, 0x01, 0xce, 0xc2, 0x02, 
+	0x87, 0x8d, 0xc2, 0x02, 0x05, 0x92, 0x82, 0x44, 0x05, 0x4f, 0x82, 0x82, 
+	0x04, 0x80, 0x02, 0x80, 0x01, 0xc1, 0x02, 0x04, 0x00, 0x9d, 0x82, 0x00, 
+	0x01, 0x4f, 0x82, 0x82, 0x04, 0x8d, 0x42, 0x02, 0x04, 0xe5, 0x82, 0x00, 
+	0x00, 0x90, 0xc2, 0x02, 0x05, 0xc0, 0x02, 0x80, 0x01, 0x01, 0xc3, 0x04, 
+	0x00, 0xdd, 0x82, 0x00, 0x01, 0x00, 0x03, 0x80, 0x01, 0x41, 0x03, 0x05, 
+	0x00, 0x1d, 0x83, 0x00, 0x01, 0x0e, 0x03, 0x03, 0x87, 0x12, 0x83, 0x44, 
+	0x06, 0xcf, 0x02, 0x83, 0x05, 0x00, 0x03, 0x80, 0x01, 0x41, 0x03, 0x05, 
+	0x00, 0x1d, 0x83, 0x00, 0x01, 0xcf, 0x02, 0x83, 0x05, 0x00, 0x03, 0x80, 
+	0x01, 0x41, 0x43, 0x05, 0x00, 0x1d, 0x83, 0x00, 0x01, 0x40, 0x03, 0x80, 
+	0x01, 0x81, 0x83, 0x05, 0x00, 0x5d, 0x83, 0x00, 0x01, 0x4e, 0x43, 0x03, 
+	0x87, 0x52, 0x83, 0xc4, 0x06, 0x0f, 0x43, 0x03, 0x06, 0x4d, 0x03, 0x83, 
+	0x05, 0xa5, 0xc3, 0x00, 0x00, 0x50, 0x83, 0x83, 0x06, 0x80, 0x03, 0x80, 
+	0x02, 0xc1, 0xc3, 0x05, 0x00, 0x9d, 0x83, 0x00, 0x01, 0x92, 0x83, 0x43, 
+	0x07, 0xc0, 0x03, 0x80, 0x02, 0x01, 0x84, 0x05, 0x00, 0xdd, 0x83, 0x00, 
+	0x01, 0x8f, 0xc3, 0x03, 0x07, 0xe5, 0x03, 0x01, 0x00, 0x90, 0xc3, 0x03, 
+	0x07, 0xc7, 0x03, 0x46, 0x00, 0x0b, 0x04, 0x80, 0x09, 0x41, 0x44, 0x06, 
+	0x00, 0x81, 0x84, 0x06, 0x00, 0xc1, 0xc4, 0x06, 0x00, 0x01, 0x05, 0x07, 
+	0x00, 0x41, 0x45, 0x07, 0x00, 0x81, 0x85, 0x07, 0x00, 0xc1, 0xc5, 0x07, 
+	0x00, 0x01, 0x06, 0x08, 0x00, 0x41, 0x46, 0x08, 0x00, 0x81, 0x86, 0x08, 
+	0x00, 0xc1, 0xc6, 0x08, 0x00, 0x01, 0x07, 0x09, 0x00, 0x41, 0x47, 0x09, 
+	0x00, 0x81, 0x87, 0x09, 0x00, 0xc1, 0xc7, 0x09, 0x00, 0x01, 0x08, 0x0a, 
+	0x00, 0x41, 0x48, 0x0a, 0x00, 0x81, 0x88, 0x0a, 0x00, 0xc1, 0xc8, 0x0a, 
+	0x00, 0x01, 0x09, 0x0b, 0x00, 0x41, 0x49, 0x0b, 0x00, 0x81, 0x89, 0x0b, 
+	0x00, 0x24, 0x44, 0x00, 0x0b, 0xdd, 0x83, 0x00, 0x01, 0x25, 0x44, 0x01, 
+	0x00, 0xd0, 0x03, 0x84, 0x07, 0x0b, 0x04, 0x80, 0x04, 0x41, 0xc4, 0x0b, 
+	0x00, 0x81, 0x04, 0x0c, 0x00, 0xc1, 0x44, 0x0c, 0x00, 0x01, 0x85, 0x0c, 
+	0x00, 0x41, 0xc5, 0x0c, 0x00, 0x81, 0x05, 0x00, 0x00, 0xc1, 0x05, 0x0d, 
+	0x00, 0x01, 0x46, 0x0d, 0x00, 0x41, 0x86, 0x0d, 0x00, 0x24, 0x44, 0x80, 
+	0x04, 0x4b, 0x04, 0x80, 0x02, 0x81, 0xc4, 0x0d, 0x00, 0xc1, 0x04, 0x0e, 
+	0x00, 0x01, 0x45, 0x0e, 0x00, 0x41, 0x85, 0x0e, 0x00, 0x81, 0xc5, 0x0e, 
+	0x00, 0x64, 0x44, 0x80, 0x02, 0x86, 0x84, 0x4c, 0x00, 0xc0, 0x04, 0x80, 
+	0x08, 0x9d, 0x04, 0x01, 0x01, 0x17, 0x80, 0x03, 0x80, 0xc6, 0x85, 0x4c, 
+	0x00, 0x06, 0x06, 0x4f, 0x00, 0x07, 0x86, 0x05, 0x0c, 0xdd, 0x05, 0x01, 
+	0x01, 0x17, 0xc0, 0x01, 0x80, 0x06, 0xc7, 0x4e, 0x00, 0x07, 0x47, 0x4f, 
+	0x0e, 0x40, 0x07, 0x00, 0x08, 0x80, 0x07, 0x00, 0x0b, 0xc1, 0x87, 0x0f, 
+	0x00, 0x00, 0x08, 0x00, 0x0d, 0x96, 0x07, 0x08, 0x0f, 0x1d, 0x47, 0x80, 
+	0x01, 0xe2, 0x85, 0x00, 0x00, 0x63, 0x46, 0xfd, 0x7f, 0xa2, 0x84, 0x00, 
+	0x00, 0x23, 0x85, 0xfb, 0x7f, 0x87, 0x04, 0x46, 0x00, 0xc0, 0x04, 0x00, 
+	0x08, 0x9d, 0x84, 0x00, 0x01, 0xe5, 0x84, 0x01, 0x00, 0x90, 0xc4, 0x04, 
+	0x09, 0xc0, 0x04, 0x00, 0x03, 0x00, 0x05, 0x80, 0x01, 0x41, 0x85, 0x03, 
+	0x00, 0x1d, 0x05, 0x00, 0x01, 0xdd, 0x84, 0x00, 0x00, 0x25, 0xc5, 0x01, 
+	0x00, 0xd0, 0x04, 0x85, 0x09, 0x0d, 0xc5, 0x83, 0x06, 0x0d, 0x85, 0x04, 
+	0x0a, 0x0d, 0x85, 0x02, 0x0a, 0x0d, 0xc5, 0x01, 0x0a, 0x0d, 0x85, 0x03, 
+	0x0a, 0x0d, 0xc5, 0x04, 0x0a, 0x12, 0x85, 0x44, 0x0a, 0x65, 0x05, 0x02, 
+	0x00, 0x4a, 0x40, 0x85, 0x9f, 0x5f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x04, 0x0b, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 0x5f, 
+	0x75, 0x74, 0x69, 0x6c, 0x73, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x52, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x53, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x43, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x00, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0xf0, 0xbf, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x27, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x27, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x04, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x22, 0x00, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x2d, 0x2d, 0x5b, 0x5b, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x2d, 0x5d, 0x5d, 0x00, 0x04, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x2d, 0x00, 0x04, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x04, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x09, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 
+	0x73, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 
+	0x6e, 0x64, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x62, 0x72, 0x65, 0x61, 0x6b, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x64, 0x6f, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x65, 0x6c, 0x73, 0x65, 0x00, 0x04, 0x06, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6c, 0x73, 0x69, 0x66, 0x00, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x64, 0x00, 
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x61, 0x6c, 
+	0x73, 0x65, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x66, 0x6f, 0x72, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x6f, 0x74, 0x6f, 0x00, 
+	0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x66, 0x00, 
+	0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x00, 
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x63, 
+	0x61, 0x6c, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6e, 0x69, 0x6c, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6e, 0x6f, 0x74, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6f, 0x72, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x68, 
+	0x65, 0x6e, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x74, 0x72, 0x75, 0x65, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x00, 0x04, 0x06, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x00, 0x04, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x73, 0x73, 0x65, 
+	0x72, 0x74, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x69, 0x70, 0x61, 0x69, 0x72, 0x73, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x61, 0x64, 0x00, 0x04, 0x06, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x69, 0x72, 0x73, 0x00, 
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x72, 0x69, 
+	0x6e, 0x74, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x74, 0x6f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x00, 0x04, 0x09, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x73, 0x74, 0x72, 0x69, 
+	0x6e, 0x67, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x74, 0x79, 0x70, 0x65, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x69, 0x6f, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6d, 0x61, 0x74, 0x68, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x6f, 0x73, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x61, 0x62, 0x6c, 
+	0x65, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x47, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 
+	0x6e, 0x73, 0x65, 0x72, 0x74, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x2e, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x70, 0x61, 0x72, 0x73, 0x65, 0x00, 0x09, 0x00, 0x00, 0x00, 
+	0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x14, 
+	0x00, 0x00, 0x00, 0x86, 0x40, 0x40, 0x00, 0x87, 0x80, 0x40, 0x01, 0xc0, 
+	0x00, 0x80, 0x00, 0x9d, 0x80, 0x00, 0x01, 0x08, 0x80, 0x00, 0x80, 0x86, 
+	0x00, 0x40, 0x00, 0x19, 0x80, 0x80, 0x81, 0x17, 0x80, 0x02, 0x80, 0x85, 
+	0x00, 0x80, 0x00, 0xc6, 0x40, 0x40, 0x00, 0xc7, 0x00, 0xc1, 0x01, 0x00, 
+	0x01, 0x00, 0x00, 0xdd, 0x80, 0x00, 0x01, 0x96, 0xc0, 0x00, 0x01, 0x89, 
+	0x00, 0x80, 0x00, 0x86, 0x00, 0x40, 0x00, 0x8e, 0x40, 0x41, 0x01, 0x08, 
+	0x80, 0x00, 0x80, 0x17, 0x40, 0xfc, 0x7f, 0x1f, 0x00, 0x80, 0x00, 0x06, 
+	0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x68, 0x61, 0x72, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00, 
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x10, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 
+	0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x14, 0x00, 0x00, 0x00, 
+	0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 
+	0x1b, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 
+	0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 
+	0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 
+	0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 
+	0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 
+	0x1e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6c, 0x6f, 
+	0x75, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 
+	0x61, 0x6c, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 
+	0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x59, 0x45, 0x4c, 0x4c, 0x4f, 0x57, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 
+	0x2f, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 
+	0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 
+	0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 
+	0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x4c, 0x55, 0x45, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 
+	0x78, 0x2f, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 
+	0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 
+	0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x45, 0x44, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 
+	0x78, 0x2f, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 
+	0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 
+	0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x45, 0x56, 0x5f, 
+	0x43, 0x59, 0x41, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 
+	0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x5d, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 
+	0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x61, 0x64, 0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x43, 0x59, 0x41, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6c, 0x75, 0x61, 0x2e, 
+	0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 
+	0x5d, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 
+	0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 
+	0x00, 0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 
+	0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 
+	0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 
+	0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x47, 0x52, 0x45, 0x45, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6c, 0x75, 
+	0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x82, 0x00, 
+	0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 
+	0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 
+	0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x57, 0x48, 0x49, 0x54, 0x45, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 
+	0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 
+	0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 
+	0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5f, 0x45, 0x4e, 0x56, 0x00, 0x93, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 
+	0x49, 0x00, 0x00, 0x00, 0x46, 0x40, 0xc0, 0x00, 0x47, 0x80, 0xc0, 0x00, 
+	0x85, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x5d, 0x40, 0x80, 0x01, 
+	0x45, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 
+	0x03, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 
+	0x70, 0x65, 0x67, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
+	0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x14, 0x10, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 
+	0x2f, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x0a, 0x00, 0x00, 
+	0x00, 0x94, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 
+	0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 
+	0x00, 0x95, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 
+	0x00, 0x97, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 
+	0x6c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
+	0x6f, 0x6b, 0x65, 0x6e, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 
+	0x74, 0x61, 0x78, 0x2f, 0x6c, 0x75, 0x61, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0xc7, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 
+	0x09, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
+	0x20, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 
+	0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 
+	0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 
+	0x28, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 
+	0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 
+	0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 
+	0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 
+	0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 
+	0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 
+	0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 
+	0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 
+	0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 
+	0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 
+	0x33, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 
+	0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 
+	0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 
+	0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 
+	0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 
+	0x3a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 
+	0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 
+	0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 
+	0x3b, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 
+	0x3c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 
+	0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 
+	0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 
+	0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 
+	0x46, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 
+	0x49, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 
+	0x4c, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 
+	0x4f, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 
+	0x52, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 
+	0x55, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 
+	0x58, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 
+	0x5b, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 
+	0x46, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 
+	0x63, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 
+	0x66, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 
+	0x69, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 
+	0x6d, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 
+	0x73, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 
+	0x76, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 
+	0x79, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 
+	0x79, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 
+	0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 
+	0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 
+	0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 
+	0x7b, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 
+	0x7a, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 
+	0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 
+	0x82, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 
+	0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 
+	0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 
+	0x8e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 
+	0x8e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 
+	0x8e, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 
+	0x9c, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 
+	0x5f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x00, 0x03, 0x00, 0x00, 0x00, 0xc7, 
+	0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 
+	0x79, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x00, 0x04, 0x00, 0x00, 0x00, 
+	0xc7, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x05, 0x00, 0x00, 0x00, 0xc7, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
+	0x00, 0x09, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xc7, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xc7, 
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 
+	0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x00, 0x13, 0x00, 0x00, 0x00, 0xc7, 
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 
+	0x68, 0x61, 0x72, 0x6c, 0x69, 0x74, 0x00, 0x2d, 0x00, 0x00, 0x00, 0xc7, 
+	0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x6c, 0x69, 0x74, 0x00, 0x47, 0x00, 0x00, 
+	0x00, 0xc7, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x00, 0x4a, 0x00, 0x00, 
+	0x00, 0xc7, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x63, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x57, 0x00, 
+	0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x6e, 0x65, 0x77, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 
+	0x00, 0x60, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 
+	0x00, 0x63, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x69, 0x6e, 
+	0x67, 0x5f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x00, 0x6d, 0x00, 0x00, 0x00, 
+	0xc7, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72, 0x64, 0x00, 0x89, 0x00, 0x00, 0x00, 
+	0xc7, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x66, 0x75, 0x6e, 0x63, 0x00, 0x94, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 
+	0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x63, 
+	0x6b, 0x61, 0x67, 0x65, 0x73, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xc7, 0x00, 
+	0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 
+	0x6f, 0x72, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 
+	0x29, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x0c, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 
+	0x74, 0x61, 0x74, 0x65, 0x29, 0x00, 0x9e, 0x00, 0x00, 0x00, 0xb0, 0x00, 
+	0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 
+	0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 
+	0x9e, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xae, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 
+	0x9f, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x65, 0x6e, 
+	0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0xa3, 0x00, 0x00, 0x00, 
+	0xae, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x29, 0x00, 
+	0xa3, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 
+	0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xae, 0x00, 
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 
+	0xa4, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x76, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xac, 0x00, 
+	0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x75, 
+	0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0xb5, 0x00, 0x00, 0x00, 
+	0xc7, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x61, 0x6e, 0x79, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 0x65, 
+	0x6e, 0x73, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 
+	0x45, 0x4e, 0x56, 0x00, 0x00, 
+};
+unsigned int syntax_lua_luac_len = 4948;
+unsigned char syntax_makefile_luac[] = {
+	0x1b, 0x4c, 0x75, 0x61, 0x52, 0x00, 0x01, 0x04, 0x08, 0x04, 0x08, 0x00, 
+	0x19, 0x93, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+	0x00, 0x46, 0x00, 0x40, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x4a, 0x80, 0x80, 
+	0x80, 0x46, 0x00, 0x40, 0x00, 0xa5, 0x40, 0x00, 0x00, 0x4a, 0x80, 0x00, 
+	0x81, 0x65, 0x80, 0x00, 0x00, 0x0a, 0x40, 0x80, 0x81, 0x1f, 0x00, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+	0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 
+	0x5f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x00, 0x04, 
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x73, 
+	0x65, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x08, 0x0a, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 
+	0x00, 0xa5, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x01, 0x0c, 0x01, 0x40, 
+	0x00, 0x81, 0x41, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x01, 0x1d, 0x81, 0x00, 
+	0x02, 0xdd, 0x40, 0x00, 0x01, 0x5f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x67, 0x73, 0x75, 0x62, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x28, 0x2e, 0x2d, 0x29, 0x0d, 0x3f, 0x0a, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x46, 0x00, 0x40, 0x00, 0x47, 
+	0x40, 0xc0, 0x00, 0x85, 0x00, 0x80, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x5d, 
+	0x40, 0x80, 0x01, 0x41, 0x80, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x1f, 
+	0x00, 0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x65, 0x72, 
+	0x74, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
+	0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 
+	0x74, 0x61, 0x78, 0x2f, 0x6d, 0x61, 0x6b, 0x65, 0x66, 0x69, 0x6c, 0x65, 
+	0x2e, 0x6c, 0x75, 0x61, 0x00, 0x08, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 
+	0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x69, 0x6e, 0x65, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6d, 0x61, 0x6b, 0x65, 0x66, 
+	0x69, 0x6c, 0x65, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x0a, 0x00, 0x00, 0x00, 
+	0x11, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 
+	0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 
+	0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
+	0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 
+	0x56, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x07, 0x0f, 0x00, 0x00, 0x00, 0x86, 0x00, 0x40, 0x00, 0x87, 0x40, 0x40, 
+	0x01, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x81, 0x00, 0x00, 0x46, 0x01, 0x40, 
+	0x00, 0x47, 0xc1, 0xc0, 0x02, 0x80, 0x01, 0x80, 0x00, 0x5d, 0x01, 0x00, 
+	0x01, 0x9d, 0x80, 0x00, 0x00, 0x58, 0x40, 0x00, 0x01, 0x17, 0x00, 0x00, 
+	0x80, 0x83, 0x40, 0x00, 0x00, 0x83, 0x00, 0x80, 0x00, 0x9f, 0x00, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x75, 
+	0x62, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 
+	0x78, 0x2f, 0x6d, 0x61, 0x6b, 0x65, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 
+	0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 
+	0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 
+	0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 
+	0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 
+	0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x74, 0x72, 0x69, 0x6e, 
+	0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x72, 0x74, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0b, 
+	0x3e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x86, 0x80, 0x40, 0x00, 
+	0x87, 0xc0, 0x40, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x9d, 0x80, 0x00, 0x01, 
+	0x08, 0x80, 0x80, 0x80, 0x86, 0x00, 0x41, 0x00, 0xc6, 0x40, 0x40, 0x00, 
+	0x9d, 0x00, 0x01, 0x01, 0x17, 0x00, 0x0b, 0x80, 0xc6, 0x41, 0x41, 0x00, 
+	0x06, 0x82, 0x40, 0x00, 0x07, 0x82, 0x41, 0x04, 0x40, 0x02, 0x00, 0x03, 
+	0x81, 0xc2, 0x01, 0x00, 0x1d, 0x82, 0x80, 0x01, 0x1b, 0x02, 0x00, 0x00, 
+	0x17, 0x40, 0x00, 0x80, 0xc6, 0x01, 0x42, 0x00, 0x17, 0x00, 0x04, 0x80, 
+	0x06, 0x82, 0x40, 0x00, 0x07, 0x82, 0x41, 0x04, 0x40, 0x02, 0x00, 0x03, 
+	0x81, 0x42, 0x02, 0x00, 0x1d, 0x82, 0x80, 0x01, 0x1b, 0x02, 0x00, 0x00, 
+	0x17, 0x40, 0x00, 0x80, 0xc6, 0x81, 0x42, 0x00, 0x17, 0xc0, 0x01, 0x80, 
+	0x06, 0x82, 0x40, 0x00, 0x07, 0xc2, 0x42, 0x04, 0x40, 0x02, 0x00, 0x03, 
+	0x81, 0x02, 0x03, 0x00, 0x1d, 0x82, 0x80, 0x01, 0x1b, 0x02, 0x00, 0x00, 
+	0x17, 0x00, 0x00, 0x80, 0xc6, 0x41, 0x43, 0x00, 0x15, 0x02, 0x00, 0x03, 
+	0x08, 0x00, 0x02, 0x87, 0x06, 0x82, 0x43, 0x00, 0x19, 0x00, 0x82, 0x87, 
+	0x17, 0x40, 0x02, 0x80, 0x00, 0x02, 0x80, 0x00, 0x46, 0x82, 0x40, 0x00, 
+	0x47, 0x02, 0xc4, 0x04, 0x80, 0x02, 0x80, 0x03, 0x5d, 0x82, 0x00, 0x01, 
+	0x56, 0x40, 0x02, 0x04, 0x06, 0x82, 0x43, 0x00, 0x0e, 0x42, 0x44, 0x04, 
+	0x08, 0x00, 0x02, 0x87, 0x17, 0x80, 0xfc, 0x7f, 0x00, 0x02, 0x80, 0x00, 
+	0x46, 0x42, 0x41, 0x00, 0x56, 0x40, 0x02, 0x04, 0xa2, 0x80, 0x00, 0x00, 
+	0x23, 0x01, 0xf4, 0x7f, 0x86, 0x80, 0x44, 0x00, 0xc0, 0x00, 0x80, 0x00, 
+	0x9d, 0x80, 0x00, 0x01, 0x9f, 0x00, 0x00, 0x01, 0x1f, 0x00, 0x80, 0x00, 
+	0x13, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 
+	0x6d, 0x70, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x5f, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+	0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x70, 
+	0x61, 0x69, 0x72, 0x73, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x57, 0x48, 0x49, 0x54, 0x45, 0x00, 0x04, 0x07, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x00, 
+	0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x45, 0x44, 0x00, 
+	0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x4c, 0x55, 0x45, 
+	0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x69, 
+	0x6e, 0x64, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x3a, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 
+	0x45, 0x4c, 0x4c, 0x4f, 0x57, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x63, 0x68, 0x61, 0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0xf0, 0x3f, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x74, 0x6f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6d, 
+	0x61, 0x6b, 0x65, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x3e, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 
+	0x2a, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 
+	0x2a, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 
+	0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 
+	0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 
+	0x37, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 
+	0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 
+	0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 
+	0x3b, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 
+	0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 
+	0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 
+	0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 
+	0x48, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 
+	0x49, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 
+	0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 
+	0x4a, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 
+	0x4b, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 
+	0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 
+	0x2f, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 
+	0x54, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 
+	0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 
+	0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x10, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x67, 
+	0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x29, 0x00, 0x09, 0x00, 
+	0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 
+	0x29, 0x00, 0x09, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x0e, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x66, 0x6f, 0x72, 0x20, 0x63, 
+	0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x29, 0x00, 0x09, 0x00, 0x00, 0x00, 
+	0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x69, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x0a, 0x00, 0x00, 0x00, 
+	0x37, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x63, 0x6f, 0x6c, 0x6f, 0x75, 0x72, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x37, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x01, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 
+	0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6d, 0x61, 0x6b, 0x65, 0x66, 0x69, 
+	0x6c, 0x65, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x10, 
+	0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1b, 
+	0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x5a, 
+	0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x79, 0x6d, 0x6f, 0x64, 
+	0x75, 0x6c, 0x65, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x5f, 0x45, 0x4e, 0x56, 0x00, 0x00, 
+};
+unsigned int syntax_makefile_luac_len = 2081;
+unsigned char syntax_markdown_luac[] = {
+	0x1b, 0x4c, 0x75, 0x61, 0x52, 0x00, 0x01, 0x04, 0x08, 0x04, 0x08, 0x00, 
+	0x19, 0x93, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x0d, 0x38, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+	0x00, 0x41, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x08, 0x80, 0x80, 
+	0x80, 0x86, 0x80, 0x40, 0x00, 0x87, 0xc0, 0x40, 0x01, 0xc6, 0x80, 0x40, 
+	0x00, 0xc7, 0x00, 0xc1, 0x01, 0x06, 0x81, 0x40, 0x00, 0x07, 0x41, 0x41, 
+	0x02, 0x46, 0x81, 0x40, 0x00, 0x47, 0x81, 0xc1, 0x02, 0x80, 0x01, 0x00, 
+	0x02, 0xc1, 0xc1, 0x01, 0x00, 0x9d, 0x81, 0x00, 0x01, 0xc0, 0x01, 0x00, 
+	0x01, 0x01, 0x02, 0x02, 0x00, 0xdd, 0x81, 0x00, 0x01, 0x0e, 0x82, 0x81, 
+	0x84, 0x12, 0x82, 0x42, 0x04, 0xcf, 0x01, 0x82, 0x03, 0x25, 0x42, 0x00, 
+	0x00, 0xd0, 0x01, 0x82, 0x03, 0x00, 0x02, 0x00, 0x01, 0x41, 0xc2, 0x02, 
+	0x00, 0x1d, 0x82, 0x00, 0x01, 0x4e, 0x82, 0x81, 0x84, 0x52, 0x82, 0xc2, 
+	0x04, 0x0f, 0x42, 0x02, 0x04, 0x65, 0x82, 0x00, 0x00, 0x10, 0x42, 0x02, 
+	0x04, 0x40, 0x02, 0x00, 0x02, 0x81, 0x02, 0x03, 0x00, 0x5d, 0x82, 0x00, 
+	0x01, 0x52, 0x42, 0xc2, 0x04, 0x80, 0x02, 0x00, 0x02, 0xc1, 0x42, 0x03, 
+	0x00, 0x9d, 0x82, 0x00, 0x01, 0x4f, 0x82, 0x82, 0x04, 0xa5, 0xc2, 0x00, 
+	0x00, 0x50, 0x82, 0x82, 0x04, 0x80, 0x02, 0x80, 0x02, 0xc0, 0x02, 0x00, 
+	0x01, 0x01, 0x43, 0x02, 0x00, 0xdd, 0x02, 0x00, 0x01, 0x9d, 0x82, 0x00, 
+	0x00, 0xe5, 0x02, 0x01, 0x00, 0x90, 0xc2, 0x02, 0x05, 0xcd, 0x02, 0x82, 
+	0x03, 0xcd, 0x42, 0x82, 0x05, 0xcd, 0x82, 0x82, 0x05, 0xd2, 0x82, 0xc2, 
+	0x05, 0x25, 0x43, 0x01, 0x00, 0x0a, 0x00, 0x03, 0x87, 0x1f, 0x00, 0x00, 
+	0x01, 0x1f, 0x00, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 0x02, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x04, 0x02, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5d, 0x3e, 0x20, 0x0a, 0x00, 0x04, 0x08, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x03, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 
+	0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x09, 
+	0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 
+	0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 
+	0x73, 0x65, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x21, 
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x14, 0x00, 0x00, 0x00, 0x86, 0x40, 
+	0x40, 0x00, 0x87, 0x80, 0x40, 0x01, 0xc0, 0x00, 0x80, 0x00, 0x9d, 0x80, 
+	0x00, 0x01, 0x08, 0x80, 0x00, 0x80, 0x86, 0x00, 0x40, 0x00, 0x19, 0x80, 
+	0x80, 0x81, 0x17, 0x80, 0x02, 0x80, 0x85, 0x00, 0x80, 0x00, 0xc6, 0x40, 
+	0x40, 0x00, 0xc7, 0x00, 0xc1, 0x01, 0x00, 0x01, 0x00, 0x00, 0xdd, 0x80, 
+	0x00, 0x01, 0x96, 0xc0, 0x00, 0x01, 0x89, 0x00, 0x80, 0x00, 0x86, 0x00, 
+	0x40, 0x00, 0x8e, 0x40, 0x41, 0x01, 0x08, 0x80, 0x00, 0x80, 0x17, 0x40, 
+	0xfc, 0x7f, 0x1f, 0x00, 0x80, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x67, 0x74, 
+	0x68, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6c, 0x65, 0x6e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x63, 0x68, 0x61, 0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x01, 0x01, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 
+	0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6d, 0x61, 0x72, 0x6b, 0x64, 
+	0x6f, 0x77, 0x6e, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x14, 0x00, 0x00, 0x00, 
+	0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 
+	0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 
+	0x1d, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 
+	0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 
+	0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 
+	0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 
+	0x1f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6c, 0x6f, 
+	0x75, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 
+	0x61, 0x6c, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 
+	0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 
+	0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x52, 0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6d, 0x61, 
+	0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 
+	0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x2e, 0x00, 0x00, 0x00, 
+	0x2e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 
+	0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 
+	0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 
+	0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x4c, 0x55, 
+	0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 
+	0x74, 0x61, 0x78, 0x2f, 0x6d, 0x61, 0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 
+	0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 
+	0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 
+	0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 
+	0x56, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x03, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 
+	0x00, 0xa6, 0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x61, 0x64, 0x64, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x52, 0x45, 0x56, 0x5f, 0x43, 0x59, 0x41, 0x4e, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 
+	0x78, 0x2f, 0x6d, 0x61, 0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x2e, 0x6c, 
+	0x75, 0x61, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 
+	0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x05, 
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x46, 0x40, 0x40, 0x00, 0xa6, 
+	0x00, 0x00, 0x00, 0x1d, 0x40, 0x00, 0x00, 0x1f, 0x00, 0x80, 0x00, 0x02, 
+	0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x61, 0x64, 0x64, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x57, 0x48, 0x49, 0x54, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6d, 0x61, 0x72, 
+	0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x2e, 0x6c, 0x75, 0x61, 0x00, 0x05, 0x00, 
+	0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 
+	0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x40, 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x41, 0x00, 
+	0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x46, 0x40, 0xc0, 0x00, 0x47, 0x80, 
+	0xc0, 0x00, 0x85, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x5d, 0x40, 
+	0x80, 0x01, 0x45, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x01, 0x1f, 0x00, 
+	0x80, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x6c, 0x70, 0x65, 0x67, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x0b, 0x15, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 
+	0x61, 0x78, 0x2f, 0x6d, 0x61, 0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x2e, 
+	0x6c, 0x75, 0x61, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 
+	0x3d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 
+	0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 
+	0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+	0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x05, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 0x4e, 0x56, 0x00, 0x07, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 0x73, 
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x40, 0x73, 0x79, 0x6e, 0x74, 0x61, 0x78, 0x2f, 0x6d, 
+	0x61, 0x72, 0x6b, 0x64, 0x6f, 0x77, 0x6e, 0x2e, 0x6c, 0x75, 0x61, 0x00, 
+	0x38, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 
+	0x21, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 
+	0x23, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 
+	0x25, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 
+	0x26, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 
+	0x2a, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 
+	0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 
+	0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 
+	0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 
+	0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 
+	0x2e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 
+	0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 
+	0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 
+	0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 
+	0x34, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 
+	0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+	0x3c, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 
+	0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x6d, 0x79, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x00, 0x01, 0x00, 0x00, 
+	0x00, 0x38, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x00, 0x72, 0x65, 0x74, 0x76, 0x61, 0x6c, 0x00, 0x02, 0x00, 0x00, 0x00, 
+	0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x50, 0x00, 0x06, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x08, 0x00, 0x00, 0x00, 
+	0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x53, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x0c, 0x00, 0x00, 0x00, 
+	0x38, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+	0x74, 0x65, 0x72, 0x6d, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x74, 0x74, 
+	0x70, 0x00, 0x17, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x06, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x74, 0x74, 0x70, 0x73, 0x00, 
+	0x1f, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 
+	0x00, 0x00, 0x00, 0x00, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x69, 0x6e, 0x67, 
+	0x5f, 0x73, 0x70, 0x61, 0x63, 0x65, 0x00, 0x29, 0x00, 0x00, 0x00, 0x38, 
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 
+	0x6e, 0x79, 0x00, 0x30, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x07, 
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x6f, 0x6b, 0x65, 0x6e, 
+	0x73, 0x00, 0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 
+	0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x45, 
+	0x4e, 0x56, 0x00, 0x00, 
+};
+unsigned int syntax_markdown_luac_len = 2235;
+
+static const struct
+{
+    const char *name;
+    const unsigned char *data;
+    const unsigned int *len;
+} embedded_files[] =
+{
+    { "kilua", kilua_luac, &kilua_luac_len },
+    { "syntax/cc", syntax_cc_luac, &syntax_cc_luac_len },
+    { "syntax/email", syntax_email_luac, &syntax_email_luac_len },
+    { "syntax/go", syntax_go_luac, &syntax_go_luac_len },
+    { "syntax/html", syntax_html_luac, &syntax_html_luac_len },
+    { "syntax/ini", syntax_ini_luac, &syntax_ini_luac_len },
+    { "syntax/lisp", syntax_lisp_luac, &syntax_lisp_luac_len },
+    { "syntax/lpeg_utils", syntax_lpeg_utils_luac, &syntax_lpeg_utils_luac_len },
+    { "syntax/lua", syntax_lua_luac, &syntax_lua_luac_len },
+    { "syntax/makefile", syntax_makefile_luac, &syntax_makefile_luac_len },
+    { "syntax/markdown", syntax_markdown_luac, &syntax_markdown_luac_len },
+    { NULL, NULL, NULL }
+};
@@ -37,17 +37,75 @@
 #include <string.h>
 #include <string>
 #include <sys/ioctl.h>
-#include <netdb.h>
-#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/utsname.h>
 
 #include "editor.h"
+#include "embedded.h"
 #include "intro.h"
+#include "profiler.h"
 #include "util.h"
 
 
 bool one_key_pressed = false;
 std::vector<std::string> intro;
 
+
+/*
+ * The minimum time between screen updates, in milliseconds, when
+ * input is arriving faster than we can draw it.
+ */
+#define FRAME_INTERVAL 16
+
+/*
+ * How long we'll wait for the remainder of a bracketed paste.
+ */
+#define PASTE_TIMEOUT 500
+
+/*
+ * How long after the last keystroke the `on_idle` hook is invoked.
+ */
+#define IDLE_DELAY 750
+
+/*
+ * How long a hook may run for, in milliseconds, by default.
+ */
+#define HOOK_BUDGET 1000
+
+/*
+ * How many consecutive overruns of its budget disable a hook.
+ */
+#define HOOK_STRIKES 3
+
+/*
+ * How many Lua instructions are executed between checks of a budget.
+ */
+#define WATCHDOG_STEP 1000
+
+/*
+ * How long, in milliseconds, we'll run the garbage-collector for when
+ * we're idle.
+ */
+#define GC_BUDGET 5
+
+/*
+ * The most times a macro will be replayed "until it fails".
+ */
+#define MACRO_LIMIT 10000
+
+
+/**
+ * Report an error raised outside of any protected call, as the standard
+ * Lua allocator does, before we're aborted.
+ */
+static int lua_panic(lua_State *L)
+{
+    endwin();
+    fprintf(stderr, "PANIC: unprotected error in call to Lua API (%s)\n", lua_tostring(L, -1));
+    return 0;
+}
+
+
 /**
  * Constructor.
  */
@@ -62,58 +120,155 @@ Editor::Editor()
     /*
      * Create a new buffer for messages.
      */
-    Buffer *tmp = new Buffer("*Messages*");
-    m_state->buffers.push_back(tmp);
+    add_buffer(new Buffer("*Messages*"));
     m_state->current_buffer = 0;
 
+    /*
+     * Find the size of the terminal.
+     */
+    m_state->term_rows = 0;
+    m_state->term_cols = 0;
+    m_state->update_size();
+
     /*
      * Ensure that our status-message is empty.
      */
     memset(m_state->statusmsg, '\0', sizeof(m_state->statusmsg));
 
+    /*
+     * We're not recording, or replaying, a keyboard macro.
+     */
+    m_state->recording = false;
+    m_state->replaying = false;
+
+    m_last_frame = 0;
+    m_headless   = false;
+
+    /*
+     * Create the event-loop, though we don't handle any signals
+     * until our main-loop is running.
+     */
+    m_events = new EventLoop();
+    m_idle   = -1;
+
+    m_keymap = new Keymap();
+    m_status_line = new StatusLine();
+    m_stats = new Stats();
 
     /*
      * Setup lua.
      */
-    m_lua = luaL_newstate();
+    m_pool = new Pool();
+    m_lua  = lua_newstate(Pool::alloc, m_pool);
+
+    /*
+     * LuaJIT, on 64-bit systems, insists upon its own allocator.
+     */
+    if (m_lua == NULL)
+    {
+        delete (m_pool);
+        m_pool = NULL;
+        m_lua  = luaL_newstate();
+    }
+    else
+    {
+        lua_atpanic(m_lua, lua_panic);
+    }
+
+    m_gc_floor = 0;
+
     luaopen_base(m_lua);
     luaL_openlibs(m_lua);
+    lua_compat_open(m_lua);
+
+    /*
+     * Allow the syntax-modules built into the editor to be loaded.
+     */
+    embedded_searcher_install(m_lua);
+
+    /*
+     * Ensure the processes Lua launches receive signals normally.
+     */
+    wrap_launchers();
+
+    /*
+     * Cache references to our hooks, as they're defined, and limit how
+     * long each may run.
+     */
+    watch_hooks();
+
+    for (int i = 0; i < HOOK_MAX; i++)
+    {
+        m_budgets[i].time         = HOOK_BUDGET;
+        m_budgets[i].instructions = 0;
+        m_budgets[i].overruns     = 0;
+        m_budgets[i].disabled     = false;
+    }
+
+    m_budgeted = -1;
 
     /*
      * Bind functions.
      */
+    lua_register(m_lua, "add_cursor", add_cursor_lua);
     lua_register(m_lua, "at", at_lua);
+    lua_register(m_lua, "bind", bind_lua);
+    lua_register(m_lua, "budget", budget_lua);
     lua_register(m_lua, "buffer", buffer_lua);
     lua_register(m_lua, "buffer_data", buffer_data_lua);
     lua_register(m_lua, "buffer_name", buffer_name_lua);
     lua_register(m_lua, "buffers", buffers_lua);
+    lua_register(m_lua, "cancel_timer", cancel_timer_lua);
+    lua_register(m_lua, "clear_cursors", clear_cursors_lua);
     lua_register(m_lua, "create_buffer", create_buffer_lua);
+    lua_register(m_lua, "cursors", cursors_lua);
     lua_register(m_lua, "delete", delete_lua);
     lua_register(m_lua, "directory_entries", directory_entries_lua);
     lua_register(m_lua, "dirty", dirty_lua);
+    lua_register(m_lua, "each_line", each_line_lua);
     lua_register(m_lua, "eof", eof_lua);
     lua_register(m_lua, "eol", eol_lua);
     lua_register(m_lua, "exists", exists_lua);
     lua_register(m_lua, "exit", exit_lua);
+    lua_register(m_lua, "gc", gc_lua);
+    lua_register(m_lua, "get_buffer", get_buffer_lua);
     lua_register(m_lua, "height", height_lua);
+    lua_register(m_lua, "highlight", highlight_lua);
     lua_register(m_lua, "insert", insert_lua);
     lua_register(m_lua, "key", key_lua);
     lua_register(m_lua, "kill_buffer", kill_buffer_lua);
+    lua_register(m_lua, "kill_process", kill_process_lua);
+    lua_register(m_lua, "line", line_lua);
+    lua_register(m_lua, "lines", lines_lua);
+    lua_register(m_lua, "macro_record", macro_record_lua);
+    lua_register(m_lua, "macro_replay", macro_replay_lua);
+    lua_register(m_lua, "macro_stop", macro_stop_lua);
     lua_register(m_lua, "mark", mark_lua);
     lua_register(m_lua, "menu", menu_lua);
     lua_register(m_lua, "move", move_lua);
     lua_register(m_lua, "open", open_lua);
     lua_register(m_lua, "point", point_lua);
+    lua_register(m_lua, "profile_start", profile_start_lua);
+    lua_register(m_lua, "profile_stop", profile_stop_lua);
     lua_register(m_lua, "prompt", prompt_lua);
     lua_register(m_lua, "save", save_lua);
     lua_register(m_lua, "search", search_lua);
     lua_register(m_lua, "selection", selection_lua);
     lua_register(m_lua, "sof", sof_lua);
     lua_register(m_lua, "sol", sol_lua);
+    lua_register(m_lua, "spawn", spawn_lua);
+    lua_register(m_lua, "stats", stats_lua);
     lua_register(m_lua, "status", status_lua);
+    lua_register(m_lua, "status_format", status_format_lua);
+    lua_register(m_lua, "status_invalidate", status_invalidate_lua);
     lua_register(m_lua, "syntax", syntax_lua);
+    lua_register(m_lua, "tab_width", tab_width_lua);
     lua_register(m_lua, "text", text_lua);
+    lua_register(m_lua, "timer", timer_lua);
+    lua_register(m_lua, "unbind", unbind_lua);
+    lua_register(m_lua, "unwatch_fd", unwatch_fd_lua);
     lua_register(m_lua, "update_colours", update_colours_lua);
+    lua_register(m_lua, "watch_fd", watch_fd_lua);
     lua_register(m_lua, "width", width_lua);
 
     /*
@@ -169,6 +324,21 @@ Editor::Editor()
  */
 Editor::~Editor()
 {
+    /*
+     * These hold references to Lua functions, so they must be released
+     * before the Lua state is closed.
+     */
+    delete (m_status_line);
+    delete (m_keymap);
+    delete (m_events);
+    delete (m_stats);
+
+    lua_close(m_lua);
+    delete (m_pool);
+
+    for (std::vector<Buffer *>::iterator it = m_state->buffers.begin(); it != m_state->buffers.end(); ++it)
+        delete (*it);
+
     delete (m_state);
 }
 
@@ -187,16 +357,16 @@ void Editor::load_files(std::vector<std::string> files)
         for (std::vector<std::string>::iterator it = files.begin(); it != files.end(); ++it)
         {
             Buffer *tmp = new Buffer((*it).c_str());
-            m_state->buffers.push_back(tmp);
+            add_buffer(tmp);
             m_state->current_buffer = m_state->buffers.size() - 1;
 
-            call_lua("open", "s>", (*it).c_str());
+            call_lua(HOOK_OPEN, (*it).c_str());
         }
     }
     else
     {
         Buffer *tmp = new Buffer("default");
-        m_state->buffers.push_back(tmp);
+        add_buffer(tmp);
         m_state->current_buffer = m_state->buffers.size() - 1;
     }
 }
@@ -208,690 +378,1913 @@ void Editor::load_files(std::vector<std::string> files)
  */
 void Editor::main_loop()
 {
+    /*
+     * Handle the terminal being resized.
+     */
+    m_events->watch_signal(SIGWINCH, [this]()
+    {
+        resize();
+    });
+
+    /*
+     * Let the idle-hook run once at startup.
+     */
+    schedule_idle();
 
     while (1)
     {
         unsigned int ch;
 
-        int res = get_wch(&ch);
+        /*
+         * Read a key, if one is pending.
+         */
+        timeout(0);
+        int res = read_key(&ch);
+        timeout(-1);
 
         /*
-         * Chances are this was a timeout.
-         *
-         * So invoke the handler and redraw.
+         * If there was no key then wait for one, and redraw the
+         * screen if a timer, signal, or file-descriptor was handled
+         * in the meantime.
          */
         if (res == ERR)
         {
-            call_lua("on_idle", ">");
-            draw_screen();
+            if (m_events->wait(-1))
+                draw_screen();
+
             continue;
         }
 
         /*
-         * We've had at least one keystroke - so the welcome
-         * message can go away.
+         * Process the key.
          */
-        one_key_pressed = true;
+        {
+            stat_timer timer(m_stats, STAT_KEY);
+            process_key(ch);
+        }
 
         /*
-         * Expand the key.
+         * Before we redraw process any further input which is pending,
+         * so that a burst of keys results in a single update.
+         *
+         * If we've drawn recently we'll wait for more input until the
+         * frame-interval has passed, to cap our redraw-rate.
          */
-        const char *name = lookup_key(ch);
+        while (true)
+        {
+            long wait = FRAME_INTERVAL - (Util::now_ms() - m_last_frame);
 
+            timeout(wait > 0 ? wait : 0);
+            res = read_key(&ch);
+            timeout(-1);
 
-        if (strcmp(name, "KEY_RESIZE") == 0)
-            continue;
+            if (res == ERR)
+                break;
 
-        /*
-         * This is a bit horrid.
-         *
-         * The intention is to ensure that Lua can process special
-         * key-strokes, and they are not inserted.
-         */
-        if (name && strlen(name) > 1 &&
-                (
-                    (strncmp(name, "KEY_", 4) == 0) ||
-                    (name[0] == '^') ||
-                    (strncmp(name, "ESC", 3) == 0)
-                ))
-        {
-            call_lua("on_key", "s>", name);
-        }
-        else
-        {
-            /*
-             * Convert the character to a string, then call Lua.
-             */
-            char *ascii = Util::wchar2ascii(ch);
-            call_lua("on_key", "s>", ascii);
-            delete []ascii;
+            stat_timer timer(m_stats, STAT_KEY);
+            process_key(ch);
         }
 
         /*
          * Draw the screen.
          */
         draw_screen();
+
+        /*
+         * The idle-hook runs once input has stopped.
+         */
+        schedule_idle();
     }
 }
 
 
 /**
- * Return the current buffer.
+ * Schedule the `on_idle` hook to run once input has stopped.
  */
-Buffer *Editor::current_buffer()
+void Editor::schedule_idle()
 {
-    return (m_state->buffers.at(m_state->current_buffer));
+    if (m_idle != -1)
+        m_events->cancel_timer(m_idle);
+
+    m_idle = m_events->add_timer(IDLE_DELAY, [this]()
+    {
+        m_idle = -1;
+
+        {
+            stat_timer timer(m_stats, STAT_IDLE);
+            call_lua(HOOK_ON_IDLE);
+        }
+
+        collect_garbage();
+        return false;
+    });
 }
 
 
 /**
- * Return the text in the status-bar.
+ * Run the garbage-collector for a while, as we're idle.
  */
-char * Editor::get_status()
+void Editor::collect_garbage()
 {
-    return (m_state->statusmsg);
+    /*
+     * Nothing much has been allocated since the last collection.
+     */
+    int used = lua_gc(m_lua, LUA_GCCOUNT, 0);
+
+    if (used < m_gc_floor + m_gc_floor / 10 + 64)
+        return;
+
+    stat_timer timer(m_stats, STAT_GC);
+    long deadline = Util::now_us() + GC_BUDGET * 1000;
+
+    while (Util::now_us() < deadline)
+    {
+        if (lua_gc(m_lua, LUA_GCSTEP, 0))
+        {
+            m_gc_floor = lua_gc(m_lua, LUA_GCCOUNT, 0);
+            break;
+        }
+    }
 }
 
 
 /**
- * Set the status-bar text.
+ * Handle the terminal being resized.
  */
-void Editor::set_status(int log, const char *fmt, ...)
+void Editor::resize()
 {
-    va_list ap;
-    va_start(ap, fmt);
-    memset(m_state->statusmsg, '\0', sizeof(m_state->statusmsg));
-    vsnprintf(m_state->statusmsg, sizeof(m_state->statusmsg) - 1, fmt, ap);
-    va_end(ap);
+    if (!m_state->update_size())
+        return;
+
+    resizeterm(m_state->term_rows, m_state->term_cols);
 
     /*
-     * Append the message to the *Messages* buffer.
+     * Scroll each buffer so that its point is still visible.
      */
-    if (log)
+    for (auto it = m_state->buffers.begin(); it != m_state->buffers.end(); ++it)
     {
-        int old = m_state->current_buffer;
+        Buffer *buffer = (*it);
+        show_point(buffer, buffer->cx + buffer->coloff, buffer->cy + buffer->rowoff);
+    }
+
+    /*
+     * Repaint the whole screen when it is next drawn.
+     */
+    clearok(curscr, TRUE);
+}
 
-        int b = buffer_by_name("*Messages*");
 
-        if (b != -1)
-        {
-            m_state->current_buffer = b;
+/**
+ * Get the event-loop, to register timers and file-descriptors.
+ */
+EventLoop *Editor::events()
+{
+    return (m_events);
+}
 
-            wchar_t *wide = Util::ascii2wide(m_state->statusmsg);
-            int size = wcslen(wide);
 
-            for (int i = 0; i < size; i++)
-            {
-                insert(wide[i]);
-            }
+/**
+ * Get the Lua state.
+ */
+lua_State *Editor::lua()
+{
+    return (m_lua);
+}
 
-            delete []wide;
 
-            insert('\n');
-            m_state->current_buffer = old;
-        }
-    }
+/**
+ * Get the key-bindings.
+ */
+Keymap *Editor::keymap()
+{
+    return (m_keymap);
 }
 
 
 /**
- * Draw the screen, as well as the status-bar and the message-area.
+ * Get the status-bar template.
  */
-void Editor::draw_screen()
+StatusLine *Editor::status_line()
 {
-    /*
-     * Clear the screen.
-     */
-    clear();
+    return (m_status_line);
+}
 
-    /*
-     * The current buffer, and row-count.
-     */
-    Buffer *cur = m_state->buffers.at(m_state->current_buffer);
-    int rows = cur->rows.size();
 
+/**
+ * Get the timings of the phases of our main-loop.
+ */
+Stats *Editor::stats()
+{
+    return (m_stats);
+}
+
+
+/**
+ * Get the allocator of our Lua state.
+ */
+Pool *Editor::pool()
+{
+    return (m_pool);
+}
+
+
+/**
+ * Read a single key, from the macro being replayed, or the terminal.
+ */
+int Editor::read_key(unsigned int *ch)
+{
     /*
-     * Width of screen.
+     * Replaying a macro?  Then return the next key.
      */
-    int w = width();
+    if (!m_state->replay.empty())
+    {
+        *ch = m_state->replay.front();
+        m_state->replay.pop_front();
+        return OK;
+    }
 
     /*
-     * Count of characters which are before the screen position.
-     *
-     * We use this to show the marked region.
+     * Poll the terminal, and if there is nothing available wait upon
+     * our event-loop until there is - or until the curses delay has
+     * passed.
      */
-    int count = 0;
+    int delay = wgetdelay(stdscr);
+    long deadline = Util::now_ms() + delay;
+    long entered  = Util::now_us();
+    long start = Util::now_us();
+    int res;
 
-    for (int y = 0; y < cur->rowoff; y++)
+    timeout(0);
+
+    while ((res = get_wch(ch)) == ERR && delay != 0)
     {
-        erow *row = cur->rows.at(y);
-        int row_size = row->chars->size();
-        count += row_size + 1;
+        long remaining = deadline - Util::now_ms();
+
+        if (delay > 0 && remaining <= 0)
+            break;
+
+        m_events->wait(delay > 0 ? remaining : -1);
+        start = Util::now_us();
     }
 
+    timeout(delay);
+
     /*
-     * The position of the point and mark.
+     * Time the read which returned a key, not our wait for it.
      */
-    int m_pos = cur->pos2offset(cur->markx, cur->marky);
-    int c_pos = cur->pos2offset(cur->cx + cur->coloff,  cur->cy + cur->rowoff);
+    if (res != ERR)
+        m_stats->record(STAT_READ, Util::now_us() - start);
 
     /*
-     * The character offsets - the characters between these
-     * two numbers should be in reverse.
+     * A hook waiting for a key, via `key()` or `prompt()`, isn't running
+     * so its budget is extended by the time we waited.
      */
-    int sel_min = std::min(m_pos, c_pos);
-    int sel_max = std::max(m_pos, c_pos);
+    extend_budget(Util::now_us() - entered);
 
     /*
-     * If the mark is not set disable the whole damn thing.
+     * Record the key, if we're recording a macro.
      */
-    if ((cur->markx == -1) && (cur->marky == -1))
-    {
-        sel_min = -1;
-        sel_max = -1;
-    }
+    if ((res != ERR) && m_state->recording)
+        m_state->macro.push_back(*ch);
 
+    return res;
+}
 
-    /*
-     * For each row ..
-     */
-    for (int y = 0; y < m_state->screenrows();  y++)
+
+/**
+ * Push the given keys back, so that they will be read again.
+ */
+void Editor::unread_keys(std::vector<unsigned int> keys)
+{
+    for (std::vector<unsigned int>::reverse_iterator it = keys.rbegin(); it != keys.rend(); ++it)
     {
-        /*
-         * If this row is past the end of our list - draw "~" and exit.
-         */
-        if ((y + cur->rowoff) >= rows)
+        if (m_state->replaying)
         {
-            std::wstring x;
-            x += '~';
-
-            /* Reset to white */
-            color_set(7, NULL);
-            mvwaddwstr(stdscr, y, 0, x.c_str());
-            continue;
+            m_state->replay.push_front(*it);
         }
-
-        /*
-         * The row of characters.
-         */
-        erow *row = cur->rows.at(y + cur->rowoff);
-        int row_max = row->chars->size();
-
-        /*
-         * For each possible position in the row
-         */
-        int x = 0;
-
-        for (int c = 0; c < row_max; c++)
+        else
         {
+            unget_wch(*it);
+
             /*
-             * If this character is visible ..
+             * The key will be recorded again when it is re-read.
              */
-            if ((c >= cur->coloff) && (c < (cur->coloff + w)))
-            {
-                /*
-                 * Default colour - white.
-                 */
-                int col = 7;
-
-                /*
-                 * Get & set the colour.
-                 */
-                if (c < (int)row->cols->size())
-                    col = row->cols->at(c);
-
-                color_set(col, NULL);
-
-                /*
-                 * Is the current character between the point
-                 * and the mark?  If so enable the reverse-drawing.
-                 */
-                if (count >= sel_min && count <= sel_max)
-                    attron(A_STANDOUT);
-
-                /*
-                 * Draw the character.
-                 */
-                std::wstring t = row->chars->at(c);
-
-                /*
-                 * Is it a TAB?  Change to space, because otherwise
-                 * trailing whitespace screws up.
-                 */
-                if (t.at(0) == '\t')
-                    t = ' ';
-
-                /*
-                 * Draw the character, and reset the colour to white.
-                 */
-                mvwaddwstr(stdscr, y, x, t.c_str());
-                color_set(7, NULL); /* white */
-
-                /*
-                 * Is the current character between the point
-                 * and the mark?  If so disable the reverse-drawing.
-                 */
-                if (count >= sel_min && count <= sel_max)
-                    attroff(A_STANDOUT);
-
-                count += 1;
-
-                x += 1;
-            }
-            else
-            {
-                /*
-                 *  none visible character in the row, we must
-                 * account for it still.
-                 */
-                count += 1;
-            }
+            if (m_state->recording && !m_state->macro.empty())
+                m_state->macro.pop_back();
         }
-
-        count += 1; /*newline*/
     }
+}
 
-    if ((rows == 1) && (one_key_pressed == false))
-    {
-        /*
-         * Setup the introductionary message.
-         */
-        init_intro();
-
-        int row = 0;
-
-        for (auto it = intro.begin(); it != intro.end() ; ++it)
-        {
-            mvwaddstr(stdscr, row, 0, (*it).c_str());
-            row += 1;
-        }
-    }
 
+/**
+ * Having read an ESC, read the text of a bracketed-paste, if that
+ * is what follows.
+ *
+ * A paste is sent by the terminal as "ESC [200~", the text, then
+ * "ESC [201~".
+ */
+bool Editor::read_paste(std::wstring &text)
+{
+    const char *start = "[200~";
+    const std::wstring end = L"\033[201~";
 
+    int delay = wgetdelay(stdscr);
 
     /*
-     * Get the status-bar from Lua, if we can.
+     * Look for the rest of the start-sequence, which will already
+     * be pending if this is a paste.
      */
-    char* result = NULL;
-    call_lua("get_status_bar", ">s",  &result);
-    std::string status;
+    std::vector<unsigned int> seen;
+    timeout(0);
 
-    if (result)
-        status = result;
-    else
-        status = "Please define 'get_status_bar()'";
+    for (const char *p = start; *p; p++)
+    {
+        unsigned int ch;
 
-    while ((int)status.length() < m_state->screencols())
+        if (read_key(&ch) == ERR)
+            break;
+
+        seen.push_back(ch);
+
+        if (ch != (unsigned int)(*p))
+            break;
+    }
+
+    if (seen.size() != strlen(start) || seen.back() != '~')
     {
-        status += " ";
+        timeout(delay);
+        unread_keys(seen);
+        return false;
     }
 
     /*
-     * Enable reverse.
+     * Read the text, until we find the end-sequence.
      */
-    attron(A_STANDOUT);
-    mvwaddstr(stdscr, m_state->screenrows(), 0, status.c_str());
-    attroff(A_STANDOUT);
+    timeout(PASTE_TIMEOUT);
 
-    /*
-     * Draw the message-area.
-     */
-    std::string s = get_status();
+    while (true)
+    {
+        unsigned int ch;
 
-    if ((int)s.length() >  m_state->screencols())
-        s = s.substr(s.length() - m_state->screencols() + 1);
+        if (read_key(&ch) == ERR)
+            break;
 
-    while ((int)s.length() < m_state->screencols())
-    {
-        s += " ";
+        /*
+         * Terminals send newlines as carriage-returns.
+         */
+        if (ch == '\r')
+            ch = '\n';
+
+        text += (wchar_t)ch;
+
+        if (text.size() >= end.size() &&
+                text.compare(text.size() - end.size(), end.size(), end) == 0)
+        {
+            text.erase(text.size() - end.size());
+            break;
+        }
     }
 
-    mvwaddstr(stdscr, m_state->screenrows() + 1, 0, s.c_str());
+    timeout(delay);
+    return true;
+}
 
-    /*
-     * The cursor can't be in the bottom two lines.
-     */
-    if (cur->cy >= (m_state->screenrows()))
-        cur->cy  = (m_state->screenrows() - 1);
 
+/**
+ * Process the given keys, as if they'd been typed in a burst.
+ */
+void Editor::process_keys(const std::vector<unsigned int> &keys)
+{
     /*
-     * Show the cursor in the right location.
+     * The keys are queued as if they were a macro, so that they're
+     * read by anything which reads input while they're processed.
      */
-    ::move(cur->cy, cur->cx);
+    m_state->replay.insert(m_state->replay.end(), keys.begin(), keys.end());
 
+    unsigned int ch;
 
-    refresh();
+    while (!m_state->replay.empty() && read_key(&ch) == OK)
+        process_key(ch);
 }
 
-/*
- * Magic.
+
+/**
+ * Process a single key, by passing it to Lua.
  */
-void Editor::insert(wchar_t c)
+bool Editor::process_key(unsigned int ch)
 {
     /*
-     * Get the current buffer.
+     * We've had at least one keystroke - so the welcome
+     * message can go away.
      */
-    Buffer *cur = m_state->buffers.at(m_state->current_buffer);
+    one_key_pressed = true;
 
     /*
-     * Current offset
+     * Pasted text is inserted directly, rather than passing each
+     * character to Lua.
      */
-    int row = cur->cy + cur->rowoff;
-    int col = cur->cx + cur->coloff;
+    std::wstring pasted;
+
+    if (ch == 27 && read_paste(pasted))
+    {
+        insert(pasted);
+        current_buffer()->set_dirty(true);
+        return true;
+    }
 
     /*
-     * The current row.
+     * Expand the key.
      */
-    erow *cur_row = cur->rows.at(row);
+    const char *name = lookup_key(ch);
+
+
+    if (strcmp(name, "KEY_RESIZE") == 0)
+    {
+        resize();
+        return true;
+    }
 
     /*
-     * If inserting a newline that's the same as inserting
-     * a new row.
+     * Special keys are known by their names, and can't be inserted.
      */
-    if (c == '\n')
+    bool special = (name && strlen(name) > 1 &&
+                    (
+                        (strncmp(name, "KEY_", 4) == 0) ||
+                        (name[0] == '^') ||
+                        (strncmp(name, "ESC", 3) == 0)
+                    ));
+
+    /*
+     * If nothing has been bound then we pass every key to Lua, as
+     * configuration files written before `bind` existed expect.
+     */
+    if (m_keymap->empty())
     {
-        /*
-         * OK the user pressed RETURN.
-         *
-         * We know this means we need to create a new-line, which we'll insert.
-         */
-        erow *new_row = new erow();
+        if (special)
+            return (call_lua(HOOK_ON_KEY, name));
 
-        /*
-         * Take the characters in the current row after the point.
-         *
-         * We're going to remove them, and insert them at the start
-         * of the new row.
-         */
-        std::vector<std::wstring> tmp;
+        char ascii[Util::max_len + 1];
+        ascii[Util::utf8_encode(ch, ascii)] = '\0';
 
-        /*
-         * Copy the characters after the point.
-         */
-        for (std::vector<std::wstring>::iterator it = cur_row->chars->begin() + col; it != cur_row->chars->end(); ++it)
-        {
-            tmp.push_back(*it);
-        }
+        return (call_lua(HOOK_ON_KEY, ascii));
+    }
 
+    /*
+     * Lookup the binding, by name if the key has one.
+     */
+    std::string key;
 
-        /*
-         * Add the characters onto the new row.
-         */
-        for (std::vector<std::wstring>::iterator it = tmp.begin(); it != tmp.end(); ++it)
-        {
-            new_row->chars->push_back(*it);
-        }
+    if (special || ch == '\n' || ch == '\t' || ch == ' ')
+    {
+        key = name;
+    }
+    else
+    {
+        char ascii[Util::max_len];
+        key.assign(ascii, Util::utf8_encode(ch, ascii));
+    }
 
-        /*
-         * Erase the characters from the current row.
-         */
-        cur_row->chars->erase(cur_row->chars->begin() + col, cur_row->chars->end());
+    std::function<bool()> fn;
 
-        /*
-         * Insert the new row.
-         */
-        cur->rows.insert(cur->rows.begin() + row + 1, new_row);
+    switch (m_keymap->lookup(key, fn))
+    {
+    case BINDING_FOUND:
+        return (fn());
 
-        /*
-         * Because we've added a new row we need to move down one
-         * row, and to the start of the next line.
-         */
-        move("down");
-        sol_lua(NULL);
-        return;
-    }
+    case BINDING_PREFIX:
+        return true;
 
-    /*
-     * Trying to insert a character at an impossible position?
-     */
-    if (row > (int) cur->rows.size())
-        return ;
+    case BINDING_UNDEFINED:
+        set_status(0, "%s is undefined", m_keymap->sequence().c_str());
+        return false;
 
+    case BINDING_NONE:
+        break;
+    }
 
     /*
-     * We have a row.  Insert the character.
+     * Unbound special keys are passed to `on_key`, if it is defined,
+     * everything else is inserted.
      */
-    std::wstring x;
-    x += c;
+    if (special)
+    {
+        call_lua(HOOK_ON_KEY, name);
+        return true;
+    }
 
-    /*
-     * Insert the new character at the correct position.
-     */
-    cur_row->chars->insert(cur_row->chars->begin() + col, x);
+    insert((wchar_t)ch);
+    current_buffer()->set_dirty(true);
+    return true;
+}
 
-    /*
-     * Move right - this handles scrolling correctly.
-     */
-    move("right");
 
+/**
+ * Start recording a keyboard macro.
+ */
+void Editor::macro_record()
+{
+    if (m_state->replaying)
+        return;
+
+    m_state->macro.clear();
+    m_state->recording = true;
+    set_status(0, "Recording macro");
 }
 
 
-/*
- * More magic.
+/**
+ * Stop recording a keyboard macro.
  */
-void Editor::delete_char()
+void Editor::macro_stop(int drop)
 {
-    /*
-     * There are two cases - deletion from the middle/end
-     * of a row, and deletion at the start of the row.
-     *
-     * The first case is simple, we just find the current
-     * row and erase one "character" from it.
-     *
-     * The second case is harder, we need to remove the
-     * current row, and append the characters after the mark
-     * to it.
-     *
-     * punt for now
-     */
+    if (!m_state->recording)
+    {
+        set_status(0, "Not recording a macro");
+        return;
+    }
 
-    /*
-     * Get the current buffer.
-     */
-    Buffer *cur = m_state->buffers.at(m_state->current_buffer);
+    m_state->recording = false;
 
     /*
-     * Current offset
+     * Remove the keys which stopped the recording.
      */
-    int row = cur->cy + cur->rowoff;
-    int col = cur->cx + cur->coloff;
+    while (drop > 0 && !m_state->macro.empty())
+    {
+        m_state->macro.pop_back();
+        drop--;
+    }
 
-    /*
-     * Deleting from the top of the file is impossible.
-     */
-    if ((col == 0) && (row == 0))
+    set_status(0, "Recorded macro of %d keys", (int)m_state->macro.size());
+}
+
+
+/**
+ * Replay the recorded keyboard macro.
+ *
+ * The screen is not updated while we replay, the caller (typically the
+ * main-loop) will draw it once we're done.
+ */
+int Editor::macro_replay(int count)
+{
+    if (m_state->recording || m_state->replaying)
     {
-        return;
+        set_status(1, "Cannot replay a macro while recording, or replaying");
+        return 0;
     }
 
-    if (col == 0)
+    if (m_state->macro.empty())
     {
+        set_status(1, "There is no macro to replay");
+        return 0;
+    }
+
+    m_state->replaying = true;
 
+    int done = 0;
+    bool failed = false;
+    bool interrupted = false;
+
+    while ((count <= 0) || (done < count))
+    {
         /*
-         * The current row, and the previous row.
+         * Allow a long replay to be interrupted via ^G, leaving any
+         * other pending key for the main-loop.
          */
-        erow *p_row = cur->rows.at(row - 1);
-        int p_len = p_row->chars->size();
-        erow *c_row = cur->rows.at(row);
+        wint_t pending;
+        int delay = wgetdelay(stdscr);
+        timeout(0);
+        int res = get_wch(&pending);
+        timeout(delay);
+
+        if (res != ERR)
+        {
+            if (pending == 7)
+            {
+                interrupted = true;
+                break;
+            }
+
+            unget_wch(pending);
+        }
 
         /*
-         * For each character in the current row, append to the previous.
+         * Replaying is invoked from a key-binding, but each replay
+         * runs within a budget of its own.
          */
-        for (std::vector<std::wstring>::iterator it = c_row->chars->begin() + col; it != c_row->chars->end(); ++it)
+        if (m_budgeted != -1)
         {
-            p_row->chars->push_back(*it);
+            m_budget_deadline     = Util::now_us() + m_budgets[m_budgeted].time * 1000L;
+            m_budget_instructions = 0;
         }
 
         /*
-         * Now delete the current row.
+         * Record where we are, so we can tell if we got stuck.
          */
-        cur->rows.erase(cur->rows.begin() + row);
-        delete c_row;
+        Buffer *before = current_buffer();
+        int y = before->cy + before->rowoff;
 
         /*
-         * Finally we need to move the cursor to the correct location.
-         *
-         * The correct location is the end of the old line.
+         * Queue the keys, then process them.
          */
-        move("up");
-        sol_lua(NULL);
+        m_state->replay.assign(m_state->macro.begin(), m_state->macro.end());
 
-        while (p_len)
+        while (!m_state->replay.empty())
         {
-            move("right");
-            p_len--;
+            unsigned int ch;
+
+            if (read_key(&ch) == ERR || !process_key(ch))
+            {
+                failed = true;
+                break;
+            }
         }
 
-        return;
-    }
+        m_state->replay.clear();
 
-    /*
-     * deleting from the middle of a row.
-     */
-    erow *cur_row = cur->rows.at(row);
-    cur_row->chars->erase(cur_row->chars->begin() + col - 1);
-    move("left");
-}
+        if (failed)
+            break;
 
+        done += 1;
 
-/**
- * Convert the given key to a human-readable version of it.
- */
-const char *Editor::lookup_key(unsigned int c)
-{
-    if (c == 0)
-        return ("^ ");
+        /*
+         * When replaying without a count stop once the macro no
+         * longer moves the point down the buffer, or the point has
+         * reached the end of it.  A macro which inserts text always
+         * moves the point, so that alone isn't enough to stop on the
+         * last line, and we cap the replays in case nothing else does.
+         */
+        if (count > 0)
+            continue;
 
-    if (c == '\n')
-        return ("ENTER");
+        Buffer *after = current_buffer();
+        int ax = after->cx + after->coloff;
+        int ay = after->cy + after->rowoff;
+        int last = (int)after->rows.size() - 1;
 
-    if (c == 27)
-        return ("ESC");
+        if ((after != before) || (ay <= y) || (done >= MACRO_LIMIT))
+            break;
 
-    if (c == '\t')
-        return ("TAB");
+        if ((ay >= last) &&
+                (last < 0 || ax >= (int)after->rows.at(last)->chars->size()))
+            break;
+    }
 
-    if (c == ' ')
-        return ("SPACE");
+    m_state->replaying = false;
 
-    return (keyname(c));
+    if (interrupted)
+        set_status(1, "Macro interrupted after %d replays", done);
+    else if (failed)
+        set_status(1, "Macro failed after %d replays", done);
+    else
+        set_status(0, "Replayed macro %d times", done);
+
+    return (done);
 }
 
 
 /**
- * Call a lua function, with variadic arguments.
+ * Return the current buffer.
  */
-void Editor::call_lua(const char *func, const char *sig, ...)
+Buffer *Editor::current_buffer()
 {
-    va_list vl;
-    int narg, nres;
-
-    va_start(vl, sig);
-
-    lua_getglobal(m_lua, func);
-
-    if (lua_isnil(m_lua, -1))
-        return;
-
-    /* push arguments */
-    narg = 0;
+    return (m_state->buffers.at(m_state->current_buffer));
+}
 
-    while (*sig)
-    {
-        /* push arguments */
-        switch (*sig++)
-        {
 
-        case 'd':  /* double argument */
-            lua_pushnumber(m_lua, va_arg(vl, double));
-            break;
+/**
+ * Return the text in the status-bar.
+ */
+char * Editor::get_status()
+{
+    return (m_state->statusmsg);
+}
 
-        case 'i':  /* int argument */
-            lua_pushnumber(m_lua, va_arg(vl, int));
-            break;
 
-        case 's':  /* string argument */
-            lua_pushstring(m_lua, va_arg(vl, char *));
-            break;
+/**
+ * Set the status-bar text.
+ */
+void Editor::set_status(int log, const char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    memset(m_state->statusmsg, '\0', sizeof(m_state->statusmsg));
+    vsnprintf(m_state->statusmsg, sizeof(m_state->statusmsg) - 1, fmt, ap);
+    va_end(ap);
+
+    /*
+     * Without a terminal nobody would see the message, so report it
+     * along with the name of the buffer it concerns.
+     */
+    if (m_headless)
+    {
+        if (m_state->statusmsg[0] != '\0')
+            fprintf(stderr, "%s: %s\n", current_buffer()->get_name(), m_state->statusmsg);
+        return;
+    }
+
+    /*
+     * Append the message to the *Messages* buffer.
+     */
+    if (log)
+        log_message("%s", m_state->statusmsg);
+}
+
+
+/**
+ * Append a message to the *Messages* buffer, without changing the
+ * status-text.
+ */
+void Editor::log_message(const char *fmt, ...)
+{
+    char msg[sizeof(m_state->statusmsg)];
+
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(msg, sizeof(msg), fmt, ap);
+    va_end(ap);
+
+    int b = buffer_by_name("*Messages*");
+
+    if (b != -1)
+    {
+        std::wstring line;
+        Util::utf8_to_wide(msg, line);
+
+        line += '\n';
+        insert(line, m_state->buffers.at(b));
+    }
+}
+
+
+/**
+ * Draw the screen, as well as the status-bar and the message-area.
+ */
+void Editor::draw_screen()
+{
+    /*
+     * Don't draw anything while a macro is being replayed, or if we've
+     * no terminal.
+     */
+    if (m_state->replaying || m_headless)
+        return;
+
+    long start = Util::now_us();
+
+    /*
+     * Clear the screen.
+     */
+    clear();
+
+    /*
+     * The current buffer, and row-count.
+     */
+    Buffer *cur = m_state->buffers.at(m_state->current_buffer);
+    int rows = cur->rows.size();
+
+    /*
+     * Width of screen, and the distance between tab stops.
+     */
+    int w    = width();
+    int tabs = cur->tab_width();
+
+    /*
+     * The point might have been moved without scrolling to it, for
+     * example to the start of the line, so ensure it is visible.
+     */
+    if (cur->cy + cur->rowoff < rows)
+        show_point(cur, cur->cx + cur->coloff, cur->cy + cur->rowoff);
+
+    /*
+     * Count of characters which are before the screen position.
+     *
+     * We use this to show the marked region.
+     */
+    int count = 0;
+
+    for (int y = 0; y < cur->rowoff; y++)
+    {
+        erow *row = cur->rows.at(y);
+        int row_size = row->chars->size();
+        count += row_size + 1;
+    }
+
+    /*
+     * The position of the point and mark.
+     */
+    int m_pos = cur->pos2offset(cur->markx, cur->marky);
+    int c_pos = cur->pos2offset(cur->cx + cur->coloff,  cur->cy + cur->rowoff);
+
+    /*
+     * The character offsets - the characters between these
+     * two numbers should be in reverse.
+     */
+    int sel_min = std::min(m_pos, c_pos);
+    int sel_max = std::max(m_pos, c_pos);
+
+    /*
+     * If the mark is not set disable the whole damn thing.
+     */
+    if ((cur->markx == -1) && (cur->marky == -1))
+    {
+        sel_min = -1;
+        sel_max = -1;
+    }
+
+
+    /*
+     * For each row ..
+     */
+    for (int y = 0; y < m_state->screenrows();  y++)
+    {
+        /*
+         * If this row is past the end of our list - draw "~" and exit.
+         */
+        if ((y + cur->rowoff) >= rows)
+        {
+            std::wstring x;
+            x += '~';
+
+            /* Reset to white */
+            color_set(7, NULL);
+            mvwaddwstr(stdscr, y, 0, x.c_str());
+            continue;
+        }
+
+        /*
+         * The row of characters.
+         */
+        erow *row = cur->rows.at(y + cur->rowoff);
+        int row_max = row->chars->size();
+
+        /*
+         * The display column at which we start drawing, which is the
+         * same for every row.
+         */
+        int start = cur->scroll;
+
+        /*
+         * Draw only the characters which are visible, starting with
+         * the one at the left edge of the screen - `count` is the
+         * offset of the character we're drawing.
+         */
+        int first = row->index(start, tabs);
+        int base  = count;
+        int x     = 0;
+
+        for (int c = first; c < row_max; c++)
+        {
+            int width = row->width(c, tabs);
+
+            x     = row->column(c, tabs) - start;
+            count = base + c;
+
+            /*
+             * Past the right edge of the screen?
+             */
+            if (x + width > w)
+                break;
+
+            /*
+             * A character which began before the left edge isn't drawn.
+             */
+            if (x < 0)
+                continue;
+
+            /*
+             * Default colour - white.
+             */
+            int col = 7;
+
+            /*
+             * Get & set the colour.
+             */
+            if (c < (int)row->cols->size())
+                col = row->cols->at(c);
+
+            color_set(col, NULL);
+
+            /*
+             * Is the current character between the point
+             * and the mark, or under an additional cursor?  If
+             * so enable the reverse-drawing.
+             */
+            bool standout = (count >= sel_min && count <= sel_max) ||
+                            (!cur->cursors.empty() && cur->has_cursor(c, y + cur->rowoff));
+
+            if (standout)
+                attron(A_STANDOUT);
+
+            /*
+             * Draw the character, and reset the colour to white.
+             */
+            draw_cell(y, x, row->chars->at(c), width);
+            color_set(7, NULL); /* white */
+
+            /*
+             * Disable the reverse-drawing, if we enabled it.
+             */
+            if (standout)
+                attroff(A_STANDOUT);
+        }
+
+        count = base + row_max;
+
+        x = row->column(row_max, tabs) - start;
+
+        /*
+         * An additional cursor might be at the end of the row.
+         */
+        if (!cur->cursors.empty() && cur->has_cursor(row_max, y + cur->rowoff) &&
+                (x >= 0) && (x < w))
+        {
+            attron(A_STANDOUT);
+            mvwaddstr(stdscr, y, x, " ");
+            attroff(A_STANDOUT);
+        }
+
+        count += 1; /*newline*/
+    }
+
+    if ((rows == 1) && (one_key_pressed == false))
+    {
+        /*
+         * Setup the introductionary message.
+         */
+        init_intro();
+
+        int row = 0;
+
+        for (auto it = intro.begin(); it != intro.end() ; ++it)
+        {
+            mvwaddstr(stdscr, row, 0, (*it).c_str());
+            row += 1;
+        }
+    }
+
+
+
+    /*
+     * Render the status-bar from our template, or get it from Lua.
+     */
+    std::string status;
+
+    if (!m_status_line->format().empty())
+        status = render_status();
+    else if (!call_lua_result(HOOK_GET_STATUS_BAR, status))
+        status = "Please define 'get_status_bar()'";
+
+    while ((int)status.length() < m_state->screencols())
+    {
+        status += " ";
+    }
+
+    /*
+     * Enable reverse.
+     */
+    attron(A_STANDOUT);
+    mvwaddstr(stdscr, m_state->screenrows(), 0, status.c_str());
+    attroff(A_STANDOUT);
+
+    /*
+     * Draw the message-area.
+     */
+    std::string s = get_status();
+
+    if ((int)s.length() >  m_state->screencols())
+        s = s.substr(s.length() - m_state->screencols() + 1);
+
+    while ((int)s.length() < m_state->screencols())
+    {
+        s += " ";
+    }
+
+    mvwaddstr(stdscr, m_state->screenrows() + 1, 0, s.c_str());
+
+    /*
+     * The cursor can't be in the bottom two lines.
+     */
+    if (cur->cy >= (m_state->screenrows()))
+        cur->cy  = (m_state->screenrows() - 1);
+
+    /*
+     * Show the cursor in the right location, which is the display column
+     * of the point, relative to that of the left edge of the screen.
+     */
+    int cx = cur->cx;
+
+    if (cur->cy + cur->rowoff < rows)
+    {
+        erow *row = cur->rows.at(cur->cy + cur->rowoff);
+        int len   = row->chars->size();
+
+        cx = row->column(std::min(cur->cx + cur->coloff, len), tabs) - cur->scroll;
+    }
+
+    ::move(cur->cy, std::min(cx, w - 1));
+
+    m_stats->record(STAT_DRAW, Util::now_us() - start);
+
+    {
+        stat_timer timer(m_stats, STAT_REFRESH);
+        refresh();
+    }
+
+    m_last_frame = Util::now_ms();
+}
+
+/**
+ * Draw a single character, as the layout of its row describes it.
+ */
+void Editor::draw_cell(int y, int x, const std::wstring &cell, int width)
+{
+    wchar_t c = cell.empty() ? ' ' : cell.at(0);
+
+    /*
+     * A TAB is drawn as the spaces up to the next tab stop.
+     */
+    if (c == '\t')
+    {
+        mvwprintw(stdscr, y, x, "%*s", width, "");
+        return;
+    }
+
+    /*
+     * Control characters are shown as "^X".
+     */
+    if (c < 0x20 || c == 0x7F)
+    {
+        char ctrl[3] = { '^', (char)(c ^ 0x40), '\0' };
+        mvwaddstr(stdscr, y, x, ctrl);
+        return;
+    }
+
+    /*
+     * A byte which wasn't valid UTF-8.
+     */
+    if (c >= 0xDC80 && c <= 0xDCFF)
+    {
+        if (wcwidth(0xFFFD) == 1)
+            mvwaddwstr(stdscr, y, x, L"\xFFFD");
+        else
+            mvwaddstr(stdscr, y, x, "?");
+
+        return;
+    }
+
+    /*
+     * A character joined to its predecessor, such as the parts of an
+     * emoji sequence, takes no room of its own - and few terminals can
+     * draw it, so we show only the first.  Combining characters are
+     * drawn, and curses adds them to the previous cell.
+     */
+    if (width == 0 && wcwidth(c) != 0)
+        return;
+
+    mvwaddwstr(stdscr, y, x, cell.c_str());
+}
+
+
+/*
+ * Magic.
+ */
+void Editor::insert(wchar_t c)
+{
+    /*
+     * Get the current buffer.
+     */
+    Buffer *cur = m_state->buffers.at(m_state->current_buffer);
+
+    /*
+     * If there are additional cursors then we insert at each of them.
+     */
+    if (!cur->cursors.empty())
+    {
+        insert_all(c);
+        return;
+    }
+
+    /*
+     * Current offset
+     */
+    int row = cur->cy + cur->rowoff;
+    int col = cur->cx + cur->coloff;
+
+    /*
+     * Trying to insert a character at an impossible position?
+     */
+    if (row >= (int) cur->rows.size())
+        return ;
+
+    /*
+     * If inserting a newline that's the same as inserting
+     * a new row.
+     */
+    if (c == '\n')
+    {
+        /*
+         * OK the user pressed RETURN.
+         *
+         * The characters after the point move onto a new row.
+         */
+        cur->split_row(col, row);
+
+        /*
+         * Because we've added a new row we need to move down one
+         * row, and to the start of the next line.
+         */
+        move("down");
+        sol_lua(NULL);
+        return;
+    }
+
+    /*
+     * Insert the new character at the correct position.
+     */
+    cur->insert_char(col, row, c);
+
+    /*
+     * Move right - this handles scrolling correctly.
+     */
+    move("right");
+
+}
+
+
+/*
+ * Insert a string, leaving the point after it.
+ */
+void Editor::insert(const std::wstring &text, Buffer *buffer)
+{
+    Buffer *current = m_state->buffers.at(m_state->current_buffer);
+    Buffer *cur     = buffer ? buffer : current;
+
+    /*
+     * If there are additional cursors then we insert at each of them,
+     * which is only possible in the current buffer.
+     */
+    if (cur == current && !cur->cursors.empty())
+    {
+        for (std::wstring::const_iterator it = text.begin(); it != text.end(); ++it)
+            insert_all(*it);
+
+        return;
+    }
+
+    if (text.empty())
+        return;
+
+    int row = cur->cy + cur->rowoff;
+    int col = cur->cx + cur->coloff;
+
+    if (row >= (int) cur->rows.size())
+        return;
+
+    cursor end = cur->insert_text(col, row, text);
+
+    show_point(cur, end.x, end.y);
+}
+
+
+/*
+ * Append a string to the end of the given buffer.
+ */
+void Editor::append(Buffer *buffer, const std::wstring &text)
+{
+    /*
+     * Is the point at the end of the buffer?
+     */
+    int x = buffer->cx + buffer->coloff;
+    int y = buffer->cy + buffer->rowoff;
+
+    int last = buffer->rows.size() - 1;
+    int end  = buffer->rows.at(last)->chars->size();
+
+    bool follow = (y == last && x == end);
+
+    /*
+     * Insert at the end, without additional cursors.
+     */
+    std::vector<cursor> cursors;
+    cursors.swap(buffer->cursors);
+
+    show_point(buffer, end, last);
+    insert(text, buffer);
+
+    if (!follow)
+        show_point(buffer, x, y);
+
+    buffer->cursors.swap(cursors);
+}
+
+
+/*
+ * More magic.
+ */
+void Editor::delete_char()
+{
+    /*
+     * There are two cases - deletion from the middle/end
+     * of a row, and deletion at the start of the row.
+     *
+     * The first case is simple, we just find the current
+     * row and erase one "character" from it.
+     *
+     * The second case is harder, we need to remove the
+     * current row, and append the characters after the mark
+     * to it.
+     *
+     * punt for now
+     */
+
+    /*
+     * Get the current buffer.
+     */
+    Buffer *cur = m_state->buffers.at(m_state->current_buffer);
+
+    /*
+     * If there are additional cursors then we delete at each of them.
+     */
+    if (!cur->cursors.empty())
+    {
+        delete_all();
+        return;
+    }
+
+    /*
+     * Current offset
+     */
+    int row = cur->cy + cur->rowoff;
+    int col = cur->cx + cur->coloff;
+
+    /*
+     * Deleting from the top of the file is impossible.
+     */
+    if ((col == 0) && (row == 0))
+    {
+        return;
+    }
+
+    if (col == 0)
+    {
+
+        /*
+         * Append the current row to the previous one.
+         */
+        int p_len = cur->join_row(row);
+
+        /*
+         * Finally we need to move the cursor to the correct location.
+         *
+         * The correct location is the end of the old line.
+         */
+        move("up");
+        sol_lua(NULL);
+
+        while (p_len)
+        {
+            move("right");
+            p_len--;
+        }
+
+        return;
+    }
+
+    /*
+     * deleting from the middle of a row.
+     */
+    cur->delete_char(col - 1, row);
+    move("left");
+}
+
+
+/**
+ * Insert the given character at every cursor.
+ *
+ * We walk the cursors in order, applying the edit to each in turn, and
+ * keep track of how far the previous edits have shifted the rows, and
+ * the columns of the current row, so each cursor is adjusted as we go.
+ */
+void Editor::insert_all(wchar_t c)
+{
+    Buffer *cur = current_buffer();
+
+    /*
+     * All the cursors - including the point - in order.
+     */
+    std::vector<cursor> all = cur->cursors;
+    cursor point(cur->cx + cur->coloff, cur->cy + cur->rowoff);
+    all.insert(std::lower_bound(all.begin(), all.end(), point), point);
+
+    std::vector<cursor> result;
+
+    int dy = 0;
+    int dx = 0;
+    int last = -1;
+
+    for (std::vector<cursor>::iterator it = all.begin(); it != all.end(); ++it)
+    {
+        /*
+         * Column shifts only apply within a single (original) row.
+         */
+        if ((*it).y != last)
+        {
+            dx   = 0;
+            last = (*it).y;
+        }
+
+        int x = (*it).x + dx;
+        int y = (*it).y + dy;
+
+        if (c == '\n')
+        {
+            /*
+             * Split the row, moving the characters after the
+             * cursor onto a new row beneath it.
+             */
+            cur->split_row(x, y);
 
-        case '>':
-            goto endwhile;
+            dy += 1;
+            dx  = -(*it).x;
 
-        default:
+            result.push_back(cursor(0, y + 1));
+        }
+        else
+        {
+            cur->insert_char(x, y, c);
+
+            dx += 1;
+
+            result.push_back(cursor(x + 1, y));
+        }
+
+        if ((*it) == point)
+            point = result.back();
+    }
+
+    /*
+     * Update the additional cursors, and the point.
+     */
+    cur->cursors.clear();
+
+    for (std::vector<cursor>::iterator it = result.begin(); it != result.end(); ++it)
+    {
+        if (!((*it) == point))
+            cur->cursors.push_back(*it);
+    }
+
+    show_point(cur, point.x, point.y);
+}
+
+
+/**
+ * Delete one character, backwards, at every cursor.
+ *
+ * As with insertion we walk the cursors in order, keeping track of the
+ * shifts which previous deletions have caused.
+ */
+void Editor::delete_all()
+{
+    Buffer *cur = current_buffer();
+
+    /*
+     * All the cursors - including the point - in order.
+     */
+    std::vector<cursor> all = cur->cursors;
+    cursor point(cur->cx + cur->coloff, cur->cy + cur->rowoff);
+    all.insert(std::lower_bound(all.begin(), all.end(), point), point);
+
+    std::vector<cursor> result;
+
+    int dy = 0;
+    int dx = 0;
+    int last = -1;
+
+    for (std::vector<cursor>::iterator it = all.begin(); it != all.end(); ++it)
+    {
+        if ((*it).y != last)
+        {
+            dx   = 0;
+            last = (*it).y;
+        }
+
+        int x = (*it).x + dx;
+        int y = (*it).y + dy;
+
+        if (x > 0)
+        {
+            /*
+             * Deleting from the middle of a row.
+             */
+            cur->delete_char(x - 1, y);
+
+            dx -= 1;
+
+            result.push_back(cursor(x - 1, y));
+        }
+        else if (y > 0)
+        {
+            /*
+             * Deleting at the start of a row joins it to the previous one.
+             */
+            int p_len = cur->join_row(y);
+
+            /*
+             * Any cursors we've already placed on the joined row move too.
+             */
+            for (std::vector<cursor>::reverse_iterator r = result.rbegin(); r != result.rend() && (*r).y == y; ++r)
+            {
+                (*r).x += p_len;
+                (*r).y -= 1;
+            }
+
+            dy -= 1;
+            dx += p_len;
+
+            result.push_back(cursor(p_len, y - 1));
+        }
+        else
         {
-            fprintf(stderr, "invalid option (%c)", *(sig - 1));
-            return;
+            /*
+             * Deleting from the top of the file is impossible.
+             */
+            result.push_back(cursor(0, 0));
         }
+
+        if ((*it) == point)
+            point = result.back();
+    }
+
+    /*
+     * Cursors which have met are merged, then we update the additional
+     * cursors, and the point.
+     */
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+
+    cur->cursors.clear();
+
+    for (std::vector<cursor>::iterator it = result.begin(); it != result.end(); ++it)
+    {
+        if (!((*it) == point))
+            cur->cursors.push_back(*it);
+    }
+
+    show_point(cur, point.x, point.y);
+}
+
+
+/**
+ * Move the point to the given absolute position, scrolling only as
+ * much as is required to make it visible.
+ */
+void Editor::show_point(Buffer *buffer, int x, int y)
+{
+    int h = height();
+    int w = width();
+
+    if (y < buffer->rowoff)
+        buffer->rowoff = y;
+
+    if (y >= buffer->rowoff + h)
+        buffer->rowoff = y - h + 1;
+
+    /*
+     * Scroll, by display columns, until the character at the point, or
+     * the cursor at the end of the row, fits upon the screen.
+     */
+    erow *row = buffer->rows.at(y);
+    int len   = row->chars->size();
+    int tabs  = buffer->tab_width();
+
+    x = std::max(0, std::min(x, len));
+
+    int left  = row->column(x, tabs);
+    int right = left + ((x < len) ? std::max(row->width(x, tabs), 1) : 1);
+
+    if (left < buffer->scroll)
+        buffer->scroll = left;
+
+    if (right - buffer->scroll > w)
+        buffer->scroll = right - w;
+
+    /*
+     * The point is stored as the character at the left edge of the
+     * screen, upon its row, and its offset from that.
+     */
+    buffer->coloff = std::min(row->index(buffer->scroll, tabs), x);
+    buffer->cy     = y - buffer->rowoff;
+    buffer->cx     = x - buffer->coloff;
+}
+
+
+/**
+ * Convert the given key to a human-readable version of it.
+ */
+const char *Editor::lookup_key(unsigned int c)
+{
+    if (c == 0)
+        return ("^ ");
+
+    if (c == '\n')
+        return ("ENTER");
+
+    if (c == 27)
+        return ("ESC");
+
+    if (c == '\t')
+        return ("TAB");
+
+    if (c == ' ')
+        return ("SPACE");
+
+    return (keyname(c));
+}
+
+
+/*
+ * The names of our hooks, in the same order as the `lua_hook` enum.
+ */
+static const char *hook_names[HOOK_MAX] =
+{
+    "get_status_bar",
+    "on_complete",
+    "on_idle",
+    "on_key",
+    "on_loaded",
+    "on_save",
+    "on_saved",
+    "open",
+    "binding",
+    "on_exit",
+    "timer",
+    "watch_fd",
+};
+
+
+/**
+ * Watch the assignment of global variables.
+ *
+ * A `__newindex` metamethod is only invoked when a key is missing from a
+ * table, so to notice a hook being redefined we store the hooks in a
+ * shadow-table, rather than in `_G` itself.  `__index` and `__pairs`
+ * make the shadow-table invisible to Lua code.
+ */
+void Editor::watch_hooks()
+{
+    for (int i = 0; i < HOOK_MAX; i++)
+        m_hooks[i] = LUA_REFNIL;
+
+    lua_pushglobaltable(m_lua);
+    lua_newtable(m_lua);
+
+    /*
+     * The shadow-table is used for lookups, and is an upvalue of the
+     * other metamethods - along with ourselves.
+     */
+    lua_newtable(m_lua);
+
+    lua_pushvalue(m_lua, -1);
+    lua_setfield(m_lua, -3, "__index");
+
+    lua_pushvalue(m_lua, -1);
+    lua_pushlightuserdata(m_lua, this);
+    lua_pushcclosure(m_lua, hook_newindex, 2);
+    lua_setfield(m_lua, -3, "__newindex");
+
+    lua_pushcclosure(m_lua, hook_pairs, 1);
+    lua_setfield(m_lua, -2, "__pairs");
+
+    lua_setmetatable(m_lua, -2);
+    lua_pop(m_lua, 1);
+}
+
+
+/**
+ * A new global is being defined.
+ *
+ * If it is one of our hooks store it in the shadow-table, and update
+ * our reference to it, otherwise store it in `_G` as normal.
+ */
+int Editor::hook_newindex(lua_State *L)
+{
+    const char *name = lua_type(L, 2) == LUA_TSTRING ? lua_tostring(L, 2) : NULL;
+
+    for (int i = 0; name != NULL && i < HOOK_GLOBALS; i++)
+    {
+        if (strcmp(name, hook_names[i]) != 0)
+            continue;
+
+        lua_pushvalue(L, 2);
+        lua_pushvalue(L, 3);
+        lua_rawset(L, lua_upvalueindex(1));
+
+        /*
+         * We're invoked as the editor is constructed, so we can't use
+         * Editor::instance().
+         */
+        Editor *e = (Editor *)lua_touserdata(L, lua_upvalueindex(2));
+        luaL_unref(L, LUA_REGISTRYINDEX, e->m_hooks[i]);
+
+        lua_pushvalue(L, 3);
+        e->m_hooks[i] = luaL_ref(L, LUA_REGISTRYINDEX);
+
+        /*
+         * A new definition gets a fresh start.
+         */
+        e->m_budgets[i].overruns = 0;
+        e->m_budgets[i].disabled = false;
+        return 0;
+    }
+
+    lua_rawset(L, 1);
+    return 0;
+}
+
+
+/**
+ * Iterate over `_G`, and then the hooks in our shadow-table.
+ */
+int Editor::hook_pairs(lua_State *L)
+{
+    lua_pushvalue(L, lua_upvalueindex(1));
+    lua_pushcclosure(L, hook_next, 1);
+    lua_pushvalue(L, 1);
+    lua_pushnil(L);
+    return 3;
+}
+
+
+/**
+ * Find the next key, and value, of `_G` or our shadow-table.
+ */
+int Editor::hook_next(lua_State *L)
+{
+    lua_settop(L, 2);
+
+    /*
+     * Keys which aren't present in `_G` are from the shadow-table.
+     */
+    bool shadow = false;
+
+    if (!lua_isnil(L, 2))
+    {
+        lua_pushvalue(L, 2);
+        lua_rawget(L, 1);
+        shadow = lua_isnil(L, -1);
+        lua_pop(L, 1);
+    }
+
+    if (!shadow)
+    {
+        lua_pushvalue(L, 2);
+
+        if (lua_next(L, 1))
+            return 2;
+
+        lua_pushnil(L);
+    }
+    else
+    {
+        lua_pushvalue(L, 2);
+    }
+
+    if (lua_next(L, lua_upvalueindex(1)))
+        return 2;
+
+    return 0;
+}
+
+
+/**
+ * Replace `io.popen` and `os.execute` with closures which invoke the
+ * originals with our signals unblocked.
+ *
+ * `spawn` resets the signal-mask in its children itself, but these use
+ * the C library, which gives us no way to do so.
+ */
+void Editor::wrap_launchers()
+{
+    const char *libs[] = { "io", "os" };
+    const char *fns[]  = { "popen", "execute" };
+
+    for (int i = 0; i < 2; i++)
+    {
+        lua_getglobal(m_lua, libs[i]);
+
+        if (lua_istable(m_lua, -1))
+        {
+            lua_getfield(m_lua, -1, fns[i]);
+
+            if (lua_isfunction(m_lua, -1))
+            {
+                lua_pushcclosure(m_lua, launch_unblocked, 1);
+                lua_setfield(m_lua, -2, fns[i]);
+            }
+            else
+            {
+                lua_pop(m_lua, 1);
+            }
         }
 
-        narg++;
+        lua_pop(m_lua, 1);
+    }
+}
+
+
+/**
+ * Invoke a wrapped function, with our signals unblocked.
+ */
+int Editor::launch_unblocked(lua_State *L)
+{
+    Editor *e = Editor::instance();
+
+    int nargs = lua_gettop(L);
+    lua_pushvalue(L, lua_upvalueindex(1));
+    lua_insert(L, 1);
+
+    /*
+     * Errors are raised once the signals are blocked once more.
+     */
+    int erred = 0;
+    long start = Util::now_us();
+
+    e->m_events->unblocked([L, nargs, &erred]()
+    {
+        erred = lua_pcall(L, nargs, LUA_MULTRET, 0);
+    });
+
+    /*
+     * Waiting for a process isn't running Lua, so it doesn't count
+     * against the budget of the hook which launched it.
+     */
+    e->extend_budget(Util::now_us() - start);
+
+    if (erred)
+        return lua_error(L);
+
+    return lua_gettop(L);
+}
+
+
+/**
+ * Push the function of the given hook.
+ */
+bool Editor::push_hook(lua_hook hook)
+{
+    if (m_hooks[hook] == LUA_REFNIL || m_budgets[hook].disabled)
+        return false;
+
+    lua_rawgeti(m_lua, LUA_REGISTRYINDEX, m_hooks[hook]);
+    return true;
+}
+
+
+/**
+ * Invoke the hook, whose function and arguments have been pushed.
+ */
+bool Editor::pcall_hook(lua_hook hook, int nargs, int nresults)
+{
+    lua_running running;
+
+    /*
+     * A hook invoked by another hook runs within the budget of the
+     * outermost.
+     */
+    bool outermost = (m_budgeted == -1);
+
+    if (outermost)
+    {
+        m_budgeted            = hook;
+        m_budget_deadline     = Util::now_us() + m_budgets[hook].time * 1000L;
+        m_budget_instructions = 0;
+        m_budget_overran      = false;
+
+        if (m_budgets[hook].time > 0 || m_budgets[hook].instructions > 0)
+            lua_sethook(m_lua, watchdog, LUA_MASKCOUNT, WATCHDOG_STEP);
+    }
+
+    bool ok = (lua_pcall(m_lua, nargs, nresults, 0) == 0);
+
+    if (outermost)
+    {
+        m_budgeted = -1;
+
+        if (lua_gethook(m_lua) == watchdog)
+            lua_sethook(m_lua, NULL, 0, 0);
+    }
+
+    if (!ok)
+    {
+        set_status(1, "error running function `%s': %s", hook_names[hook], lua_tostring(m_lua, -1));
+        lua_pop(m_lua, 1);
+    }
+
+    if (outermost)
+        account_budget(hook, m_budget_overran);
+
+    return ok;
+}
+
+
+/**
+ * Abort the running hook if it has exceeded its budget.
+ */
+void Editor::watchdog(lua_State *L, lua_Debug *ar)
+{
+    (void)ar;
+
+    Editor *e = Editor::instance();
+
+    /*
+     * The hook finished while the profiler was sampling it, and the
+     * profiler has reinstated us.
+     */
+    if (e->m_budgeted == -1)
+    {
+        lua_sethook(L, NULL, 0, 0);
+        return;
     }
 
-endwhile:
-
+    hook_budget *budget = &e->m_budgets[e->m_budgeted];
+    e->m_budget_instructions += WATCHDOG_STEP;
 
-    /* do the call */
-    nres = strlen(sig);  /* number of expected results */
+    if (budget->instructions > 0 && e->m_budget_instructions > budget->instructions)
+    {
+        e->m_budget_overran = true;
+        luaL_error(L, "exceeded its budget of %d instructions", (int)budget->instructions);
+    }
 
-    if (lua_pcall(m_lua, narg, nres, 0) != 0)   /* do the call */
+    if (budget->time > 0 && Util::now_us() > e->m_budget_deadline)
     {
-        fprintf(stderr, "error running function `%s': %s", func, lua_tostring(m_lua, -1));
-        return;
+        e->m_budget_overran = true;
+        luaL_error(L, "exceeded its budget of %dms", budget->time);
     }
+}
 
-    /* retrieve results */
-    nres = -nres;  /* stack index of first result */
 
-    while (*sig)
+/**
+ * Record whether the hook overran its budget, disabling it if it has done
+ * so too often.
+ */
+void Editor::account_budget(lua_hook hook, bool overran)
+{
+    hook_budget *budget = &m_budgets[hook];
+
+    /*
+     * Callbacks registered via primitives share their budget, so one
+     * which overruns is aborted but the others aren't disabled.
+     */
+    if (!overran || hook >= HOOK_GLOBALS)
     {
-        /* get results */
-        switch (*sig++)
-        {
+        budget->overruns = 0;
+        return;
+    }
 
-        case 'd':  /* double result */
-            if (!lua_isnumber(m_lua, nres))
-            {
+    if (++budget->overruns < HOOK_STRIKES)
+        return;
 
-                fprintf(stderr, "wrong result type: expected number");
-                return;
-            }
+    budget->overruns = 0;
 
-            *va_arg(vl, double *) = lua_tonumber(m_lua, nres);
-            break;
+    /*
+     * `on_idle` does nothing but highlight, so rather than disabling it
+     * we disable the syntax-mode which is overrunning.
+     */
+    Buffer *buffer = current_buffer();
 
-        case 'i':  /* int result */
-            if (!lua_isnumber(m_lua, nres))
-            {
-                fprintf(stderr, "wrong result type: expected number");
-                return;
-            }
+    if (hook == HOOK_ON_IDLE && !buffer->m_syntax.empty())
+    {
+        set_status(1, "Disabled the %s syntax-mode, which overran the budget of `on_idle' %d times",
+                   buffer->m_syntax.c_str(), HOOK_STRIKES);
+        buffer->m_syntax = "";
+        return;
+    }
 
-            *va_arg(vl, int *) = (int)lua_tonumber(m_lua, nres);
-            break;
+    budget->disabled = true;
+    set_status(1, "Disabled `%s', which overran its budget %d times", hook_names[hook], HOOK_STRIKES);
+}
 
-        case 's':  /* string result */
-            if (!lua_isstring(m_lua, nres))
-            {
-                fprintf(stderr, "wrong result type: expected string");
-                return;
-            }
 
-            *va_arg(vl, const char **) = lua_tostring(m_lua, nres);
-            break;
+/**
+ * Extend the budget of the running hook.
+ */
+void Editor::extend_budget(long us)
+{
+    if (m_budgeted != -1)
+        m_budget_deadline += us;
+}
 
-        default:
-        {
-            fprintf(stderr, "invalid result-type");
-            return;
-        }
-        }
 
-        nres++;
+/**
+ * Get the budget of the named hook.
+ */
+hook_budget *Editor::budget(const char *hook)
+{
+    for (int i = 0; i < HOOK_MAX; i++)
+    {
+        if (strcmp(hook, hook_names[i]) == 0)
+            return (&m_budgets[i]);
     }
 
-    va_end(vl);
-
+    return NULL;
 }
 
 
@@ -930,8 +2323,16 @@ void Editor::warp(int x, int y)
     }
 
     /*
-     * Now move right.
+     * Now move right, directly if the position is within the row.
      */
+    int row = buffer->cy + buffer->rowoff;
+
+    if (x <= (int)buffer->rows.at(row)->chars->size())
+    {
+        show_point(buffer, x, row);
+        return;
+    }
+
     while (x > 0)
     {
         move("right");
@@ -950,80 +2351,70 @@ void Editor::move(const char *direction)
 
     int max_row = buffer->rows.size();
 
-    if (strcmp(direction, "up") == 0)
-    {
-        if (buffer->cy > 0)
-            buffer->cy -= 1;
-        else if (buffer->rowoff > 0)
-            buffer->rowoff -= 1;
-    }
-    else if (strcmp(direction, "down") == 0)
+    if ((strcmp(direction, "up") == 0) || (strcmp(direction, "down") == 0))
     {
-        if (buffer->cy + buffer->rowoff < max_row - 1)
+        int x    = buffer->cx + buffer->coloff;
+        int y    = buffer->cy + buffer->rowoff;
+        int tabs = buffer->tab_width();
+        int to   = (direction[0] == 'u') ? y - 1 : y + 1;
+
+        /*
+         * Keep the point at the same display column, rather than at the
+         * same character, as the rows might contain TABs or wide
+         * characters.
+         */
+        if (to >= 0 && to < max_row)
         {
-            buffer->cy += 1;
+            erow *row = buffer->rows.at(y);
+            int column = row->column(std::min(x, (int)row->chars->size()), tabs);
 
-            if (buffer->cy >= e->height())
-            {
-                buffer->cy = e->height();
-                buffer->rowoff++;
-            }
+            show_point(buffer, buffer->rows.at(to)->index(column, tabs), to);
         }
     }
     else if (strcmp(direction, "left") == 0)
     {
-        if (buffer->cx == 0)
+        int x    = buffer->cx + buffer->coloff;
+        int y    = buffer->cy + buffer->rowoff;
+        int tabs = buffer->tab_width();
+
+        erow *row = buffer->rows.at(y);
+
+        /*
+         * Characters drawn as part of their predecessor are skipped.
+         */
+        if (x > 0)
         {
-            if (buffer->coloff > 0)
-            {
-                buffer->coloff --;
-            }
-            else
-            {
-                int filerow = buffer->cy + buffer->rowoff;
+            x -= 1;
 
-                if (filerow > 0)
-                {
-                    buffer->cy--;
-
-                    erow *row = buffer->rows.at(buffer->cy + buffer->rowoff);
-
-                    if ((int)row->chars->size() < e->width())
-                    {
-                        buffer->coloff = 0;
-                        buffer->cx = row->chars->size() ;
-                    }
-                    else
-                    {
-                        buffer->cx = e->width() - 1;
-                        buffer->coloff = row->chars->size() - e->width() + 1;
-                    }
-                }
-            }
+            while (x > 0 && row->width(x, tabs) == 0)
+                x -= 1;
+
+            show_point(buffer, x, y);
         }
-        else
+        else if (y > 0)
         {
-            buffer->cx -= 1;
+            buffer->coloff = 0;
+            show_point(buffer, buffer->rows.at(y - 1)->chars->size(), y - 1);
         }
-
     }
     else  if (strcmp(direction, "right") == 0)
     {
 
-        int x = buffer->cx + buffer->coloff;
-        int y = buffer->cy + buffer->rowoff;
+        int x    = buffer->cx + buffer->coloff;
+        int y    = buffer->cy + buffer->rowoff;
+        int tabs = buffer->tab_width();
 
         erow *row = buffer->rows.at(y);
+        int len   = row->chars->size();
 
-        if (x < (int)row->chars->size())
+        if (x < len)
         {
-            buffer->cx += 1;
+            x += 1;
 
-            if (buffer->cx >= e->width())
-            {
-                buffer->cx -= 1;
-                buffer->coloff += 1;
-            }
+            while (x < len && row->width(x, tabs) == 0)
+                x += 1;
+
+            show_point(buffer, x, y);
         }
         else
         {
@@ -1032,15 +2423,8 @@ void Editor::move(const char *direction)
              */
             if (y + 1 < max_row)
             {
-                buffer->cx = 0;
                 buffer->coloff = 0;
-                buffer->cy += 1;
-
-                if (buffer->cy >= e->width())
-                {
-                    buffer->cy -= 1;
-                    buffer->rowoff += 1;
-                }
+                show_point(buffer, 0, y + 1);
             }
         }
     }
@@ -1059,6 +2443,14 @@ void Editor::move(const char *direction)
     {
         eol_lua(NULL);
     }
+    else
+    {
+        /*
+         * The characters above, or below, might be wider than those we
+         * left, so make sure the point is still visible.
+         */
+        show_point(buffer, buffer->cx + buffer->coloff, buffer->cy + buffer->rowoff);
+    }
 }
 
 
@@ -1083,10 +2475,20 @@ void Editor::new_buffer(const char *name)
         tmp = new Buffer(t.c_str());
     }
 
-    m_state->buffers.push_back(tmp);
+    add_buffer(tmp);
     m_state->current_buffer = count_buffers() - 1;
 }
 
+
+/*
+ * Add a newly created buffer to our list.
+ */
+void Editor::add_buffer(Buffer *buffer)
+{
+    m_state->buffers.push_back(buffer);
+    m_state->buffer_ids[buffer->id()] = buffer;
+}
+
 /*
  * Jump to the given buffer.
  */
@@ -1143,6 +2545,22 @@ int Editor::buffer_by_name(const char *name)
 }
 
 
+/**
+ * Lookup the buffer with the given unique ID.
+ *
+ * Returns NULL if the buffer has been killed.
+ */
+Buffer *Editor::buffer_by_id(int id)
+{
+    auto it = m_state->buffer_ids.find(id);
+
+    if (it == m_state->buffer_ids.end())
+        return NULL;
+
+    return (it->second);
+}
+
+
 /**
  * Remove the current buffer.
  *
@@ -1154,9 +2572,15 @@ void Editor::kill_current_buffer()
      * Kill the current buffer.
      */
     auto it = m_state->buffers.begin() + m_state->current_buffer;
+    int id  = (*it)->id();
+
+    m_state->buffer_ids.erase(id);
     delete *it;
     m_state->buffers.erase(it);
 
+    for (auto fn = m_kill_listeners.begin(); fn != m_kill_listeners.end(); ++fn)
+        (*fn)(id);
+
     if (count_buffers() < 1)
     {
         endwin();
@@ -1167,6 +2591,34 @@ void Editor::kill_current_buffer()
 }
 
 
+/**
+ * Invoke the given function, with the unique ID of each buffer, as it
+ * is killed.
+ */
+void Editor::on_kill(std::function<void(int)> fn)
+{
+    m_kill_listeners.push_back(fn);
+}
+
+
+/**
+ * Run without a terminal, so the screen is never drawn.
+ */
+void Editor::set_headless(bool headless)
+{
+    m_headless = headless;
+}
+
+
+/**
+ * Are we running without a terminal?
+ */
+bool Editor::headless()
+{
+    return m_headless;
+}
+
+
 /**
  * Return all the buffers.
  */
@@ -1175,6 +2627,84 @@ std::vector<Buffer *> Editor::get_buffers()
     return (m_state->buffers);
 }
 
+/**
+ * Render the status-bar from our template.
+ */
+std::string Editor::render_status()
+{
+    Buffer *buffer = current_buffer();
+
+    status_values v;
+    v.buffer  = m_state->current_buffer + 1;
+    v.buffers = m_state->buffers.size();
+    v.file    = buffer->get_name();
+    v.syntax  = buffer->m_syntax;
+    v.dirty   = buffer->dirty();
+    v.x       = buffer->cx + buffer->coloff;
+    v.y       = buffer->cy + buffer->rowoff + 1;
+    v.width   = width();
+
+    /*
+     * Report the display column of the point, as other tools do.
+     */
+    if (buffer->cy + buffer->rowoff < (int)buffer->rows.size())
+    {
+        erow *row = buffer->rows.at(buffer->cy + buffer->rowoff);
+        v.x = row->column(std::min(v.x, (int)row->chars->size()), buffer->tab_width());
+    }
+
+    /*
+     * The character under the point.
+     */
+    erow *row = buffer->rows.at(v.y - 1);
+
+    if (v.x < (int)row->chars->size())
+    {
+        Util::wide_to_utf8(row->chars->at(v.x), v.point);
+    }
+
+    /*
+     * The date and time are only formatted if they're used.
+     */
+    if (m_status_line->uses_date() || m_status_line->uses_time())
+    {
+        char buf[128];
+        time_t now = time(NULL);
+        struct tm *tm = localtime(&now);
+
+        if (m_status_line->uses_date() && strftime(buf, sizeof(buf), "%A %d %B %Y", tm))
+            v.date = buf;
+
+        if (m_status_line->uses_time() && strftime(buf, sizeof(buf), "%X", tm))
+            v.time = buf;
+    }
+
+    /*
+     * Lua functions are called by name, as their results are cached.
+     */
+    return (m_status_line->render(v, [this](const std::string & name)
+    {
+        std::string result;
+        lua_running running;
+
+        lua_getglobal(m_lua, name.c_str());
+
+        if (lua_pcall(m_lua, 0, 1, 0) == 0)
+        {
+            if (lua_isstring(m_lua, -1))
+                result = lua_tostring(m_lua, -1);
+        }
+        else
+        {
+            set_status(1, "error running function `%s': %s", name.c_str(), lua_tostring(m_lua, -1));
+        }
+
+        lua_pop(m_lua, 1);
+        return result;
+    }));
+}
+
+
 /**
  * Return the height of the edit-area - which is the height of the terminal
  * minus two rows for the footer.
@@ -1193,42 +2723,188 @@ int Editor::width()
 }
 
 
-/**
- * Execute the contents of the given file, as lua.
+/*
+ * Append bytecode to a string, as it is dumped.
+ */
+static int string_writer(lua_State *L, const void *p, size_t size, void *ud)
+{
+    (void)L;
+    ((std::string *)ud)->append((const char *)p, size);
+    return 0;
+}
+
+
+/*
+ * Load the given file, via a cache of its bytecode beneath ~/.kilua/cache.
+ *
+ * Each cache-file begins with a header recording the version of Lua, and
+ * the modification-time and size of the file, so that it is ignored once
+ * the file has changed.  If the bytecode can't be loaded - for example
+ * because it was written by LuaJIT - we just replace it.
  */
-int Editor::load_lua(const char *filename)
+static int load_cached(lua_State *L, const char *filename, const struct stat &sb, bool *cached)
 {
-    if (access(filename, 0) == 0)
+    const char *home = getenv("HOME");
+
+    if (home == NULL)
+        return (luaL_loadfile(L, filename));
+
+    std::string dir  = std::string(home) + "/.kilua/cache";
+    std::string path = filename;
+    std::replace(path.begin(), path.end(), '/', '%');
+    path = dir + "/" + path + "c";
+
+    char header[128];
+    snprintf(header, sizeof(header), "kilua-bytecode %d %ld %ld\n",
+             LUA_VERSION_NUM, (long)sb.st_mtime, (long)sb.st_size);
+    size_t header_len = strlen(header);
+
+    /*
+     * Use the cache, if it is current.
+     */
+    FILE *in = fopen(path.c_str(), "rb");
+
+    if (in != NULL)
     {
-        int erred = luaL_dofile(m_lua, filename);
+        std::string data;
+        char buf[16384];
+        size_t n;
 
-        if (erred)
-        {
-            endwin();
+        while ((n = fread(buf, 1, sizeof(buf), in)) > 0)
+            data.append(buf, n);
 
-            if (lua_isstring(m_lua, -1))
-                fprintf(stderr, "%s\n", lua_tostring(m_lua, -1));
+        fclose(in);
+
+        if (data.compare(0, header_len, header) == 0)
+        {
+            if (luaL_loadbuffer(L, data.data() + header_len, data.size() - header_len, filename) == 0)
+            {
+                *cached = true;
+                return 0;
+            }
 
-            fprintf(stderr, "Failed to load %s - aborting\n", filename);
-            exit(1);
+            lua_pop(L, 1);
         }
+    }
+
+    /*
+     * Otherwise load the source, and update the cache - ignoring any
+     * failure to do so.
+     */
+    int erred = luaL_loadfile(L, filename);
+
+    if (erred)
+        return (erred);
+
+    std::string data = header;
+    lua_dump(L, string_writer, &data);
+
+    mkdir((std::string(home) + "/.kilua").c_str(), 0755);
+    mkdir(dir.c_str(), 0700);
+
+    std::string tmp = path + ".tmp";
+    FILE *out = fopen(tmp.c_str(), "wb");
+
+    if (out != NULL)
+    {
+        bool ok = (fwrite(data.data(), 1, data.size(), out) == data.size());
 
-        return 1;
+        if (fclose(out) == 0 && ok)
+            rename(tmp.c_str(), path.c_str());
+        else
+            unlink(tmp.c_str());
     }
-    else
+
+    return 0;
+}
+
+
+/**
+ * Execute the contents of the given file, as lua.
+ */
+int Editor::load_lua(const char *filename, bool cache, bool fatal)
+{
+    struct stat sb;
+
+    if (stat(filename, &sb) != 0)
     {
         set_status(1, "Not loading Lua file %s, it is not present", filename);
+        return 0;
+    }
+
+    long start  = Util::now_us();
+    bool cached = false;
+    lua_running running;
+
+    int erred = cache ? load_cached(m_lua, filename, sb, &cached) : luaL_loadfile(m_lua, filename);
 
+    if (!erred)
+        erred = lua_pcall(m_lua, 0, 0, 0);
+
+    if (erred && !fatal)
+    {
+        if (lua_isstring(m_lua, -1))
+            set_status(1, "Failed to load %s: %s", filename, lua_tostring(m_lua, -1));
+        else
+            set_status(1, "Failed to load %s", filename);
+
+        lua_pop(m_lua, 1);
+        return -1;
     }
 
-    return 0;
+    if (erred)
+    {
+        endwin();
+
+        if (lua_isstring(m_lua, -1))
+            fprintf(stderr, "%s\n", lua_tostring(m_lua, -1));
+
+        fprintf(stderr, "Failed to load %s - aborting\n", filename);
+        exit(1);
+    }
+
+    log_message("Loaded %s in %.2fms%s", filename, (Util::now_us() - start) / 1000.0,
+                cached ? ", from cached bytecode" : "");
+    return 1;
 }
 
+
+/**
+ * Execute the default configuration, which is built into the editor as
+ * bytecode.
+ */
+int Editor::load_default_config()
+{
+    const char *data;
+    size_t len;
+
+    if (!embedded_lua("kilua", &data, &len))
+        return 0;
+
+    long start = Util::now_us();
+    lua_running running;
+
+    if (luaL_loadbuffer(m_lua, data, len, "kilua.lua") != 0 ||
+            lua_pcall(m_lua, 0, 0, 0) != 0)
+    {
+        if (lua_isstring(m_lua, -1))
+            set_status(1, "%s", lua_tostring(m_lua, -1));
+
+        lua_pop(m_lua, 1);
+        return 0;
+    }
+
+    log_message("Loaded the default configuration in %.2fms", (Util::now_us() - start) / 1000.0);
+    return 1;
+}
+
+
 /**
  * Eval a given string.
  */
 int Editor::eval_lua(const char *text)
 {
+    lua_running running;
 
     int erred = luaL_dostring(m_lua, text);
 
@@ -1265,32 +2941,21 @@ char *Editor::hostname()
         return (strdup(env));
 
     /*
-     * Get the short version.
+     * We use the short version, as looking up the fully-qualified name
+     * would involve the DNS - which might be slow, or broken.
      */
     char res[1024];
     res[sizeof(res) - 1] = '\0';
-    gethostname(res, sizeof(res) - 1);
-
-    /*
-     * Attempt to get the full vrsion.
-     */
-    struct hostent *hstnm;
-    hstnm = gethostbyname(res);
 
-    if (hstnm)
-    {
-        /*
-         * Success.
-         */
-        return (strdup(hstnm->h_name));
-    }
-    else
-    {
-        /*
-         * Failure: Return the short-version.
-         */
+    if (gethostname(res, sizeof(res) - 1) == 0 && res[0] != '\0')
         return (strdup(res));
-    }
+
+    struct utsname uts;
+
+    if (uname(&uts) == 0)
+        return (strdup(uts.nodename));
+
+    return (strdup("localhost"));
 }
 
 
@@ -1351,7 +3016,7 @@ int Editor::menu(std::vector<std::string> choices)
          */
         unsigned int ch;
 
-        int res = get_wch(&ch);
+        int res = read_key(&ch);
 
         if (res == ERR)
             continue;
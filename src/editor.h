@@ -32,14 +32,20 @@
 
 #pragma once
 
+#include <deque>
 #include <string.h>
 #include <ncurses.h>
 #include <sys/ioctl.h>
 
 
 #include "buffer.h"
+#include "event_loop.h"
+#include "keymap.h"
 #include "lua_primitives.h"
+#include "pool.h"
 #include "singleton.h"
+#include "stats.h"
+#include "status_line.h"
 
 
 
@@ -55,9 +61,7 @@ public:
      */
     int screenrows()
     {
-        struct winsize w;
-        ioctl(0, TIOCGWINSZ, &w);
-        return (w.ws_row - 2);
+        return (term_rows - 2);
     };
 
     /*
@@ -65,12 +69,47 @@ public:
      */
     int screencols()
     {
-        struct winsize w;
-        ioctl(0, TIOCGWINSZ, &w);
-        return (w.ws_col);
+        return (term_cols);
+    }
 
+    /*
+     * Read the size of the terminal, returning true if it has changed.
+     *
+     * The size is cached, rather than being looked up every time it is
+     * used, so this must be called when the terminal is resized.
+     */
+    bool update_size()
+    {
+        struct winsize w;
+        int rows = 24;
+        int cols = 80;
+
+        if (ioctl(0, TIOCGWINSZ, &w) == 0 && w.ws_row > 0 && w.ws_col > 0)
+        {
+            rows = w.ws_row;
+            cols = w.ws_col;
+        }
+
+        /*
+         * We need at least one row for text, and two for the footer.
+         */
+        if (rows < 3)
+            rows = 3;
+
+        if (rows == term_rows && cols == term_cols)
+            return false;
+
+        term_rows = rows;
+        term_cols = cols;
+        return true;
     }
 
+    /*
+     * The cached size of the terminal.
+     */
+    int term_rows;
+    int term_cols;
+
     /*
      * The status-message
      */
@@ -81,11 +120,93 @@ public:
      */
     std::vector<Buffer *> buffers;
 
+    /*
+     * The buffers we have, indexed by their unique ID.
+     */
+    std::unordered_map<int, Buffer *> buffer_ids;
+
     /*
      * The currently selected buffer.
      */
     int current_buffer ;
 
+    /*
+     * The keys of the most recently recorded keyboard macro.
+     */
+    std::vector<unsigned int> macro;
+
+    /*
+     * Are we recording keystrokes into the macro?
+     */
+    bool recording;
+
+    /*
+     * Keys which are pending replay, and a flag to show that a
+     * replay is in progress - which suppresses screen updates.
+     */
+    std::deque<unsigned int> replay;
+    bool replaying;
+
+};
+
+
+/**
+ * The Lua functions which we invoke, and whose references we cache.
+ *
+ * Those after HOOK_GLOBALS aren't globals, but the kinds of callbacks
+ * which are registered via primitives - each kind shares a budget.
+ *
+ * These must be kept in the same order as the names in editor.cc.
+ */
+enum lua_hook
+{
+    HOOK_GET_STATUS_BAR,
+    HOOK_ON_COMPLETE,
+    HOOK_ON_IDLE,
+    HOOK_ON_KEY,
+    HOOK_ON_LOADED,
+    HOOK_ON_SAVE,
+    HOOK_ON_SAVED,
+    HOOK_OPEN,
+    HOOK_GLOBALS,
+    HOOK_BINDING = HOOK_GLOBALS,
+    HOOK_ON_EXIT,
+    HOOK_TIMER,
+    HOOK_WATCH_FD,
+    HOOK_MAX
+};
+
+
+/**
+ * The limits upon a single invocation of a Lua hook, which is aborted if
+ * it exceeds either.
+ *
+ * A hook which overruns its budget repeatedly is disabled, until it is
+ * redefined.
+ */
+struct hook_budget
+{
+    /**
+     * The time, in milliseconds, the hook may run for, or zero for no
+     * limit.  Time spent waiting for a key is not counted.
+     */
+    int time;
+
+    /**
+     * The number of Lua instructions the hook may execute, or zero for
+     * no limit.
+     */
+    long instructions;
+
+    /**
+     * The number of consecutive invocations which overran the budget.
+     */
+    int overruns;
+
+    /**
+     * Has the hook been disabled?
+     */
+    bool disabled;
 };
 
 
@@ -127,12 +248,110 @@ public:
      */
     void main_loop();
 
+    /**
+     * Read a single key.
+     *
+     * If a macro is being replayed the key comes from it, otherwise
+     * from the terminal - in which case it might be recorded.
+     *
+     * While waiting for the terminal any timers, signals, and watched
+     * file-descriptors are handled.
+     */
+    int read_key(unsigned int *ch);
+
+    /**
+     * Get the event-loop, to register timers and file-descriptors.
+     */
+    EventLoop *events();
+
+    /**
+     * Get the Lua state.
+     */
+    lua_State *lua();
+
+    /**
+     * Get the key-bindings.
+     */
+    Keymap *keymap();
+
+    /**
+     * Get the status-bar template.
+     */
+    StatusLine *status_line();
+
+    /**
+     * Get the timings of the phases of our main-loop.
+     */
+    Stats *stats();
+
+    /**
+     * Get the allocator of our Lua state.
+     */
+    Pool *pool();
+
+    /**
+     * Process a single key, by invoking the function bound to it, or
+     * inserting it.
+     *
+     * Returns false if the key could not be processed.
+     */
+    bool process_key(unsigned int ch);
+
+    /**
+     * Process the given keys, as if they'd been typed in a burst, without
+     * redrawing the screen.
+     *
+     * Keys which are read by primitives, such as `prompt()`, are taken
+     * from those given too.  This is used to replay key-scripts.
+     */
+    void process_keys(const std::vector<unsigned int> &keys);
+
+    /**
+     * Push the given keys back, so that they will be read again.
+     */
+    void unread_keys(std::vector<unsigned int> keys);
+
+    /**
+     * Start recording a keyboard macro.
+     */
+    void macro_record();
+
+    /**
+     * Stop recording a keyboard macro, discarding the last `drop`
+     * keys which were recorded - i.e. the binding which stopped us.
+     */
+    void macro_stop(int drop);
+
+    /**
+     * Replay the recorded keyboard macro `count` times.
+     *
+     * If `count` is zero, or less, replay until an error occurs or
+     * the macro stops moving the point.
+     *
+     * Returns the number of complete replays.
+     */
+    int macro_replay(int count);
+
     /**
      * Insert the given character into the current position in the
      * buffer.
      */
     void insert(wchar_t c);
 
+    /**
+     * Insert the given string at the point of the given buffer, or of
+     * the current buffer if none is specified.
+     */
+    void insert(const std::wstring &text, Buffer *buffer = NULL);
+
+    /**
+     * Append the given string to the end of the given buffer.
+     *
+     * The point of that buffer follows the text if it was at the end,
+     * otherwise it is left alone.
+     */
+    void append(Buffer *buffer, const std::wstring &text);
+
     /**
      * Delete one character, backwards, from the current position.
      */
@@ -152,6 +371,13 @@ public:
      */
     int buffer_by_name(const char *name);
 
+    /**
+     * Lookup the buffer with the given unique ID.
+     *
+     * Returns NULL if the buffer has been killed.
+     */
+    Buffer *buffer_by_id(int id);
+
     /**
      * Get the status-text.
      */
@@ -162,6 +388,12 @@ public:
      */
     void set_status(int log, const char *fmt, ...);
 
+    /**
+     * Append a message to the *Messages* buffer, without changing the
+     * status-text.
+     */
+    void log_message(const char *fmt, ...);
+
 
     /**
      * Update the syntax of the buffer.
@@ -184,14 +416,68 @@ public:
     int width();
 
     /**
-     * Call lua
+     * Invoke the given Lua hook, with the arguments specified - which
+     * may be integers, numbers, or strings.
+     *
+     * Returns false if the function is not defined, or failed.
+     */
+    template <typename... Args> bool call_lua(lua_hook hook, const Args &... args)
+    {
+        if (!push_hook(hook))
+            return false;
+
+        push_args(args...);
+        return pcall_hook(hook, sizeof...(Args), 0);
+    }
+
+    /**
+     * Invoke the given Lua hook, with the arguments specified, and
+     * store its result - which may be an integer, number, or string.
+     *
+     * Returns false if the function is not defined, failed, or returned
+     * a result of the wrong type.
+     */
+    template <typename R, typename... Args> bool call_lua_result(lua_hook hook, R &result, const Args &... args)
+    {
+        if (!push_hook(hook))
+            return false;
+
+        push_args(args...);
+
+        if (!pcall_hook(hook, sizeof...(Args), 1))
+            return false;
+
+        bool ok = get_result(result);
+        lua_pop(m_lua, 1);
+        return ok;
+    }
+
+    /**
+     * Get the budget of the named hook, or NULL if there is no such hook.
+     */
+    hook_budget *budget(const char *hook);
+
+    /**
+     * Invoke the hook, whose function and arguments have been pushed,
+     * within its budget - reporting any error.
      */
-    void call_lua(const char *func, const char *sig, ...);
+    bool pcall_hook(lua_hook hook, int nargs, int nresults);
 
     /**
      * Load a Lua file, if it exists, and execute it.
+     *
+     * If `cache` is true the compiled bytecode is cached beneath
+     * ~/.kilua/cache, and reused until the file is modified.
+     *
+     * An error in the file is fatal, unless `fatal` is false - in which
+     * case it is shown in the status-area and -1 is returned.
+     */
+    int load_lua(const char *filename, bool cache = false, bool fatal = true);
+
+    /**
+     * Execute the default configuration, which is built into the editor.
      */
-    int load_lua(const char *filename);
+    int load_default_config();
 
     /**
      * Eval a given string.
@@ -213,6 +499,12 @@ public:
      */
     void move(const char *direction);
 
+    /**
+     * Move the point of the given buffer to the absolute position
+     * specified, scrolling only as much as required.
+     */
+    void show_point(Buffer *buffer, int x, int y);
+
     /**
      * Buffer handling.
      */
@@ -224,7 +516,24 @@ public:
     std::vector<Buffer *> get_buffers();
 
     /**
-     * Get the hostname we're running on.
+     * Invoke the given function, with the unique ID of each buffer, as
+     * it is killed.
+     */
+    void on_kill(std::function<void(int)> fn);
+
+    /**
+     * Run without a terminal, as `--batch` does.
+     *
+     * The screen is never drawn, and primitives which read from the
+     * keyboard raise an error.
+     */
+    void set_headless(bool headless);
+    bool headless();
+
+    /**
+     * Get the (short) hostname we're running on, without using DNS.
+     *
+     * NOTE: The caller must `free` the result.
      */
     char *hostname();
 
@@ -247,6 +556,100 @@ private:
      */
     const char *lookup_key(unsigned int c);
 
+    /**
+     * Insert the given character at the point, and each additional
+     * cursor, of the current buffer.
+     */
+    void insert_all(wchar_t c);
+
+    /**
+     * Delete one character, backwards, from the point and each
+     * additional cursor of the current buffer.
+     */
+    void delete_all();
+
+    /**
+     * Draw a single character, of the given width, at the given position.
+     */
+    void draw_cell(int y, int x, const std::wstring &cell, int width);
+
+    /**
+     * Add a newly created buffer to our list.
+     */
+    void add_buffer(Buffer *buffer);
+
+    /**
+     * Having read an ESC, read the text of a bracketed-paste, if that
+     * is what follows.
+     *
+     * Returns false if this was not a paste.
+     */
+    bool read_paste(std::wstring &text);
+
+    /**
+     * The time, in milliseconds, at which we last drew the screen.
+     */
+    long m_last_frame;
+
+    /**
+     * Schedule the `on_idle` hook to run once input has stopped.
+     */
+    void schedule_idle();
+
+    /**
+     * Handle the terminal being resized.
+     */
+    void resize();
+
+    /**
+     * The event-loop we wait upon, and the ID of the timer which
+     * will invoke `on_idle`.
+     */
+    EventLoop *m_events;
+    int m_idle;
+
+    /**
+     * Our key-bindings.
+     */
+    Keymap *m_keymap;
+
+    /**
+     * Our status-bar template, and a helper to render it.
+     */
+    StatusLine *m_status_line;
+    std::string render_status();
+
+    /**
+     * Timings of the phases of our main-loop.
+     */
+    Stats *m_stats;
+
+    /**
+     * The allocator of our Lua state, NULL if Lua uses its own.
+     */
+    Pool *m_pool;
+
+    /**
+     * Run the garbage-collector for a while, as we're idle, so that it
+     * has less to do while keys are being processed.
+     */
+    void collect_garbage();
+
+    /**
+     * The memory used by Lua, in KB, after the last collection finished.
+     */
+    int m_gc_floor;
+
+    /**
+     * The functions to invoke when a buffer is killed.
+     */
+    std::vector<std::function<void(int)> > m_kill_listeners;
+
+    /**
+     * Are we running without a terminal?
+     */
+    bool m_headless;
+
     /**
      * Our state.
      */
@@ -256,4 +659,135 @@ private:
      * Our lua object.
      */
     lua_State * m_lua;
+
+    /**
+     * Registry references to the functions of each hook, LUA_REFNIL if
+     * the hook isn't defined.
+     */
+    int m_hooks[HOOK_MAX];
+
+    /**
+     * Watch the assignment of global variables, so that our cached
+     * references to the hooks are updated when they're redefined.
+     */
+    void watch_hooks();
+
+    /**
+     * The `__newindex` and `__pairs` metamethods used by `watch_hooks`.
+     */
+    static int hook_newindex(lua_State *L);
+    static int hook_pairs(lua_State *L);
+    static int hook_next(lua_State *L);
+
+    /**
+     * Wrap `io.popen` and `os.execute` so that the processes they launch
+     * don't inherit the signals our event-loop blocks.
+     */
+    void wrap_launchers();
+
+    /**
+     * Invoke the function which is our first upvalue, via `wrap_launchers`.
+     */
+    static int launch_unblocked(lua_State *L);
+
+    /**
+     * Push the function of the given hook, returning false if it isn't
+     * defined.
+     */
+    bool push_hook(lua_hook hook);
+
+    /**
+     * The budgets of each hook.
+     */
+    hook_budget m_budgets[HOOK_MAX];
+
+    /**
+     * The hook whose budget is being enforced, or -1, along with the
+     * time at which it must finish, the number of instructions it has
+     * executed, and whether it has overrun.
+     */
+    int  m_budgeted;
+    long m_budget_deadline;
+    long m_budget_instructions;
+    bool m_budget_overran;
+
+    /**
+     * The `lua_sethook` function which enforces the budget.
+     */
+    static void watchdog(lua_State *L, lua_Debug *ar);
+
+    /**
+     * Record whether the hook overran its budget, disabling it if it
+     * has done so too often.
+     */
+    void account_budget(lua_hook hook, bool overran);
+
+    /**
+     * Extend the budget of the running hook, if any, by the given number
+     * of microseconds - for time in which Lua wasn't running.
+     */
+    void extend_budget(long us);
+
+    /**
+     * Push the arguments of a hook.
+     */
+    void push_args() { }
+
+    template <typename T, typename... Rest> void push_args(const T &first, const Rest &... rest)
+    {
+        push_arg(first);
+        push_args(rest...);
+    }
+
+    void push_arg(int value)
+    {
+        lua_pushinteger(m_lua, value);
+    }
+
+    void push_arg(double value)
+    {
+        lua_pushnumber(m_lua, value);
+    }
+
+    void push_arg(const char *value)
+    {
+        lua_pushstring(m_lua, value);
+    }
+
+    void push_arg(const std::string &value)
+    {
+        lua_pushlstring(m_lua, value.c_str(), value.size());
+    }
+
+    /**
+     * Retrieve the result of a hook, from the top of the stack.
+     */
+    bool get_result(int &result)
+    {
+        if (!lua_isnumber(m_lua, -1))
+            return false;
+
+        result = lua_tointeger(m_lua, -1);
+        return true;
+    }
+
+    bool get_result(double &result)
+    {
+        if (!lua_isnumber(m_lua, -1))
+            return false;
+
+        result = lua_tonumber(m_lua, -1);
+        return true;
+    }
+
+    bool get_result(std::string &result)
+    {
+        if (!lua_isstring(m_lua, -1))
+            return false;
+
+        size_t len;
+        const char *str = lua_tolstring(m_lua, -1, &len);
+        result.assign(str, len);
+        return true;
+    }
 };
@@ -0,0 +1,100 @@
+/* embedded.cc - The Lua files which are built into the editor.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+#include <string>
+
+#include "bytecode.h"
+#include "embedded.h"
+
+
+
+/**
+ * Find the bytecode of a Lua file which is built into the editor.
+ */
+bool embedded_lua(const char *name, const char **data, size_t *len)
+{
+    for (int i = 0; embedded_files[i].name != NULL; i++)
+    {
+        if (strcmp(embedded_files[i].name, name) == 0)
+        {
+            *data = (const char *)embedded_files[i].data;
+            *len  = *embedded_files[i].len;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/**
+ * Find a module which is built into the editor.
+ *
+ * Syntax-modules are built in, so "cc" is found as "syntax/cc".
+ */
+static int embedded_searcher(lua_State *L)
+{
+    const char *name = luaL_checkstring(L, 1);
+    std::string path = std::string("syntax/") + name;
+
+    const char *data;
+    size_t len;
+
+    if (!embedded_lua(path.c_str(), &data, &len))
+    {
+        lua_pushfstring(L, "\n\tno embedded module '%s'", name);
+        return 1;
+    }
+
+    if (luaL_loadbuffer(L, data, len, name) != 0)
+        return (luaL_error(L, "error loading embedded module '%s': %s", name, lua_tostring(L, -1)));
+
+    return 1;
+}
+
+
+/**
+ * Add our searcher to the end of `package.searchers`.
+ */
+void embedded_searcher_install(lua_State *L)
+{
+    lua_getglobal(L, "package");
+
+#if LUA_VERSION_NUM < 502
+    lua_getfield(L, -1, "loaders");
+#else
+    lua_getfield(L, -1, "searchers");
+#endif
+
+    lua_pushcfunction(L, embedded_searcher);
+    lua_rawseti(L, -2, lua_rawlen(L, -2) + 1);
+    lua_pop(L, 2);
+}
@@ -0,0 +1,398 @@
+/* event_loop.cc - Waiting for input, timers, signals, and file-descriptors.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+
+#include "event_loop.h"
+#include "util.h"
+
+
+/*
+ * The signals which were received while they were unblocked.
+ */
+static volatile sig_atomic_t unblocked_signals[NSIG];
+
+
+/*
+ * The shortest interval, in milliseconds, at which a timer may repeat,
+ * so that one which always asks to run again can't spin the CPU.
+ */
+#define MIN_TIMER_INTERVAL 10
+
+
+/**
+ * Record the receipt of a signal, while it is unblocked.
+ */
+static void note_signal(int signo)
+{
+    unblocked_signals[signo] = 1;
+}
+
+
+/**
+ * Constructor.
+ */
+EventLoop::EventLoop()
+{
+    m_epoll  = epoll_create1(EPOLL_CLOEXEC);
+    m_timer  = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    m_signal = -1;
+
+    m_next_timer = 1;
+    sigemptyset(&m_signals);
+
+    /*
+     * We always watch the console, and our timer.
+     */
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+
+    ev.data.fd = STDIN_FILENO;
+    epoll_ctl(m_epoll, EPOLL_CTL_ADD, STDIN_FILENO, &ev);
+
+    ev.data.fd = m_timer;
+    epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_timer, &ev);
+}
+
+
+/**
+ * Destructor.
+ */
+EventLoop::~EventLoop()
+{
+    close(m_epoll);
+    close(m_timer);
+
+    if (m_signal != -1)
+        close(m_signal);
+}
+
+
+/**
+ * Invoke the given function, after `ms` milliseconds.
+ */
+int EventLoop::add_timer(long ms, std::function<bool()> fn)
+{
+    if (ms < 0)
+        ms = 0;
+
+    int id = m_next_timer++;
+
+    timer t;
+    t.due      = Util::now_ms() + ms;
+    t.interval = ms < MIN_TIMER_INTERVAL ? MIN_TIMER_INTERVAL : ms;
+    t.fn       = fn;
+    m_timers[id] = t;
+
+    arm_timer();
+    return id;
+}
+
+
+/**
+ * Cancel the timer with the given ID, if it is pending.
+ */
+void EventLoop::cancel_timer(int id)
+{
+    m_timers.erase(id);
+    arm_timer();
+}
+
+
+/**
+ * Invoke the given function when the file-descriptor is readable.
+ */
+bool EventLoop::watch_fd(int fd, std::function<void(int)> fn)
+{
+    if (fd == STDIN_FILENO || m_fds.find(fd) != m_fds.end())
+        return false;
+
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events  = EPOLLIN;
+    ev.data.fd = fd;
+
+    if (epoll_ctl(m_epoll, EPOLL_CTL_ADD, fd, &ev) != 0)
+        return false;
+
+    m_fds[fd] = fn;
+    return true;
+}
+
+
+/**
+ * Stop watching the given file-descriptor.
+ */
+void EventLoop::unwatch_fd(int fd)
+{
+    if (m_fds.erase(fd))
+        epoll_ctl(m_epoll, EPOLL_CTL_DEL, fd, NULL);
+}
+
+
+/**
+ * Invoke the given function when the signal is received.
+ */
+void EventLoop::watch_signal(int signo, std::function<void()> fn)
+{
+    m_signal_handlers[signo] = fn;
+
+    /*
+     * Block the signal, so that it is only delivered via our
+     * descriptor, and update that descriptor to receive it.
+     */
+    sigaddset(&m_signals, signo);
+    sigprocmask(SIG_BLOCK, &m_signals, NULL);
+
+    bool created = (m_signal == -1);
+    m_signal = signalfd(m_signal, &m_signals, SFD_NONBLOCK | SFD_CLOEXEC);
+
+    if (created && m_signal != -1)
+    {
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events  = EPOLLIN;
+        ev.data.fd = m_signal;
+        epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_signal, &ev);
+    }
+}
+
+
+/**
+ * Invoke the given function with our signals unblocked.
+ */
+void EventLoop::unblocked(std::function<void()> fn)
+{
+    /*
+     * Catch the signals, rather than letting their default actions
+     * occur, while they're unblocked.  Children reset caught signals
+     * to their defaults when they exec.
+     */
+    std::map<int, struct sigaction> previous;
+
+    for (std::map<int, std::function<void()> >::iterator it = m_signal_handlers.begin(); it != m_signal_handlers.end(); ++it)
+    {
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = note_signal;
+        sa.sa_flags   = SA_RESTART;
+        sigemptyset(&sa.sa_mask);
+
+        unblocked_signals[it->first] = 0;
+        sigaction(it->first, &sa, &previous[it->first]);
+    }
+
+    sigprocmask(SIG_UNBLOCK, &m_signals, NULL);
+    fn();
+    sigprocmask(SIG_BLOCK, &m_signals, NULL);
+
+    for (std::map<int, struct sigaction>::iterator it = previous.begin(); it != previous.end(); ++it)
+        sigaction(it->first, &it->second, NULL);
+
+    /*
+     * Now handle the signals which were caught.
+     */
+    for (std::map<int, struct sigaction>::iterator it = previous.begin(); it != previous.end(); ++it)
+    {
+        if (unblocked_signals[it->first])
+        {
+            std::function<void()> handler = m_signal_handlers[it->first];
+            handler();
+        }
+    }
+}
+
+
+/**
+ * Wait for input to become available on the console, dispatching
+ * any other events which occur in the meantime.
+ */
+bool EventLoop::wait(long ms)
+{
+    struct epoll_event events[16];
+
+    int count = epoll_wait(m_epoll, events, 16, ms < 0 ? -1 : (int)ms);
+
+    if (count < 0)
+        return false;
+
+    bool handled = false;
+
+    for (int i = 0; i < count; i++)
+    {
+        int fd = events[i].data.fd;
+
+        if (fd == STDIN_FILENO)
+            continue;
+
+        handled = true;
+
+        if (fd == m_timer)
+        {
+            run_timers();
+        }
+        else if (fd == m_signal)
+        {
+            run_signals();
+        }
+        else
+        {
+            /*
+             * Copy the handler, as it might unwatch itself.
+             */
+            std::map<int, std::function<void(int)> >::iterator it = m_fds.find(fd);
+
+            if (it != m_fds.end())
+            {
+                std::function<void(int)> fn = it->second;
+                fn(fd);
+            }
+        }
+    }
+
+    return handled;
+}
+
+
+/**
+ * Arm our timerfd for the next timer which is due.
+ */
+void EventLoop::arm_timer()
+{
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+
+    if (!m_timers.empty())
+    {
+        long due = -1;
+
+        for (std::map<int, timer>::iterator it = m_timers.begin(); it != m_timers.end(); ++it)
+        {
+            if (due == -1 || it->second.due < due)
+                due = it->second.due;
+        }
+
+        /*
+         * A zero value would disarm the timer, so a timer which is
+         * already due fires after a nanosecond.
+         */
+        long delay = due - Util::now_ms();
+
+        if (delay > 0)
+        {
+            spec.it_value.tv_sec  = delay / 1000;
+            spec.it_value.tv_nsec = (delay % 1000) * 1000000;
+        }
+        else
+        {
+            spec.it_value.tv_nsec = 1;
+        }
+    }
+
+    timerfd_settime(m_timer, 0, &spec, NULL);
+}
+
+
+/**
+ * Invoke any timers which are due.
+ */
+void EventLoop::run_timers()
+{
+    uint64_t expirations;
+
+    while (read(m_timer, &expirations, sizeof(expirations)) > 0)
+        ;
+
+    long now = Util::now_ms();
+
+    /*
+     * Find the timers which are due first, as their functions might
+     * add or cancel timers.
+     */
+    std::vector<int> due;
+
+    for (std::map<int, timer>::iterator it = m_timers.begin(); it != m_timers.end(); ++it)
+    {
+        if (it->second.due <= now)
+            due.push_back(it->first);
+    }
+
+    for (std::vector<int>::iterator it = due.begin(); it != due.end(); ++it)
+    {
+        std::map<int, timer>::iterator t = m_timers.find(*it);
+
+        if (t == m_timers.end())
+            continue;
+
+        std::function<bool()> fn = t->second.fn;
+
+        if (fn())
+        {
+            t = m_timers.find(*it);
+
+            if (t != m_timers.end())
+                t->second.due = Util::now_ms() + t->second.interval;
+        }
+        else
+        {
+            m_timers.erase(*it);
+        }
+    }
+
+    arm_timer();
+}
+
+
+/**
+ * Invoke the handlers for any signals we've received.
+ */
+void EventLoop::run_signals()
+{
+    struct signalfd_siginfo info;
+
+    while (read(m_signal, &info, sizeof(info)) == sizeof(info))
+    {
+        std::map<int, std::function<void()> >::iterator it = m_signal_handlers.find(info.ssi_signo);
+
+        if (it != m_signal_handlers.end())
+        {
+            std::function<void()> fn = it->second;
+            fn();
+        }
+    }
+}
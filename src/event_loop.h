@@ -0,0 +1,163 @@
+/* event_loop.h - Waiting for input, timers, signals, and file-descriptors.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <signal.h>
+
+
+/**
+ * The event-loop which drives the editor.
+ *
+ * We wait, via epoll, for input to become available upon the console,
+ * and while we do so we dispatch timers, signals, and activity upon any
+ * other file-descriptors which are being watched.
+ */
+class EventLoop
+{
+public:
+    /**
+     * Constructor.
+     */
+    EventLoop();
+
+    /**
+     * Destructor.
+     */
+    ~EventLoop();
+
+public:
+    /**
+     * Invoke the given function, after `ms` milliseconds.
+     *
+     * If the function returns true it will be invoked again after the
+     * same delay, though never sooner than 10ms.  Returns an ID which
+     * may be passed to `cancel_timer`.
+     */
+    int add_timer(long ms, std::function<bool()> fn);
+
+    /**
+     * Cancel the timer with the given ID, if it is pending.
+     */
+    void cancel_timer(int id);
+
+    /**
+     * Invoke the given function when the file-descriptor is readable.
+     *
+     * Only one function may be registered for each descriptor.
+     */
+    bool watch_fd(int fd, std::function<void(int)> fn);
+
+    /**
+     * Stop watching the given file-descriptor.
+     */
+    void unwatch_fd(int fd);
+
+    /**
+     * Invoke the given function when the signal is received.
+     *
+     * The signal is blocked, and delivered via a signalfd.
+     */
+    void watch_signal(int signo, std::function<void()> fn);
+
+    /**
+     * Invoke the given function with the signals we watch unblocked,
+     * so that any children it launches don't inherit our signal-mask.
+     *
+     * The handlers of signals received meanwhile are invoked once it
+     * has returned.
+     */
+    void unblocked(std::function<void()> fn);
+
+    /**
+     * Wait up to `ms` milliseconds, or forever if `ms` is negative,
+     * for input to become available on the console.
+     *
+     * Returns true if any timers, signals, or file-descriptors were
+     * handled while we waited.
+     */
+    bool wait(long ms);
+
+private:
+
+    /**
+     * Arm our timerfd for the next timer which is due.
+     */
+    void arm_timer();
+
+    /**
+     * Invoke any timers which are due.
+     */
+    void run_timers();
+
+    /**
+     * Invoke the handlers for any signals we've received.
+     */
+    void run_signals();
+
+private:
+
+    /**
+     * A pending timer.
+     */
+    struct timer
+    {
+        long due;
+        long interval;
+        std::function<bool()> fn;
+    };
+
+    /**
+     * Our epoll, timer, and signal descriptors.
+     */
+    int m_epoll;
+    int m_timer;
+    int m_signal;
+
+    /**
+     * Pending timers, and the ID we'll give to the next.
+     */
+    std::map<int, timer> m_timers;
+    int m_next_timer;
+
+    /**
+     * The file-descriptors we're watching.
+     */
+    std::map<int, std::function<void(int)> > m_fds;
+
+    /**
+     * The signals we're watching.
+     */
+    sigset_t m_signals;
+    std::map<int, std::function<void()> > m_signal_handlers;
+};
@@ -0,0 +1,221 @@
+/* keymap.cc - A trie of key-bindings.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "keymap.h"
+
+
+/**
+ * Constructor.
+ */
+Keymap::Keymap()
+{
+    m_root = new node();
+    reset();
+}
+
+
+/**
+ * Destructor.
+ */
+Keymap::~Keymap()
+{
+    delete m_root;
+}
+
+
+/**
+ * Bind the given sequence of keys to a function.
+ */
+void Keymap::bind(const std::vector<std::string> &keys, std::function<bool()> fn)
+{
+    if (keys.empty())
+        return;
+
+    node *n = m_root;
+
+    for (std::vector<std::string>::const_iterator it = keys.begin(); it != keys.end(); ++it)
+    {
+        /*
+         * A prefix can't also be bound to a function.
+         */
+        n->fn = nullptr;
+
+        node *&child = n->children[*it];
+
+        if (child == NULL)
+            child = new node();
+
+        n = child;
+    }
+
+    /*
+     * Replace any bindings beneath this one.
+     */
+    for (std::map<std::string, node *>::iterator it = n->children.begin(); it != n->children.end(); ++it)
+        delete it->second;
+
+    n->children.clear();
+    n->fn = fn;
+
+    reset();
+}
+
+
+/**
+ * Remove the binding for the given sequence of keys.
+ */
+bool Keymap::unbind(const std::vector<std::string> &keys)
+{
+    if (keys.empty())
+        return false;
+
+    /*
+     * Find the parent of the last key, remembering the path to it.
+     */
+    std::vector<node *> path(1, m_root);
+
+    for (size_t i = 0; i + 1 < keys.size(); i++)
+    {
+        std::map<std::string, node *>::iterator it = path.back()->children.find(keys[i]);
+
+        if (it == path.back()->children.end())
+            return false;
+
+        path.push_back(it->second);
+    }
+
+    std::map<std::string, node *>::iterator it = path.back()->children.find(keys.back());
+
+    if (it == path.back()->children.end())
+        return false;
+
+    delete it->second;
+    path.back()->children.erase(it);
+
+    /*
+     * Remove any prefixes which no longer lead to a binding, so that
+     * their keys are treated as unbound once more.
+     */
+    for (size_t i = path.size() - 1; i > 0; i--)
+    {
+        if (!path[i]->children.empty() || path[i]->fn)
+            break;
+
+        delete path[i];
+        path[i - 1]->children.erase(keys[i - 1]);
+    }
+
+    reset();
+    return true;
+}
+
+
+/**
+ * Are there no bindings?
+ */
+bool Keymap::empty()
+{
+    return (m_root->children.empty());
+}
+
+
+/**
+ * Lookup the next key of a sequence.
+ */
+binding_result Keymap::lookup(const std::string &key, std::function<bool()> &fn)
+{
+    std::string name = key;
+
+    /*
+     * Starting a new sequence?
+     */
+    if (m_pending == m_root && !m_escape)
+        m_sequence.clear();
+
+    if (name == "ESC" && !m_escape)
+    {
+        m_escape = true;
+        return BINDING_PREFIX;
+    }
+
+    if (m_escape)
+    {
+        name = "M-" + name;
+        m_escape = false;
+    }
+
+    bool prefixed = (m_pending != m_root);
+    node *n = m_pending;
+
+    if (!m_sequence.empty())
+        m_sequence += " ";
+
+    m_sequence += name;
+
+    std::map<std::string, node *>::iterator it = n->children.find(name);
+
+    if (it == n->children.end())
+    {
+        binding_result res = (prefixed || name != key) ? BINDING_UNDEFINED : BINDING_NONE;
+        m_pending = m_root;
+        return res;
+    }
+
+    if (!it->second->children.empty())
+    {
+        m_pending = it->second;
+        return BINDING_PREFIX;
+    }
+
+    fn = it->second->fn;
+    m_pending = m_root;
+    return (fn ? BINDING_FOUND : BINDING_UNDEFINED);
+}
+
+
+/**
+ * The keys of the sequence most recently looked up.
+ */
+std::string Keymap::sequence()
+{
+    return (m_sequence);
+}
+
+
+/**
+ * Forget any partially-entered sequence.
+ */
+void Keymap::reset()
+{
+    m_pending = m_root;
+    m_escape  = false;
+    m_sequence.clear();
+}
@@ -0,0 +1,161 @@
+/* keymap.h - A trie of key-bindings.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+
+/**
+ * The result of looking up a key.
+ */
+enum binding_result
+{
+    /*
+     * The key completed a binding, whose function should be invoked.
+     */
+    BINDING_FOUND,
+
+    /*
+     * The key was a prefix - ESC, or the start of a sequence.
+     */
+    BINDING_PREFIX,
+
+    /*
+     * The key isn't bound.
+     */
+    BINDING_NONE,
+
+    /*
+     * The key followed a prefix, but the sequence isn't bound.
+     */
+    BINDING_UNDEFINED
+};
+
+
+/**
+ * A trie of key-bindings.
+ *
+ * Each binding is a sequence of key-names, such as "^X" then "^S", which
+ * leads to a function.  Keys are fed to `lookup` one at a time, and we
+ * remember how far through a sequence we are.
+ *
+ * Pressing ESC prefixes the name of the next key with "M-", so that
+ * "ESC x" is looked up as "M-x".
+ */
+class Keymap
+{
+public:
+    /**
+     * Constructor.
+     */
+    Keymap();
+
+    /**
+     * Destructor.
+     */
+    ~Keymap();
+
+public:
+    /**
+     * Bind the given sequence of keys to a function, replacing any
+     * existing binding - or bindings which begin with this sequence.
+     */
+    void bind(const std::vector<std::string> &keys, std::function<bool()> fn);
+
+    /**
+     * Remove the binding for the given sequence of keys, or those that
+     * begin with it.
+     *
+     * Returns false if there was no such binding.
+     */
+    bool unbind(const std::vector<std::string> &keys);
+
+    /**
+     * Are there no bindings?
+     */
+    bool empty();
+
+    /**
+     * Lookup the next key of a sequence.
+     *
+     * If a binding is found its function is stored in `fn`.
+     */
+    binding_result lookup(const std::string &key, std::function<bool()> &fn);
+
+    /**
+     * The keys of the sequence most recently looked up, for messages.
+     */
+    std::string sequence();
+
+private:
+
+    /**
+     * A node in our trie - which is either bound to a function, or
+     * the prefix of further bindings.
+     */
+    struct node
+    {
+        std::function<bool()> fn;
+        std::map<std::string, node *> children;
+
+        ~node()
+        {
+            for (std::map<std::string, node *>::iterator it = children.begin(); it != children.end(); ++it)
+                delete it->second;
+        }
+    };
+
+    /**
+     * Forget any partially-entered sequence.
+     */
+    void reset();
+
+    /**
+     * The root of our trie.
+     */
+    node *m_root;
+
+    /**
+     * The node of a partially-entered sequence, if any, and whether
+     * ESC is pending.
+     */
+    node *m_pending;
+    bool m_escape;
+
+    /**
+     * The keys of the current sequence.
+     */
+    std::string m_sequence;
+};
@@ -36,6 +36,7 @@
 #include <malloc.h>
 #include "editor.h"
 #include "lua_primitives.h"
+#include "util.h"
 
 
 /*
@@ -184,8 +185,398 @@ int create_buffer_lua(lua_State *L)
  */
 int kill_buffer_lua(lua_State *L)
 {
-    (void)L;
     Editor *e = Editor::instance();
+
+    /*
+     * Killing the last buffer exits the editor, and between files
+     * batch-mode kills every buffer but the first, *Messages*.
+     */
+    if (e->headless() &&
+            (e->count_buffers() <= 1 || e->get_current_buffer() == e->buffer_by_name("*Messages*")))
+        return luaL_error(L, "kill_buffer() cannot kill this buffer in batch-mode");
+
     e->kill_current_buffer();
     return 0;
 }
+
+
+/*
+ * The name of the metatable used for buffer objects.
+ */
+#define BUFFER_TYPE "kilua.buffer"
+
+
+/*
+ * Get the buffer a buffer object refers to, raising an error if
+ * it has been killed.
+ *
+ * Buffer objects hold the unique ID of their buffer, rather than a
+ * pointer to it, so that we can detect this.
+ */
+static Buffer *check_buffer(lua_State *L)
+{
+    int *id = (int *)luaL_checkudata(L, 1, BUFFER_TYPE);
+    Buffer *buffer = Editor::instance()->buffer_by_id(*id);
+
+    if (buffer == NULL)
+        luaL_error(L, "the buffer has been killed");
+
+    return (buffer);
+}
+
+
+/*
+ * Push a single row of the buffer, as UTF-8.
+ *
+ * The row is encoded into a buffer which is reused, so this doesn't
+ * allocate once that has grown to the size of the longest row.
+ */
+static void push_row(lua_State *L, erow *row)
+{
+    static thread_local std::string text;
+
+    text.clear();
+    row->utf8(text);
+    lua_pushlstring(L, text.data(), text.size());
+}
+
+
+/*
+ * Push the given line of the buffer, counting from one, or nil.
+ */
+static int push_line(lua_State *L, Buffer *buffer, int n)
+{
+    if (n < 1 || n > (int)buffer->rows.size())
+        lua_pushnil(L);
+    else
+        push_row(L, buffer->rows.at(n - 1));
+
+    return 1;
+}
+
+
+/*
+ * Push a table of the lines of the buffer in the range given by the
+ * optional arguments at the specified stack index, by default all of
+ * them.
+ */
+static int push_lines(lua_State *L, Buffer *buffer, int arg)
+{
+    int count = buffer->rows.size();
+
+    int first = luaL_optinteger(L, arg, 1);
+    int last  = luaL_optinteger(L, arg + 1, count);
+
+    if (first < 1)
+        first = 1;
+
+    if (last > count)
+        last = count;
+
+    lua_createtable(L, last >= first ? last - first + 1 : 0, 0);
+
+    for (int i = first; i <= last; i++)
+    {
+        push_row(L, buffer->rows.at(i - 1));
+        lua_rawseti(L, -2, i - first + 1);
+    }
+
+    return 1;
+}
+
+
+/*
+ * Insert text at the point of the buffer.
+ */
+static int buffer_insert(lua_State *L)
+{
+    Buffer *buffer = check_buffer(L);
+    size_t len;
+    const char *str = luaL_checklstring(L, 2, &len);
+
+    std::wstring wide;
+    Util::utf8_to_wide(str, len, wide);
+    Editor::instance()->insert(wide, buffer);
+
+    buffer->set_dirty(true);
+    return 0;
+}
+
+
+/*
+ * Is the buffer modified?
+ */
+static int buffer_dirty(lua_State *L)
+{
+    Buffer *buffer = check_buffer(L);
+
+    lua_pushboolean(L, buffer->dirty());
+    return 1;
+}
+
+
+/*
+ * Return the count of lines in the buffer.
+ */
+static int buffer_len(lua_State *L)
+{
+    Buffer *buffer = check_buffer(L);
+
+    lua_pushinteger(L, buffer->rows.size());
+    return 1;
+}
+
+
+/*
+ * Return the given line of the buffer, counting from one.
+ */
+static int buffer_line(lua_State *L)
+{
+    Buffer *buffer = check_buffer(L);
+
+    return (push_line(L, buffer, luaL_checkinteger(L, 2)));
+}
+
+
+/*
+ * Return a table of the lines in the given range, by default all of them.
+ */
+static int buffer_lines(lua_State *L)
+{
+    Buffer *buffer = check_buffer(L);
+
+    return (push_lines(L, buffer, 2));
+}
+
+
+/*
+ * Return the name of the buffer.
+ */
+static int buffer_get_name(lua_State *L)
+{
+    Buffer *buffer = check_buffer(L);
+
+    lua_pushstring(L, buffer->get_name());
+    return 1;
+}
+
+
+/*
+ * Make the buffer the current one.
+ */
+static int buffer_select(lua_State *L)
+{
+    Buffer *buffer = check_buffer(L);
+    Editor *e = Editor::instance();
+
+    std::vector<Buffer *> buffers = e->get_buffers();
+
+    for (int i = 0; i < (int)buffers.size(); i++)
+    {
+        if (buffers.at(i) == buffer)
+            e->set_current_buffer(i);
+    }
+
+    return 0;
+}
+
+
+/*
+ * Compare two buffer objects.
+ */
+static int buffer_eq(lua_State *L)
+{
+    int *a = (int *)luaL_checkudata(L, 1, BUFFER_TYPE);
+    int *b = (int *)luaL_checkudata(L, 2, BUFFER_TYPE);
+
+    lua_pushboolean(L, *a == *b);
+    return 1;
+}
+
+
+/*
+ * Describe the buffer object.
+ */
+static int buffer_tostring(lua_State *L)
+{
+    int *id = (int *)luaL_checkudata(L, 1, BUFFER_TYPE);
+    Buffer *buffer = Editor::instance()->buffer_by_id(*id);
+
+    if (buffer)
+        lua_pushfstring(L, "buffer: %s", buffer->get_name());
+    else
+        lua_pushstring(L, "buffer: killed");
+
+    return 1;
+}
+
+
+/*
+ * The methods of buffer objects.
+ */
+static const luaL_Reg buffer_methods[] =
+{
+    { "dirty",  buffer_dirty },
+    { "insert", buffer_insert },
+    { "len",    buffer_len },
+    { "line",   buffer_line },
+    { "lines",  buffer_lines },
+    { "name",   buffer_get_name },
+    { "select", buffer_select },
+    { NULL, NULL }
+};
+
+
+/*
+ * Push an object representing the given buffer.
+ */
+static void push_buffer(lua_State *L, Buffer *buffer)
+{
+    int *id = (int *)lua_newuserdata(L, sizeof(int));
+    *id = buffer->id();
+
+    /*
+     * Create the metatable the first time it is required.
+     */
+    if (luaL_newmetatable(L, BUFFER_TYPE))
+    {
+        lua_newtable(L);
+        luaL_setfuncs(L, buffer_methods, 0);
+        lua_setfield(L, -2, "__index");
+
+        lua_pushcfunction(L, buffer_len);
+        lua_setfield(L, -2, "__len");
+
+        lua_pushcfunction(L, buffer_eq);
+        lua_setfield(L, -2, "__eq");
+
+        lua_pushcfunction(L, buffer_tostring);
+        lua_setfield(L, -2, "__tostring");
+    }
+
+    lua_setmetatable(L, -2);
+}
+
+
+/*
+ * Get an object representing a buffer, which may be used to operate
+ * upon it without selecting it.
+ *
+ * The buffer may be specified by name, or number, by default the
+ * current buffer is returned.
+ */
+int get_buffer_lua(lua_State *L)
+{
+    Editor *e = Editor::instance();
+    int off   = e->get_current_buffer();
+
+    if (lua_type(L, 1) == LUA_TNUMBER)
+        off = lua_tointeger(L, 1);
+    else if (lua_type(L, 1) == LUA_TSTRING)
+        off = e->buffer_by_name(lua_tostring(L, 1));
+
+    if (off < 0 || off >= e->count_buffers())
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    push_buffer(L, e->get_buffers().at(off));
+    return 1;
+}
+
+
+/*
+ * Return the given line of the current buffer, counting from one.
+ */
+int line_lua(lua_State *L)
+{
+    Buffer *buffer = Editor::instance()->current_buffer();
+
+    return (push_line(L, buffer, luaL_checkinteger(L, 1)));
+}
+
+
+/*
+ * Return a table of the lines of the current buffer in the given range,
+ * by default all of them.
+ */
+int lines_lua(lua_State *L)
+{
+    Buffer *buffer = Editor::instance()->current_buffer();
+
+    return (push_lines(L, buffer, 1));
+}
+
+
+/*
+ * The iterator returned by `each_line`.
+ *
+ * The upvalues are the ID of the buffer, the next line, and the last.
+ */
+static int each_line_next(lua_State *L)
+{
+    int id   = lua_tointeger(L, lua_upvalueindex(1));
+    int n    = lua_tointeger(L, lua_upvalueindex(2));
+    int last = lua_tointeger(L, lua_upvalueindex(3));
+
+    /*
+     * Stop if the buffer has been killed, or has shrunk.
+     */
+    Buffer *buffer = Editor::instance()->buffer_by_id(id);
+
+    if (buffer == NULL || n > last || n > (int)buffer->rows.size())
+        return 0;
+
+    lua_pushinteger(L, n + 1);
+    lua_replace(L, lua_upvalueindex(2));
+
+    lua_pushinteger(L, n);
+    push_row(L, buffer->rows.at(n - 1));
+    return 2;
+}
+
+
+/*
+ * Iterate over the lines of the current buffer, in the given range,
+ * returning the number and text of each:
+ *
+ *   for n, text in each_line() do ... end
+ *
+ * Only a single line is copied at a time.
+ */
+int each_line_lua(lua_State *L)
+{
+    Buffer *buffer = Editor::instance()->current_buffer();
+
+    int first = luaL_optinteger(L, 1, 1);
+    int last  = luaL_optinteger(L, 2, buffer->rows.size());
+
+    lua_pushinteger(L, buffer->id());
+    lua_pushinteger(L, first < 1 ? 1 : first);
+    lua_pushinteger(L, last);
+    lua_pushcclosure(L, each_line_next, 3);
+    return 1;
+}
+
+
+/*
+ * Get/Set the distance between the tab stops of the current buffer.
+ */
+int tab_width_lua(lua_State *L)
+{
+    Buffer *buffer = Editor::instance()->current_buffer();
+
+    if (lua_isnumber(L, 1))
+    {
+        int width = lua_tointeger(L, 1);
+
+        if (width < 1)
+            return luaL_error(L, "tab_width() must be at least 1");
+
+        buffer->set_tab_width(width);
+    }
+
+    lua_pushinteger(L, buffer->tab_width());
+    return 1;
+}
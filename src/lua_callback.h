@@ -0,0 +1,99 @@
+/* lua_callback.h - A Lua function which may be invoked later, from C++.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <vector>
+#include "editor.h"
+#include "lua_primitives.h"
+
+
+/**
+ * A Lua function which is invoked later - from a timer, when a
+ * file-descriptor is readable, when a process exits, or when keys are
+ * pressed.
+ *
+ * The function is held in the registry, and released when the last
+ * copy of this object goes away.  It runs within the budget of the
+ * given kind of hook, such as HOOK_TIMER.
+ */
+class lua_callback
+{
+public:
+    lua_callback(lua_State *L, int index, lua_hook hook)
+    {
+        m_hook = hook;
+
+        /*
+         * The callback might have been registered from within a
+         * coroutine, so we always invoke it upon the main thread.
+         */
+        lua_pushmainthread(L);
+        m_lua = lua_tothread(L, -1);
+        lua_pop(L, 1);
+
+        lua_pushvalue(L, index);
+        m_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+    }
+
+    ~lua_callback()
+    {
+        luaL_unref(m_lua, LUA_REGISTRYINDEX, m_ref);
+    }
+
+    /**
+     * Invoke the function, with the given integer arguments, storing the
+     * truthiness of its result in `result` if that is non-NULL.
+     *
+     * Returns false if the function failed.
+     */
+    bool call(std::vector<int> args = std::vector<int>(), bool *result = NULL)
+    {
+        lua_rawgeti(m_lua, LUA_REGISTRYINDEX, m_ref);
+
+        for (std::vector<int>::iterator it = args.begin(); it != args.end(); ++it)
+            lua_pushinteger(m_lua, *it);
+
+        if (!Editor::instance()->pcall_hook(m_hook, args.size(), 1))
+            return false;
+
+        if (result != NULL)
+            *result = lua_toboolean(m_lua, -1);
+
+        lua_pop(m_lua, 1);
+        return true;
+    }
+
+private:
+    lua_State *m_lua;
+    int m_ref;
+    lua_hook m_hook;
+};
@@ -0,0 +1,110 @@
+/* lua_compat.h - Compatibility with Lua 5.1, and LuaJIT.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+extern "C" {
+#include <lua.h>
+#include <lauxlib.h>
+}
+
+
+/*
+ * We're written against the Lua 5.2 API, these are the parts of it we
+ * use which Lua 5.1 - and so LuaJIT - lack.
+ */
+#if LUA_VERSION_NUM < 502
+
+#define lua_rawlen(L, i)       lua_objlen(L, i)
+#define lua_pushglobaltable(L) lua_pushvalue(L, LUA_GLOBALSINDEX)
+
+/*
+ * LuaJIT 2.1 provides this, but 2.0 and Lua 5.1 do not, so we always
+ * use our own.
+ */
+#define luaL_setfuncs(L, l, n) kilua_setfuncs(L, l, n)
+
+static inline void kilua_setfuncs(lua_State *L, const luaL_Reg *l, int nup)
+{
+    for (; l->name != NULL; l++)
+    {
+        for (int i = 0; i < nup; i++)
+            lua_pushvalue(L, -nup);
+
+        lua_pushcclosure(L, l->func, nup);
+        lua_setfield(L, -(nup + 2), l->name);
+    }
+
+    lua_pop(L, nup);
+}
+
+#endif
+
+
+/**
+ * Push the main thread of the given state.
+ *
+ * Lua 5.1 has no record of it, so `lua_compat_open` stores it in the
+ * registry for us.
+ */
+static inline void lua_pushmainthread(lua_State *L)
+{
+#if LUA_VERSION_NUM < 502
+    lua_getfield(L, LUA_REGISTRYINDEX, "kilua.mainthread");
+#else
+    lua_rawgeti(L, LUA_REGISTRYINDEX, LUA_RIDX_MAINTHREAD);
+#endif
+}
+
+
+/**
+ * Prepare a newly created state, which must be the main thread.
+ *
+ * Under Lua 5.1 we record the main thread, and replace `pairs` with a
+ * version which respects the `__pairs` metamethod - as our globals
+ * table relies upon it.
+ */
+static inline void lua_compat_open(lua_State *L)
+{
+#if LUA_VERSION_NUM < 502
+    lua_pushthread(L);
+    lua_setfield(L, LUA_REGISTRYINDEX, "kilua.mainthread");
+
+    luaL_dostring(L,
+                  "local rawpairs = pairs\n"
+                  "pairs = function(t)\n"
+                  "   local mt = getmetatable(t)\n"
+                  "   if mt and mt.__pairs then return mt.__pairs(t) end\n"
+                  "   return rawpairs(t)\n"
+                  "end\n");
+#else
+    (void)L;
+#endif
+}
@@ -42,6 +42,107 @@
 
 
 
+/**
+ * Add an additional cursor, at the given position or the point.
+ */
+int add_cursor_lua(lua_State *L)
+{
+    Editor *e      = Editor::instance();
+    Buffer *buffer = e->current_buffer();
+
+    int x = buffer->cx + buffer->coloff;
+    int y = buffer->cy + buffer->rowoff;
+
+    if (lua_isnumber(L, -2) && lua_isnumber(L, -1))
+    {
+        y = lua_tonumber(L, -1);
+        x = lua_tonumber(L, -2);
+    }
+
+    /*
+     * The cursor must be within the text, and not at the point.
+     */
+    if ((y < 0) || (y >= (int)buffer->rows.size()) ||
+            (x < 0) || (x > (int)buffer->rows.at(y)->chars->size()) ||
+            ((x == buffer->cx + buffer->coloff) && (y == buffer->cy + buffer->rowoff)))
+    {
+        lua_pushboolean(L, 0);
+        return 1;
+    }
+
+    lua_pushboolean(L, buffer->add_cursor(x, y));
+    return 1;
+}
+
+
+/**
+ * Get, or set, the budget of the named hook: the number of milliseconds,
+ * and Lua instructions, a single invocation may take.  Zero means there
+ * is no limit.
+ *
+ * Returns the time, the instructions, and whether the hook was disabled
+ * for overrunning them.
+ */
+int budget_lua(lua_State *L)
+{
+    const char *name    = luaL_checkstring(L, 1);
+    hook_budget *budget = Editor::instance()->budget(name);
+
+    if (budget == NULL)
+        return luaL_error(L, "budget(): there is no hook named %s", name);
+
+    if (lua_isnumber(L, 2))
+        budget->time = lua_tointeger(L, 2);
+
+    if (lua_isnumber(L, 3))
+        budget->instructions = lua_tointeger(L, 3);
+
+    lua_pushinteger(L, budget->time);
+    lua_pushinteger(L, budget->instructions);
+    lua_pushboolean(L, budget->disabled);
+    return 3;
+}
+
+
+/**
+ * Remove all additional cursors.
+ */
+int clear_cursors_lua(lua_State *L)
+{
+    (void)L;
+    Editor *e      = Editor::instance();
+    Buffer *buffer = e->current_buffer();
+    buffer->cursors.clear();
+    return 0;
+}
+
+
+/**
+ * Return a table of the additional cursors.
+ */
+int cursors_lua(lua_State *L)
+{
+    Editor *e      = Editor::instance();
+    Buffer *buffer = e->current_buffer();
+
+    lua_createtable(L, buffer->cursors.size(), 0);
+
+    for (int i = 0; i < (int)buffer->cursors.size(); i++)
+    {
+        lua_createtable(L, 2, 0);
+
+        lua_pushnumber(L, buffer->cursors.at(i).x);
+        lua_rawseti(L, -2, 1);
+        lua_pushnumber(L, buffer->cursors.at(i).y);
+        lua_rawseti(L, -2, 2);
+
+        lua_rawseti(L, -2, i + 1);
+    }
+
+    return 1;
+}
+
+
 /**
  *  Delete a character.
  */
@@ -96,7 +197,8 @@ int exit_lua(lua_State *L)
 int insert_lua(lua_State *L)
 {
     Editor *e      = Editor::instance();
-    const char *str = lua_tostring(L, -1);
+    size_t len;
+    const char *str = lua_tolstring(L, -1, &len);
 
     if (str == NULL)
         return 0;
@@ -104,13 +206,9 @@ int insert_lua(lua_State *L)
     /*
      * Convert the input to wide characters.
      */
-    wchar_t *wide = Util::ascii2wide(str);
-    int size = wcslen(wide);
-
-    for (int i = 0; i < size ; i++)
-        e->insert(wide[i]);
-
-    delete []wide;
+    std::wstring wide;
+    Util::utf8_to_wide(str, len, wide);
+    e->insert(wide);
 
     /*
      * The buffer is now dirty and needs to be re-rendered.
@@ -128,12 +226,15 @@ int key_lua(lua_State *L)
 {
     Editor *e = Editor::instance();
 
+    if (e->headless())
+        return luaL_error(L, "key() is not available in batch-mode");
+
     while (1)
     {
         e->draw_screen();
         unsigned int ch;
 
-        int res = get_wch(&ch);
+        int res = e->read_key(&ch);
 
         /*
          * Chances are this was a timeout.
@@ -148,9 +249,8 @@ int key_lua(lua_State *L)
             /*
              * Convert the character to a string.
              */
-            char *ascii = Util::wchar2ascii(ch);
-            lua_pushstring(L, ascii);
-            delete []ascii;
+            char ascii[Util::max_len];
+            lua_pushlstring(L, ascii, Util::utf8_encode(ch, ascii));
             return 1;
         }
     }
@@ -158,6 +258,58 @@ int key_lua(lua_State *L)
 }
 
 
+/**
+ * Start recording a keyboard macro.
+ */
+int macro_record_lua(lua_State *L)
+{
+    (void)L;
+    Editor *e = Editor::instance();
+    e->macro_record();
+    return 0;
+}
+
+
+/**
+ * Replay the keyboard macro, the given number of times.
+ *
+ * With no count the macro is replayed once, with a count of zero it
+ * is replayed until it fails.
+ */
+int macro_replay_lua(lua_State *L)
+{
+    Editor *e = Editor::instance();
+
+    int count = 1;
+
+    if (lua_isnumber(L, -1))
+        count = lua_tonumber(L, -1);
+
+    lua_pushnumber(L, e->macro_replay(count));
+    return 1;
+}
+
+
+/**
+ * Stop recording a keyboard macro.
+ *
+ * The optional argument is the number of trailing keys to discard,
+ * which allows the binding that invoked us to be ignored.
+ */
+int macro_stop_lua(lua_State *L)
+{
+    Editor *e = Editor::instance();
+
+    int drop = 0;
+
+    if (lua_isnumber(L, -1))
+        drop = lua_tonumber(L, -1);
+
+    e->macro_stop(drop);
+    return 0;
+}
+
+
 /*
  * Get/Set the mark.
  */
@@ -188,6 +340,9 @@ int menu_lua(lua_State *L)
 {
     Editor *e = Editor::instance();
 
+    if (e->headless())
+        return luaL_error(L, "menu() is not available in batch-mode");
+
     if (!lua_istable(L, 1))
     {
         e->set_status(1, "Table expected!");
@@ -254,6 +409,9 @@ int prompt_lua(lua_State *L)
      */
     Editor *e = Editor::instance();
 
+    if (e->headless())
+        return luaL_error(L, "prompt() is not available in batch-mode");
+
     /*
      * Input buffer, and current offset.
      */
@@ -269,17 +427,14 @@ int prompt_lua(lua_State *L)
         /*
          * Build up the combined string of "prompt" + current input
          */
-        int c_len = wcslen(input) + strlen(prompt);
-        char *c_txt = (char *)malloc(c_len + 1);
-
-        sprintf(c_txt, "%s%ls", prompt, input);
+        std::string c_txt = prompt;
+        Util::wide_to_utf8(input, len, c_txt);
 
         /*
          * Display the new prompt.
          */
-        e->set_status(0, c_txt);
+        e->set_status(0, "%s", c_txt.c_str());
         e->draw_screen();
-        free(c_txt);
 
         /*
          * cap at last-x if the input is too long.
@@ -301,7 +456,7 @@ int prompt_lua(lua_State *L)
          */
         unsigned int ch;
 
-        int res = get_wch(&ch);
+        int res = e->read_key(&ch);
 
         if (res == ERR)
             continue;
@@ -311,33 +466,33 @@ int prompt_lua(lua_State *L)
             /*
              * Pass the current text to the callback.
              */
-            char *current = Util::wide2ascii(input);
+            std::string current;
+            Util::wide_to_utf8(input, len, current);
 
             /*
-             * Call the handler.
+             * Call the handler, keeping as much of its result as will
+             * fit in our buffer.
              */
-            char *completed = NULL;
-
-            e->call_lua("on_complete", "s>s", current, &completed);
+            std::string completed;
 
-            if (completed != NULL)
+            if (e->call_lua_result(HOOK_ON_COMPLETE, completed, current))
             {
-                wchar_t *tmp = Util::ascii2wide(completed);
-                wcscpy(input,  tmp);
-                len = wcslen(tmp);
-                delete[]tmp;
-            }
+                std::wstring tmp;
+                Util::utf8_to_wide(completed.c_str(), completed.size(), tmp);
 
-            delete []current;
+                len = std::min(tmp.size(), sizeof(input) / sizeof(input[0]) - 1);
+                wmemcpy(input, tmp.c_str(), len);
+                input[len] = '\0';
+            }
 
         }
         else if (ch == '\n')
         {
             e->set_status(0, "");
 
-            char *out = Util::wide2ascii(input);
-            lua_pushstring(L, out);
-            delete []out;
+            std::string out;
+            Util::wide_to_utf8(input, len, out);
+            lua_pushlstring(L, out.c_str(), out.size());
             return 1;
         }
         else if (ch == KEY_BACKSPACE)
@@ -398,18 +553,35 @@ int open_lua(lua_State *L)
 
     if ((input = fopen(path, "r")) != NULL)
     {
-        wchar_t c;
+        char buf[65536];
+        std::string pending;
+        size_t n;
 
-        while (1)
+        /*
+         * Decode each block, holding back any character split across
+         * the end of it.
+         */
+        while ((n = fread(buf, 1, sizeof(buf), input)) > 0)
         {
-            c = fgetwc(input);
+            pending.append(buf, n);
 
-            if (c == (wchar_t)WEOF)
-                break;
+            size_t complete = Util::utf8_complete(pending.c_str(), pending.size());
+            std::wstring text;
 
-            e->insert(c);
+            Util::utf8_to_wide(pending.c_str(), complete, text);
+            pending.erase(0, complete);
+
+            e->insert(text);
         }
 
+        /*
+         * A truncated character at the end of the file.
+         */
+        std::wstring text;
+        Util::utf8_to_wide(pending.c_str(), pending.size(), text);
+
+        e->insert(text);
+
         fclose(input);
     }
     else
@@ -420,7 +592,7 @@ int open_lua(lua_State *L)
     /*
      * Call the handler.
      */
-    e->call_lua("on_loaded", "s>", path);
+    e->call_lua(HOOK_ON_LOADED, path);
 
     /*
      * Move to start of file.
@@ -460,7 +632,7 @@ int save_lua(lua_State *L)
     /*
      * Call the pre-save handler.
      */
-    e->call_lua("on_save", ">");
+    e->call_lua(HOOK_ON_SAVE);
 
 
     FILE *handle;
@@ -476,20 +648,15 @@ int save_lua(lua_State *L)
      */
     int rows = buffer->rows.size();
 
+    std::string line;
+
     for (int y = 0; y < rows; y++)
     {
-        /*
-         * For each character
-         */
-        int chars = buffer->rows.at(y)->chars->size();
-
-        for (int x = 0; x < chars; x++)
-        {
-            std::wstring chr = buffer->rows.at(y)->chars->at(x);
-            fprintf(handle, "%ls", chr.c_str());
-        }
+        line.clear();
+        buffer->rows.at(y)->utf8(line);
+        line += '\n';
 
-        fprintf(handle, "\n");
+        fwrite(line.c_str(), 1, line.size(), handle);
     }
 
     fclose(handle);
@@ -497,7 +664,7 @@ int save_lua(lua_State *L)
     /*
      * Call the post-save handler.
      */
-    e->call_lua("on_saved", "s>", path);
+    e->call_lua(HOOK_ON_SAVED, path);
 
     e->set_status(0, "");
 
@@ -608,9 +775,8 @@ int search_lua(lua_State *L)
         /*
          * Convert to a C-string
          */
-        char *tmp = Util::widestr2ascii(row_text);
-        std::string text(tmp);
-        delete[]tmp;
+        std::string text;
+        Util::wide_to_utf8(row_text, text);
 
 
         /*
@@ -627,26 +793,27 @@ int search_lua(lua_State *L)
             /*
              * The offset of the match.
              */
-            int pos = result[0].rm_so;
+            int pos = x;
 
-            if (first)
-                pos += (buffer->cx + buffer->coloff);
+            /*
+             * The offset is in bytes, so find the character at it.
+             */
+            for (int done = 0; done < (int)result[0].rm_so && pos < (int)row->chars->size(); pos++)
+            {
+                const std::wstring &cell = row->chars->at(pos);
+
+                for (std::wstring::const_iterator c = cell.begin(); c != cell.end(); ++c)
+                    done += Util::utf8_length(*c);
+            }
 
             /*
-             * Move to the right row.
+             * Move to the right row, and the start of the match.
              */
             buffer->cy     = 0;
             buffer->rowoff = offset;
+            buffer->coloff = 0;
 
-            /* move to start of line. */
-            sol_lua(L);
-
-            /* move right enough times to move to the start of the match. */
-            while (pos > 0)
-            {
-                e->move("right");
-                pos--;
-            }
+            e->show_point(buffer, pos, offset);
 
             /* Avoid leaking our compiled regular expression object. */
             regfree(&regex);
@@ -684,9 +851,9 @@ int selection_lua(lua_State *L)
     Editor *e = Editor::instance();
     std::wstring sel = e->get_selection();
 
-    char *tmp = Util::widestr2ascii(sel);
-    lua_pushstring(L, tmp);
-    delete [] tmp;
+    std::string text;
+    Util::wide_to_utf8(sel, text);
+    lua_pushlstring(L, text.c_str(), text.size());
     return (1);
 }
 
@@ -702,6 +869,34 @@ int status_lua(lua_State *L)
 }
 
 
+/*
+ * Get/Set the template of the status-bar.
+ */
+int status_format_lua(lua_State *L)
+{
+    StatusLine *status = Editor::instance()->status_line();
+
+    if (lua_isstring(L, 1))
+        status->set_format(lua_tostring(L, 1));
+
+    lua_pushstring(L, status->format().c_str());
+    return 1;
+}
+
+
+/*
+ * Forget the cached result of a Lua function in the status-bar, or of
+ * them all.
+ */
+int status_invalidate_lua(lua_State *L)
+{
+    const char *name = lua_tostring(L, 1);
+
+    Editor::instance()->status_line()->invalidate(name ? name : "");
+    return 0;
+}
+
+
 /*
  * Get the text of the buffer.
  */
@@ -710,6 +905,7 @@ int text_lua(lua_State *L)
     Editor *e      = Editor::instance();
     Buffer *buffer = e->current_buffer();
 
-    lua_pushstring(L, buffer->text().c_str());
+    std::string text = buffer->text();
+    lua_pushlstring(L, text.data(), text.size());
     return 1;
 }
@@ -0,0 +1,103 @@
+/* lua_events.cc - Implementation of our timer and file-descriptor lua primitives.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory>
+#include "editor.h"
+#include "lua_callback.h"
+#include "lua_primitives.h"
+
+
+
+/**
+ * Invoke a function after the given number of milliseconds.
+ *
+ * If the function returns true it will be invoked again, after the
+ * same delay.
+ */
+int timer_lua(lua_State *L)
+{
+    int ms = luaL_checkinteger(L, 1);
+    luaL_checktype(L, 2, LUA_TFUNCTION);
+
+    std::shared_ptr<lua_callback> fn = std::make_shared<lua_callback>(L, 2, HOOK_TIMER);
+
+    int id = Editor::instance()->events()->add_timer(ms, [fn]()
+    {
+        bool again = false;
+        fn->call({}, &again);
+        return again;
+    });
+
+    lua_pushinteger(L, id);
+    return 1;
+}
+
+
+/**
+ * Cancel a pending timer.
+ */
+int cancel_timer_lua(lua_State *L)
+{
+    int id = luaL_checkinteger(L, 1);
+    Editor::instance()->events()->cancel_timer(id);
+    return 0;
+}
+
+
+/**
+ * Invoke a function, with the descriptor, whenever the given
+ * file-descriptor is readable.
+ */
+int watch_fd_lua(lua_State *L)
+{
+    int fd = luaL_checkinteger(L, 1);
+    luaL_checktype(L, 2, LUA_TFUNCTION);
+
+    std::shared_ptr<lua_callback> fn = std::make_shared<lua_callback>(L, 2, HOOK_WATCH_FD);
+
+    bool ok = Editor::instance()->events()->watch_fd(fd, [fn](int fd)
+    {
+        fn->call({fd});
+    });
+
+    lua_pushboolean(L, ok);
+    return 1;
+}
+
+
+/**
+ * Stop watching the given file-descriptor.
+ */
+int unwatch_fd_lua(lua_State *L)
+{
+    int fd = luaL_checkinteger(L, 1);
+    Editor::instance()->events()->unwatch_fd(fd);
+    return 0;
+}
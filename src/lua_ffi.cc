@@ -0,0 +1,114 @@
+/* lua_ffi.cc - Entry points for the LuaJIT FFI.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include "editor.h"
+#include "lua_primitives.h"
+
+
+/*
+ * These functions are called directly from Lua code, when running under
+ * LuaJIT, via its FFI.  That avoids pushing and popping values on the Lua
+ * stack for the operations which are performed upon every row of a buffer.
+ *
+ * Buffers are identified by their unique ID, so a buffer which has been
+ * killed is noticed rather than being used.
+ *
+ * For this to work the editor must be linked with `-rdynamic`, which is
+ * what `make luajit` does.
+ */
+
+
+/**
+ * Get the ID of the current buffer.
+ */
+int kilua_buffer(void)
+{
+    return (Editor::instance()->current_buffer()->id());
+}
+
+
+/**
+ * Get the number of rows in the given buffer, or -1 if it has been killed.
+ */
+int kilua_rows(int id)
+{
+    Buffer *buffer = Editor::instance()->buffer_by_id(id);
+
+    if (buffer == NULL)
+        return -1;
+
+    return (buffer->rows.size());
+}
+
+
+/**
+ * Get the UTF-8 text of the given row of a buffer, counting from one,
+ * storing its length in `len`.
+ *
+ * The result is only valid until the next call.
+ *
+ * Returns NULL if there is no such row.
+ */
+const char *kilua_row(int id, int n, size_t *len)
+{
+    static thread_local std::string text;
+
+    Buffer *buffer = Editor::instance()->buffer_by_id(id);
+
+    if (buffer == NULL || n < 1 || n > (int)buffer->rows.size())
+        return NULL;
+
+    text.clear();
+    buffer->rows.at(n - 1)->utf8(text);
+
+    *len = text.size();
+    return (text.data());
+}
+
+
+/**
+ * Set the colours of the given buffer, as `update_colours` does.
+ *
+ * Returns zero if the buffer has been killed.
+ */
+int kilua_update_colours(int id, const char *colours, size_t len)
+{
+    Editor *e      = Editor::instance();
+    Buffer *buffer = e->buffer_by_id(id);
+
+    if (buffer == NULL)
+        return 0;
+
+    stat_timer timer(e->stats(), STAT_HIGHLIGHT);
+    buffer->update_syntax(colours, len);
+    return 1;
+}
@@ -0,0 +1,120 @@
+/* lua_keymap.cc - Implementation of our key-binding lua primitives.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "editor.h"
+#include "lua_callback.h"
+#include "lua_primitives.h"
+
+
+
+/**
+ * Get the sequence of keys at the given index on the stack.
+ *
+ * This is either a string of key-names separated by spaces, such as
+ * "^X ^S", or a table of names - which allows keys such as "^ " to be
+ * specified.
+ */
+static std::vector<std::string> get_keys(lua_State *L, int index)
+{
+    std::vector<std::string> keys;
+
+    if (lua_istable(L, index))
+    {
+        int len = lua_rawlen(L, index);
+
+        for (int i = 1; i <= len; i++)
+        {
+            lua_rawgeti(L, index, i);
+
+            if (lua_isstring(L, -1))
+                keys.push_back(lua_tostring(L, -1));
+
+            lua_pop(L, 1);
+        }
+    }
+    else
+    {
+        std::string str = luaL_checkstring(L, index);
+        size_t start = 0;
+
+        while (start < str.size())
+        {
+            size_t end = str.find(' ', start);
+
+            if (end == std::string::npos)
+                end = str.size();
+
+            if (end > start)
+                keys.push_back(str.substr(start, end - start));
+
+            start = end + 1;
+        }
+    }
+
+    return (keys);
+}
+
+
+/**
+ * Bind a sequence of keys to a function.
+ */
+int bind_lua(lua_State *L)
+{
+    std::vector<std::string> keys = get_keys(L, 1);
+    luaL_checktype(L, 2, LUA_TFUNCTION);
+
+    if (keys.empty())
+        return luaL_error(L, "no keys specified");
+
+    std::shared_ptr<lua_callback> fn = std::make_shared<lua_callback>(L, 2, HOOK_BINDING);
+
+    Editor::instance()->keymap()->bind(keys, [fn]()
+    {
+        return fn->call();
+    });
+
+    return 0;
+}
+
+
+/**
+ * Remove the binding of a sequence of keys.
+ */
+int unbind_lua(lua_State *L)
+{
+    std::vector<std::string> keys = get_keys(L, 1);
+
+    lua_pushboolean(L, Editor::instance()->keymap()->unbind(keys));
+    return 1;
+}
@@ -61,7 +61,7 @@ int eof_lua(lua_State *L)
         max_row--;
     }
 
-    eol_lua(L);
+    eol_lua(NULL);
 
     return 0;
 }
@@ -72,25 +72,23 @@ int eof_lua(lua_State *L)
  */
 int eol_lua(lua_State *L)
 {
-    (void)L;
     Editor *e      = Editor::instance();
     Buffer *buffer = e->current_buffer();
 
     /*
-     * Length is enough to fit.
+     * Show as much of the row as will fit, with the point at its end.
      */
-    erow *row = buffer->rows.at(buffer->cy + buffer->rowoff);
+    int y     = buffer->cy + buffer->rowoff;
+    erow *row = buffer->rows.at(y);
 
-    if ((int)row->chars->size() < e->width())
-    {
-        buffer->coloff = 0;
-        buffer->cx = row->chars->size() ;
-    }
-    else
-    {
-        buffer->cx = e->width() - 1;
-        buffer->coloff = row->chars->size() - e->width() + 1;
-    }
+    buffer->coloff = 0;
+    e->show_point(buffer, row->chars->size(), y);
+
+    /*
+     * When invoked from Lua the additional cursors move too.
+     */
+    if (L != NULL)
+        buffer->move_cursors("eol");
 
     return 0;
 }
@@ -109,7 +107,10 @@ int move_lua(lua_State *L)
     const char *x = lua_tostring(L, -1);
 
     if (x)
+    {
         e->move(x);
+        e->current_buffer()->move_cursors(x);
+    }
 
     return (0);
 }
@@ -134,10 +135,16 @@ int sof_lua(lua_State *L)
  */
 int sol_lua(lua_State *L)
 {
-    (void)L;
     Editor *e      = Editor::instance();
     Buffer *buffer = e->current_buffer();
     buffer->cx = 0;
     buffer->coloff = 0;
+
+    /*
+     * When invoked from Lua the additional cursors move too.
+     */
+    if (L != NULL)
+        buffer->move_cursors("sol");
+
     return 0;
 }
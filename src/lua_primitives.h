@@ -39,6 +39,8 @@ extern "C" {
 #include <lualib.h>
 }
 
+#include "lua_compat.h"
+
 
 
 /*
@@ -54,11 +56,18 @@ extern int sol_lua(lua_State *L);
 /*
  * Core
  */
+extern int add_cursor_lua(lua_State *L);
+extern int budget_lua(lua_State *L);
+extern int clear_cursors_lua(lua_State *L);
+extern int cursors_lua(lua_State *L);
 extern int delete_lua(lua_State *L);
 extern int dirty_lua(lua_State *L);
 extern int exit_lua(lua_State *L);
 extern int insert_lua(lua_State *L);
 extern int key_lua(lua_State *L);
+extern int macro_record_lua(lua_State *L);
+extern int macro_replay_lua(lua_State *L);
+extern int macro_stop_lua(lua_State *L);
 extern int mark_lua(lua_State *L);
 extern int menu_lua(lua_State *L);
 extern int open_lua(lua_State *L);
@@ -67,15 +76,37 @@ extern int prompt_lua(lua_State *L);
 extern int save_lua(lua_State *L);
 extern int search_lua(lua_State *L);
 extern int selection_lua(lua_State *L);
+extern int status_format_lua(lua_State *L);
+extern int status_invalidate_lua(lua_State *L);
 extern int status_lua(lua_State *L);
 extern int text_lua(lua_State *L);
 
+/*
+ * Events.
+ */
+extern int cancel_timer_lua(lua_State *L);
+extern int timer_lua(lua_State *L);
+extern int unwatch_fd_lua(lua_State *L);
+extern int watch_fd_lua(lua_State *L);
+
 /*
  * Files.
  */
 extern int directory_entries_lua(lua_State *L);
 extern int exists_lua(lua_State *L);
 
+/*
+ * Key bindings.
+ */
+extern int bind_lua(lua_State *L);
+extern int unbind_lua(lua_State *L);
+
+/*
+ * Processes.
+ */
+extern int kill_process_lua(lua_State *L);
+extern int spawn_lua(lua_State *L);
+
 /*
  * Screen.
  */
@@ -83,9 +114,18 @@ extern int at_lua(lua_State *L);
 extern int height_lua(lua_State *L);
 extern int width_lua(lua_State *L);
 
+/*
+ * Statistics.
+ */
+extern int gc_lua(lua_State *L);
+extern int profile_start_lua(lua_State *L);
+extern int profile_stop_lua(lua_State *L);
+extern int stats_lua(lua_State *L);
+
 /*
  * Syntax
  */
+extern int highlight_lua(lua_State *L);
 extern int syntax_lua(lua_State *L);
 extern int update_colours_lua(lua_State *L);
 
@@ -97,4 +137,20 @@ extern int buffer_lua(lua_State *L);
 extern int buffer_name_lua(lua_State *L);
 extern int buffers_lua(lua_State *L);
 extern int create_buffer_lua(lua_State *L);
+extern int each_line_lua(lua_State *L);
+extern int get_buffer_lua(lua_State *L);
 extern int kill_buffer_lua(lua_State *L);
+extern int line_lua(lua_State *L);
+extern int lines_lua(lua_State *L);
+extern int tab_width_lua(lua_State *L);
+
+
+/*
+ * Entry points for the LuaJIT FFI.
+ */
+extern "C" {
+    int kilua_buffer(void);
+    int kilua_rows(int id);
+    const char *kilua_row(int id, int n, size_t *len);
+    int kilua_update_colours(int id, const char *colours, size_t len);
+}
@@ -0,0 +1,380 @@
+/* lua_process.cc - Implementation of our subprocess-related lua primitives.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <map>
+#include <memory>
+#include <signal.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include <sys/wait.h>
+
+#include "editor.h"
+#include "lua_callback.h"
+#include "lua_primitives.h"
+#include "util.h"
+
+
+
+/**
+ * A process which is running, launched via `spawn`.
+ */
+struct process
+{
+    /*
+     * The descriptor we read the output from, or -1 once we've seen
+     * end-of-file.
+     */
+    int fd;
+
+    /*
+     * The ID of the buffer the output is appended to, or -1.
+     */
+    int buffer;
+
+    /*
+     * The bytes of a character which was split across reads.
+     */
+    std::string partial;
+
+    /*
+     * Has the process exited?  If so with what status?
+     */
+    bool exited;
+    int status;
+
+    /*
+     * The function to invoke when the process is complete.
+     */
+    std::shared_ptr<lua_callback> on_exit;
+};
+
+
+/*
+ * The processes which are running, and the most recently launched.
+ */
+static std::map<pid_t, process> processes;
+static pid_t last_pid = -1;
+
+
+/*
+ * The most we'll read from a process before returning to the event-loop,
+ * so that a noisy process doesn't prevent us from handling input.
+ */
+#define CHUNK_SIZE 16384
+
+
+/**
+ * Once a process has exited, and we've read all its output, invoke
+ * the exit-function.
+ */
+static void finish_process(pid_t pid)
+{
+    std::map<pid_t, process>::iterator it = processes.find(pid);
+
+    if (it == processes.end() || !it->second.exited || it->second.fd != -1)
+        return;
+
+    std::shared_ptr<lua_callback> fn = it->second.on_exit;
+    int status = it->second.status;
+
+    processes.erase(it);
+
+    if (fn)
+        fn->call({status, (int)pid});
+}
+
+
+/**
+ * Read the output of a process, and append it to the buffer.
+ */
+static void read_process(pid_t pid, int fd)
+{
+    std::map<pid_t, process>::iterator it = processes.find(pid);
+
+    if (it == processes.end())
+        return;
+
+    process &p = it->second;
+
+    char buf[CHUNK_SIZE];
+    ssize_t n = read(fd, buf, sizeof(buf));
+
+    if (n < 0 && (errno == EAGAIN || errno == EINTR))
+        return;
+
+    /*
+     * Decode the output, holding back any character split across the
+     * end of this read - unless this is the end of the output, in which
+     * case a truncated character is decoded as it is.
+     */
+    bool eof = (n <= 0);
+
+    if (!eof)
+        p.partial.append(buf, n);
+
+    size_t complete = eof ? p.partial.size() : Util::utf8_complete(p.partial.c_str(), p.partial.size());
+    std::wstring decoded;
+
+    Util::utf8_to_wide(p.partial.c_str(), complete, decoded);
+    p.partial.erase(0, complete);
+
+    std::wstring text;
+
+    for (std::wstring::iterator it = decoded.begin(); it != decoded.end(); ++it)
+    {
+        if (*it != '\0' && *it != '\r')
+            text += *it;
+    }
+
+    /*
+     * If the buffer has been killed we discard the output.
+     */
+    Editor *e = Editor::instance();
+    Buffer *buffer = e->buffer_by_id(p.buffer);
+
+    if (buffer != NULL && !text.empty())
+        e->append(buffer, text);
+
+    /*
+     * End of file, or an error.
+     */
+    if (eof)
+    {
+        e->events()->unwatch_fd(fd);
+        close(fd);
+        p.fd = -1;
+
+        finish_process(pid);
+    }
+}
+
+
+/**
+ * Reap any of our processes which have exited.
+ */
+static void reap_processes()
+{
+    std::vector<pid_t> done;
+
+    for (std::map<pid_t, process>::iterator it = processes.begin(); it != processes.end(); ++it)
+    {
+        int status;
+
+        if (it->second.exited || waitpid(it->first, &status, WNOHANG) != it->first)
+            continue;
+
+        it->second.exited = true;
+
+        if (WIFEXITED(status))
+            it->second.status = WEXITSTATUS(status);
+        else if (WIFSIGNALED(status))
+            it->second.status = 128 + WTERMSIG(status);
+        else
+            it->second.status = -1;
+
+        done.push_back(it->first);
+    }
+
+    for (std::vector<pid_t>::iterator it = done.begin(); it != done.end(); ++it)
+        finish_process(*it);
+}
+
+
+/**
+ * Run a command, in the background, appending its output to the named
+ * buffer.
+ *
+ * When the command has finished `on_exit(status, pid)` is invoked.
+ */
+int spawn_lua(lua_State *L)
+{
+    const char *cmd  = luaL_checkstring(L, 1);
+    const char *name = lua_tostring(L, 2);
+
+    Editor *e = Editor::instance();
+
+    /*
+     * Output is read by the event-loop, which doesn't run in batch-mode.
+     */
+    if (e->headless())
+        return luaL_error(L, "spawn() is not available in batch-mode");
+
+    /*
+     * Create the buffer if it doesn't exist, without selecting it.
+     */
+    int buffer = -1;
+
+    if (name != NULL)
+    {
+        int index = e->buffer_by_name(name);
+
+        if (index == -1)
+        {
+            int current = e->get_current_buffer();
+            e->new_buffer(name);
+            index = e->get_current_buffer();
+            e->set_current_buffer(current);
+        }
+
+        buffer = e->get_buffers().at(index)->id();
+    }
+
+    std::shared_ptr<lua_callback> on_exit;
+
+    if (lua_isfunction(L, 3))
+        on_exit = std::make_shared<lua_callback>(L, 3, HOOK_ON_EXIT);
+
+    /*
+     * Ensure we're told when children exit.
+     */
+    static bool watching = false;
+
+    if (!watching)
+    {
+        e->events()->watch_signal(SIGCHLD, reap_processes);
+        watching = true;
+    }
+
+    int fds[2];
+
+    if (pipe2(fds, O_CLOEXEC) != 0)
+    {
+        lua_pushnil(L);
+        lua_pushstring(L, strerror(errno));
+        return 2;
+    }
+
+    pid_t pid = fork();
+
+    if (pid < 0)
+    {
+        close(fds[0]);
+        close(fds[1]);
+
+        lua_pushnil(L);
+        lua_pushstring(L, strerror(errno));
+        return 2;
+    }
+
+    if (pid == 0)
+    {
+        /*
+         * The child runs in its own process-group, so that we can kill
+         * it along with anything it launches.
+         */
+        setpgid(0, 0);
+
+        int null = open("/dev/null", O_RDONLY);
+        dup2(null, STDIN_FILENO);
+        dup2(fds[1], STDOUT_FILENO);
+        dup2(fds[1], STDERR_FILENO);
+
+        if (null > STDERR_FILENO)
+            close(null);
+
+        /*
+         * We block signals which we handle via the event-loop, and the
+         * mask is inherited - so reset it.
+         */
+        sigset_t none;
+        sigemptyset(&none);
+        sigprocmask(SIG_SETMASK, &none, NULL);
+
+        execl("/bin/sh", "sh", "-c", cmd, (char *)NULL);
+        _exit(127);
+    }
+
+    setpgid(pid, pid);
+    close(fds[1]);
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+
+    process p;
+    p.fd      = fds[0];
+    p.buffer  = buffer;
+    p.exited  = false;
+    p.status  = -1;
+    p.on_exit = on_exit;
+
+    processes[pid] = p;
+    last_pid = pid;
+
+    e->events()->watch_fd(fds[0], [pid](int fd)
+    {
+        read_process(pid, fd);
+    });
+
+    lua_pushinteger(L, pid);
+    return 1;
+}
+
+
+/**
+ * Kill a process launched by `spawn`.
+ *
+ * By default we kill the process writing to the current buffer, or
+ * failing that the most recently launched process.
+ */
+int kill_process_lua(lua_State *L)
+{
+    pid_t pid = -1;
+
+    if (lua_isnumber(L, 1))
+    {
+        pid = lua_tointeger(L, 1);
+    }
+    else
+    {
+        int buffer = Editor::instance()->current_buffer()->id();
+
+        for (std::map<pid_t, process>::iterator it = processes.begin(); it != processes.end(); ++it)
+        {
+            if (!it->second.exited && it->second.buffer == buffer)
+                pid = it->first;
+        }
+
+        if (pid == -1)
+            pid = last_pid;
+    }
+
+    std::map<pid_t, process>::iterator it = processes.find(pid);
+
+    if (it == processes.end() || it->second.exited)
+    {
+        lua_pushboolean(L, 0);
+        return 1;
+    }
+
+    lua_pushboolean(L, kill(-pid, SIGTERM) == 0);
+    return 1;
+}
@@ -35,6 +35,7 @@
 #include <string.h>
 #include "editor.h"
 #include "lua_primitives.h"
+#include "util.h"
 
 
 
@@ -78,10 +79,9 @@ int at_lua(lua_State *L)
         }
     }
 
-    char *str = new char[7];
-    sprintf(str, "%ls", res.c_str());
-    lua_pushstring(L, str);
-    delete []str;
+    std::string str;
+    Util::wide_to_utf8(res, str);
+    lua_pushlstring(L, str.c_str(), str.size());
     return 1;
 }
 
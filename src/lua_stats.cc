@@ -0,0 +1,242 @@
+/* lua_stats.cc - Statistics about the editor's performance.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "editor.h"
+#include "lua_primitives.h"
+#include "profiler.h"
+
+
+
+/**
+ * Return the timings of the phases of our main-loop, and our memory use.
+ *
+ * The result is a table:
+ *
+ *   phases  - An array of tables, with the name, count, mean, p99, and max
+ *             time of each phase, in milliseconds.
+ *   lua     - The memory used by Lua, in bytes.
+ *   pool_reserved, pool_used
+ *           - The memory held for Lua's small objects, and the amount of
+ *             it in use, in bytes.
+ *   buffers - An array of tables, with the name and memory of each buffer.
+ */
+int stats_lua(lua_State *L)
+{
+    Editor *e    = Editor::instance();
+    Stats *stats = e->stats();
+
+    lua_newtable(L);
+
+    /*
+     * The phases.
+     */
+    lua_newtable(L);
+
+    for (int i = 0; i < STAT_MAX; i++)
+    {
+        stat_phase phase = (stat_phase)i;
+
+        lua_newtable(L);
+
+        lua_pushstring(L, stats->name(phase));
+        lua_setfield(L, -2, "name");
+
+        lua_pushinteger(L, stats->count(phase));
+        lua_setfield(L, -2, "count");
+
+        lua_pushnumber(L, stats->mean(phase));
+        lua_setfield(L, -2, "mean");
+
+        lua_pushnumber(L, stats->percentile(phase, 99));
+        lua_setfield(L, -2, "p99");
+
+        lua_pushnumber(L, stats->max(phase));
+        lua_setfield(L, -2, "max");
+
+        lua_rawseti(L, -2, i + 1);
+    }
+
+    lua_setfield(L, -2, "phases");
+
+    /*
+     * The memory used by Lua.
+     */
+    lua_pushinteger(L, lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0));
+    lua_setfield(L, -2, "lua");
+
+    /*
+     * The slabs our allocator holds, and how much of them is in use.
+     */
+    Pool *pool = e->pool();
+
+    if (pool != NULL)
+    {
+        lua_pushinteger(L, pool->reserved());
+        lua_setfield(L, -2, "pool_reserved");
+
+        lua_pushinteger(L, pool->used());
+        lua_setfield(L, -2, "pool_used");
+    }
+
+    /*
+     * The memory used by each buffer.
+     */
+    lua_newtable(L);
+
+    std::vector<Buffer *> buffers = e->get_buffers();
+    int i = 1;
+
+    for (std::vector<Buffer *>::iterator it = buffers.begin(); it != buffers.end(); ++it)
+    {
+        lua_newtable(L);
+
+        lua_pushstring(L, (*it)->get_name());
+        lua_setfield(L, -2, "name");
+
+        lua_pushinteger(L, (*it)->memory());
+        lua_setfield(L, -2, "memory");
+
+        lua_rawseti(L, -2, i++);
+    }
+
+    lua_setfield(L, -2, "buffers");
+
+    return 1;
+}
+
+
+/**
+ * Get, or set, the parameters of the garbage-collector: the pause, and
+ * the step multiplier, as percentages.
+ *
+ * Under Lua 5.2 a third parameter of "generational", or "incremental",
+ * changes the mode of the collector.
+ */
+int gc_lua(lua_State *L)
+{
+    int pause   = lua_gc(L, LUA_GCSETPAUSE, 100);
+    int stepmul = lua_gc(L, LUA_GCSETSTEPMUL, 100);
+
+    if (lua_isnumber(L, 1))
+        pause = lua_tointeger(L, 1);
+
+    if (lua_isnumber(L, 2))
+        stepmul = lua_tointeger(L, 2);
+
+    lua_gc(L, LUA_GCSETPAUSE, pause);
+    lua_gc(L, LUA_GCSETSTEPMUL, stepmul);
+
+    if (lua_isstring(L, 3))
+    {
+        std::string mode = lua_tostring(L, 3);
+        int what = -1;
+
+#ifdef LUA_GCGEN
+
+        if (mode == "generational")
+            what = LUA_GCGEN;
+
+        if (mode == "incremental")
+            what = LUA_GCINC;
+
+#endif
+
+        if (what == -1)
+            return luaL_error(L, "gc(): unsupported mode %s", mode.c_str());
+
+        lua_gc(L, what, 0);
+    }
+
+    lua_pushinteger(L, pause);
+    lua_pushinteger(L, stepmul);
+    return 2;
+}
+
+
+/**
+ * Start the sampling profiler, which samples the Lua stack every
+ * `interval` milliseconds of CPU-time.
+ *
+ * Returns false if the profiler is already running.
+ */
+int profile_start_lua(lua_State *L)
+{
+    double interval = luaL_optnumber(L, 1, 1);
+
+    if (interval <= 0)
+        return luaL_error(L, "profile_start() requires a positive interval");
+
+    /*
+     * The profiler samples a single Lua state, but in batch-mode each
+     * thread has its own.
+     */
+    if (Editor::instance()->headless())
+        return luaL_error(L, "profile_start() is not available in batch-mode");
+
+    lua_pushboolean(L, profiler_start(L, (long)(interval * 1000)));
+    return 1;
+}
+
+
+/**
+ * Stop the sampling profiler, and return its samples as folded stacks.
+ *
+ * If a filename is given the samples are written to it too, ready for
+ * flamegraph.pl.
+ */
+int profile_stop_lua(lua_State *L)
+{
+    const char *path = luaL_optstring(L, 1, NULL);
+
+    if (!profiler_running())
+        return 0;
+
+    std::string folded = profiler_stop();
+
+    if (path != NULL)
+    {
+        FILE *handle;
+
+        if ((handle = fopen(path, "w")) == NULL)
+        {
+            Editor::instance()->set_status(1, "Failed to open %s for writing", path);
+        }
+        else
+        {
+            fwrite(folded.c_str(), 1, folded.size(), handle);
+            fclose(handle);
+        }
+    }
+
+    lua_pushstring(L, folded.c_str());
+    return 1;
+}
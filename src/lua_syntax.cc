@@ -60,6 +60,33 @@ int syntax_lua(lua_State *L)
 
 
 
+/**
+ * Invoke the given function, with any further arguments, timing it as
+ * the `highlight` phase of the main-loop - so that the parsing done by
+ * a syntax-mode is counted along with the update of the colours.
+ */
+int highlight_lua(lua_State *L)
+{
+    luaL_checktype(L, 1, LUA_TFUNCTION);
+
+    /*
+     * The function might raise an error, which would skip the
+     * destructor of our timer, so catch it and raise it again after.
+     */
+    int erred;
+
+    {
+        stat_timer timer(Editor::instance()->stats(), STAT_HIGHLIGHT);
+        erred = lua_pcall(L, lua_gettop(L) - 1, LUA_MULTRET, 0);
+    }
+
+    if (erred)
+        return lua_error(L);
+
+    return (lua_gettop(L));
+}
+
+
 /**
  * Update the colours of each row.
  */
@@ -79,6 +106,7 @@ int update_colours_lua(lua_State *L)
      * Update the syntax - again we pass the size
      * to cope with embedded NULL (i.e. colour 0).
      */
+    stat_timer timer(e->stats(), STAT_HIGHLIGHT);
     buffer->update_syntax(buff, size);
     return 0;
 }
@@ -30,17 +30,32 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <dirent.h>
 #include <locale.h>
 #include <getopt.h>
 #include <netdb.h>
 #include <unistd.h>
 #include <sys/socket.h>
+#include <sys/wait.h>
 
+#include "batch.h"
 #include "config.h"
 #include "editor.h"
+#include "server.h"
+#include "util.h"
 
 
 
+/**
+ * Disable the terminal's bracketed-paste mode.
+ */
+void disable_paste()
+{
+    printf("\033[?2004l");
+    fflush(stdout);
+}
+
+
 /**
  * Setup the curses environment, along with the colours.
  */
@@ -85,7 +100,14 @@ void setup()
     raw();
     keypad(stdscr, TRUE);
     noecho();
-    timeout(750);
+
+    /*
+     * Enable bracketed-paste, so that we can recognize pasted text,
+     * and ensure it is disabled when we exit.
+     */
+    printf("\033[?2004h");
+    fflush(stdout);
+    atexit(disable_paste);
 }
 
 
@@ -98,21 +120,213 @@ void teardown()
 }
 
 
+/*
+ * The phases of our startup, and how long each took, which are shown if
+ * `--startup-trace` is given.
+ */
+static std::vector<std::string> startup_phases;
+static long startup_begin = Util::now_us();
+static long startup_last  = startup_begin;
+
+
+/**
+ * Record that the named phase of startup has completed.
+ */
+void startup_phase(const char *name)
+{
+    long now = Util::now_us();
+
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%-24s %8.2fms %8.2fms total", name,
+             (now - startup_last) / 1000.0, (now - startup_begin) / 1000.0);
+
+    startup_phases.push_back(buf);
+    startup_last = now;
+}
+
+
+/**
+ * Count the configuration files which exist for fully-qualified versions
+ * of the given short hostname, i.e. ~/.kilua/$hostname.*.lua, storing the
+ * path of the last one found in `path`.
+ */
+int fqdn_configs(const char *home, const char *hostname, std::string &path)
+{
+    std::string dir    = std::string(home) + "/.kilua";
+    std::string prefix = std::string(hostname) + ".";
+
+    DIR *dp = opendir(dir.c_str());
+
+    if (dp == NULL)
+        return 0;
+
+    int found = 0;
+    struct dirent *de;
+
+    while ((de = readdir(dp)) != NULL)
+    {
+        std::string name = de->d_name;
+
+        if (name.size() > prefix.size() + 4 &&
+                name.compare(0, prefix.size(), prefix) == 0 &&
+                name.compare(name.size() - 4, 4, ".lua") == 0)
+        {
+            path = dir + "/" + name;
+            found++;
+        }
+    }
+
+    closedir(dp);
+    return found;
+}
+
+
+/**
+ * Look up the fully-qualified name of the given host, returning the
+ * empty string if it has none.
+ */
+std::string resolve_fqdn(const char *hostname)
+{
+    std::string name;
+
+    struct addrinfo hints;
+    struct addrinfo *res;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_flags = AI_CANONNAME;
+
+    if (getaddrinfo(hostname, NULL, &hints, &res) == 0)
+    {
+        if (res->ai_canonname != NULL)
+            name = res->ai_canonname;
+
+        freeaddrinfo(res);
+    }
+
+    return name;
+}
+
+
+/**
+ * Load ~/.kilua/$fqdn.lua, once we've found our fully-qualified hostname.
+ *
+ * The lookup uses the DNS, which might be slow, so it happens in a child
+ * process while the editor is running - rather than delaying startup.
+ */
+void load_fqdn_config(Editor *e, const char *home, const char *hostname, bool trace)
+{
+    int fds[2];
+
+    if (pipe(fds) != 0)
+        return;
+
+    pid_t pid = fork();
+
+    if (pid < 0)
+    {
+        close(fds[0]);
+        close(fds[1]);
+        return;
+    }
+
+    /*
+     * The child writes the canonical name to the pipe, if it has one.
+     */
+    if (pid == 0)
+    {
+        close(fds[0]);
+
+        std::string name = resolve_fqdn(hostname);
+        ssize_t n = write(fds[1], name.data(), name.size());
+        (void)n;
+
+        _exit(0);
+    }
+
+    close(fds[1]);
+
+    std::string dir   = std::string(home) + "/.kilua/";
+    std::string shost = hostname;
+    long start        = Util::now_us();
+
+    e->events()->watch_fd(fds[0], [e, pid, dir, shost, start, trace](int fd)
+    {
+        char buf[1024];
+        ssize_t n = read(fd, buf, sizeof(buf) - 1);
+
+        e->events()->unwatch_fd(fd);
+        close(fd);
+        waitpid(pid, NULL, 0);
+
+        if (n <= 0)
+            return;
+
+        buf[n] = '\0';
+
+        if (trace)
+            e->log_message("%-24s %8.2fms, as %s", "resolved hostname",
+                           (Util::now_us() - start) / 1000.0, buf);
+
+        /*
+         * The editor is running by now, so an error in the file must not
+         * terminate it.
+         */
+        std::string path = dir + buf + ".lua";
+
+        if (shost != buf && access(path.c_str(), R_OK) == 0)
+            e->load_lua(path.c_str(), true, false);
+    });
+}
+
+
 /**
  * Setup the console, and start the editor.
  */
 int main(int argc, char *argv[])
 {
 
+    /*
+     * If we're a client we ask a running editor to open our files, and
+     * never touch the terminal.
+     *
+     * Arguments after "--" are filenames, rather than options.
+     */
+    for (int i = 1; i < argc && strcmp(argv[i], "--") != 0; i++)
+    {
+        if (strcmp(argv[i], "--client") == 0)
+            return (client_main(std::vector<std::string>(argv + i + 1, argv + argc)));
+    }
+
+    /*
+     * Similarly in batch-mode we run a script against files, without a
+     * terminal.
+     */
+    for (int i = 1; i < argc && strcmp(argv[i], "--") != 0; i++)
+    {
+        if (strcmp(argv[i], "--batch") == 0 || strncmp(argv[i], "--batch=", 8) == 0)
+            return (batch_main(argc, argv));
+    }
+
     /*
      * Setup curses.
      */
     setup();
+    startup_phase("curses");
 
     /*
      * Create a new editor.
      */
     Editor *e = Editor::instance();
+    startup_phase("lua");
+
+    /*
+     * Should we report how long each phase of our startup took?
+     */
+    bool trace = false;
+
+    /*
+     * Should we accept files from `kilua --client`?
+     */
+    bool server = false;
 
     /*
      * Parse command-line options.
@@ -123,6 +337,8 @@ int main(int argc, char *argv[])
         {
             {"config", required_argument, 0, 'c'},
             {"dump-config", no_argument, 0, 'd'},
+            {"server", no_argument, 0, 'S'},
+            {"startup-trace", no_argument, 0, 't'},
             {"syntax-path", required_argument, 0, 's'},
             {"version", no_argument, 0, 'v'},
             {0, 0, 0, 0}
@@ -131,7 +347,7 @@ int main(int argc, char *argv[])
         /* getopt_long stores the option index here. */
         int option_index = 0;
 
-        char c = getopt_long(argc, argv, "c:s:vd", long_options, &option_index);
+        char c = getopt_long(argc, argv, "c:s:vdtS", long_options, &option_index);
 
         /* Detect the end of the options. */
         if (c == -1)
@@ -153,6 +369,14 @@ int main(int argc, char *argv[])
             e->set_syntax_path(optarg);
             break;
 
+        case 'S':
+            server = true;
+            break;
+
+        case 't':
+            trace = true;
+            break;
+
         case 'v':
             endwin();
             fprintf(stderr, "kilua v£π\n");
@@ -162,7 +386,7 @@ int main(int argc, char *argv[])
         }
     }
 
-
+    startup_phase("options");
 
 
     /*
@@ -173,7 +397,7 @@ int main(int argc, char *argv[])
     char init_buf[1024] = {'\0'};
     snprintf(init_buf, sizeof(init_buf) - 1, "%s%s",
              getenv("HOME"), "/.kilua/init.lua");
-    loaded += e->load_lua(init_buf);
+    loaded += e->load_lua(init_buf, true);
 
     /*
      * Load our default configuration file ~/.kilua/$hostname.lua
@@ -181,14 +405,39 @@ int main(int argc, char *argv[])
     char *hostname = e->hostname();
     snprintf(init_buf, sizeof(init_buf) - 1, "%s/.kilua/%s.lua",
              getenv("HOME"), hostname);
-    loaded += e->load_lua(init_buf);
+    loaded += e->load_lua(init_buf, true);
+
+    /*
+     * If there is a configuration file for our fully-qualified hostname
+     * we'll load that once we've looked it up, which uses the DNS.
+     *
+     * If we've loaded nothing else, and there's only one candidate, we
+     * load it now without the lookup - as the original code counted it
+     * when deciding whether to use the default configuration.
+     */
+    const char *home = getenv("HOME");
+
+    std::string fqdn_path;
+    int fqdn_count = 0;
+
+    if (home != NULL && getenv("HOSTNAME") == NULL &&
+            strchr(hostname, '.') == NULL)
+        fqdn_count = fqdn_configs(home, hostname, fqdn_path);
+
+    if (fqdn_count == 1 && loaded == 0)
+        loaded += e->load_lua(fqdn_path.c_str(), true);
+    else if (fqdn_count > 0)
+        load_fqdn_config(e, home, hostname, trace);
+
     free(hostname);
 
     /*
      * If we loaded nothing use the default.
      */
     if (loaded == 0)
-        e->eval_lua((const char *)kilua_lua);
+        e->load_default_config();
+
+    startup_phase("configuration");
 
     /*
      * Filenames we'll load in our editor session.
@@ -208,11 +457,25 @@ int main(int argc, char *argv[])
      * Load the files.
      */
     e->load_files(files);
+    startup_phase("files");
+
+    if (server)
+        server_start(e);
 
     /*
      * Initial render.
      */
     e->draw_screen();
+    startup_phase("first draw");
+
+    /*
+     * The screen is ours now, so the trace goes to *Messages*.
+     */
+    if (trace)
+    {
+        for (std::vector<std::string>::iterator it = startup_phases.begin(); it != startup_phases.end(); ++it)
+            e->log_message("%s", it->c_str());
+    }
 
     /*
      * Run main-loop - this never terminates.
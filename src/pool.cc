@@ -0,0 +1,194 @@
+/* pool.cc - A size-class allocator for Lua.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "pool.h"
+
+
+/**
+ * Constructor.
+ */
+Pool::Pool()
+{
+    memset(m_free, 0, sizeof(m_free));
+    m_top  = NULL;
+    m_end  = NULL;
+    m_used = 0;
+}
+
+
+/**
+ * Destructor.
+ *
+ * The Lua state must have been closed first.
+ */
+Pool::~Pool()
+{
+    for (std::vector<char *>::iterator it = m_slabs.begin(); it != m_slabs.end(); ++it)
+        free(*it);
+}
+
+
+/**
+ * The `lua_Alloc` function.
+ *
+ * Lua tells us the size of the block it is resizing, or freeing, so we
+ * know which size-class it came from without storing a header.  When
+ * `ptr` is NULL `osize` describes the type of object being allocated,
+ * rather than a size, so we ignore it.
+ */
+void *Pool::alloc(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+    Pool *pool = (Pool *)ud;
+
+    if (ptr == NULL)
+        osize = 0;
+
+    size_t ocls = osize ? (osize - 1) / GRAIN : 0;
+    size_t ncls = nsize ? (nsize - 1) / GRAIN : 0;
+    bool osmall = osize && ocls < CLASSES;
+    bool nsmall = nsize && ncls < CLASSES;
+
+    /*
+     * Freeing.
+     */
+    if (nsize == 0)
+    {
+        if (osmall)
+            pool->put(ptr, ocls);
+        else
+            free(ptr);
+
+        return NULL;
+    }
+
+    /*
+     * Neither block is small, so this is a job for the C library.
+     */
+    if (!osmall && !nsmall)
+        return realloc(ptr, nsize);
+
+    /*
+     * The block is already large enough.
+     */
+    if (osmall && nsmall && ocls == ncls)
+        return ptr;
+
+    void *result = nsmall ? pool->get(ncls) : malloc(nsize);
+
+    if (result == NULL)
+        return NULL;
+
+    if (ptr != NULL)
+    {
+        memcpy(result, ptr, osize < nsize ? osize : nsize);
+
+        if (osmall)
+            pool->put(ptr, ocls);
+        else
+            free(ptr);
+    }
+
+    return result;
+}
+
+
+/**
+ * Get a block of the given size-class.
+ */
+void *Pool::get(size_t cls)
+{
+    size_t size = (cls + 1) * GRAIN;
+
+    m_used += size;
+
+    if (m_free[cls] != NULL)
+    {
+        block *b = m_free[cls];
+        m_free[cls] = b->next;
+        return b;
+    }
+
+    /*
+     * Carve the block from the current slab, or a new one.  The tail
+     * of the old slab, if any, is wasted.
+     */
+    if (m_top == NULL || (size_t)(m_end - m_top) < size)
+    {
+        char *slab = (char *)malloc(SLAB_SIZE);
+
+        if (slab == NULL)
+        {
+            m_used -= size;
+            return NULL;
+        }
+
+        m_slabs.push_back(slab);
+        m_top = slab;
+        m_end = slab + SLAB_SIZE;
+    }
+
+    void *result = m_top;
+    m_top += size;
+    return result;
+}
+
+
+/**
+ * Release a block of the given size-class.
+ */
+void Pool::put(void *ptr, size_t cls)
+{
+    block *b    = (block *)ptr;
+    b->next     = m_free[cls];
+    m_free[cls] = b;
+
+    m_used -= (cls + 1) * GRAIN;
+}
+
+
+/**
+ * The number of bytes held in slabs.
+ */
+size_t Pool::reserved()
+{
+    return (m_slabs.size() * SLAB_SIZE);
+}
+
+
+/**
+ * The number of bytes of small blocks in use.
+ */
+size_t Pool::used()
+{
+    return (m_used);
+}
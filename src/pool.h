@@ -0,0 +1,106 @@
+/* pool.h - A size-class allocator for Lua.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+
+/**
+ * An allocator for a Lua state, suitable for `lua_newstate`.
+ *
+ * Most of the objects Lua allocates are small - strings, tables, and
+ * closures - and short-lived, so rather than calling `malloc` for each we
+ * keep a free-list of blocks for each size-class, carved from larger
+ * slabs.  Larger blocks are passed to `realloc` and `free` as normal.
+ *
+ * A pool belongs to a single Lua state, so it doesn't lock.
+ */
+class Pool
+{
+public:
+    Pool();
+    ~Pool();
+
+public:
+    /**
+     * The `lua_Alloc` function, whose user-data is the pool.
+     */
+    static void *alloc(void *ud, void *ptr, size_t osize, size_t nsize);
+
+    /**
+     * The number of bytes held in slabs, and the number of those which
+     * are in use.
+     */
+    size_t reserved();
+    size_t used();
+
+private:
+    /**
+     * Blocks are a multiple of this size, up to the largest size-class,
+     * and are aligned to it.
+     */
+    static const size_t GRAIN = 16;
+    static const size_t CLASSES = 16;
+
+    /**
+     * The size of the slabs which small blocks are carved from.
+     */
+    static const size_t SLAB_SIZE = 64 * 1024;
+
+    /**
+     * Get, and release, a block of the given size-class.
+     */
+    void *get(size_t cls);
+    void put(void *ptr, size_t cls);
+
+    /**
+     * A free block is a link in the free-list of its size-class.
+     */
+    struct block
+    {
+        block *next;
+    };
+
+    block *m_free[CLASSES];
+
+    /**
+     * The slabs we've allocated, and the unused space of the latest.
+     */
+    std::vector<char *> m_slabs;
+    char *m_top;
+    char *m_end;
+
+    /**
+     * The bytes of small blocks in use.
+     */
+    size_t m_used;
+};
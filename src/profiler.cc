@@ -0,0 +1,237 @@
+/* profiler.cc - A sampling profiler for Lua code.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <map>
+#include <string.h>
+#include <sys/time.h>
+
+#include "profiler.h"
+
+
+/*
+ * This is a sampling profiler: a CPU-time timer delivers SIGPROF, and if
+ * Lua is running the signal-handler installs a hook which Lua invokes
+ * before its next instruction.  The hook records the stack, and removes
+ * itself.
+ *
+ * Setting a hook is one of the few things which are safe to do from a
+ * signal-handler, and recording the stack within the hook means we don't
+ * allocate, or touch the Lua state, in the handler itself.
+ */
+
+
+thread_local volatile sig_atomic_t profiler_lua_depth = 0;
+
+
+/*
+ * The state we're sampling, or NULL if we're not running.
+ */
+static lua_State *profiled = NULL;
+
+/*
+ * Ticks which have arrived while Lua was running, and haven't yet been
+ * recorded by our hook, and the ticks which arrived while it wasn't.
+ */
+static volatile sig_atomic_t pending = 0;
+static volatile sig_atomic_t outside = 0;
+
+/*
+ * The number of samples of each distinct stack.
+ */
+static std::map<std::string, long> samples;
+
+/*
+ * The handler we replaced.
+ */
+static struct sigaction previous;
+
+/*
+ * The hook we replaced, which enforces the budget of the running editor
+ * hook, if any, and is reinstated once we've taken our sample.
+ */
+static volatile lua_Hook saved_hook  = NULL;
+static volatile int      saved_mask  = 0;
+static volatile int      saved_count = 0;
+
+
+/**
+ * Record the current stack, once per pending tick.
+ */
+static void profiler_hook(lua_State *L, lua_Debug *ar)
+{
+    (void)ar;
+
+    lua_sethook(L, saved_hook, saved_mask, saved_count);
+
+    int count = pending;
+    pending   = 0;
+
+    if (count == 0)
+        return;
+
+    /*
+     * Frames are separated by semi-colons, outermost first, and each is
+     * named for its function, and the line that was running within it.
+     */
+    std::string stack;
+    lua_Debug info;
+
+    for (int level = 0; lua_getstack(L, level, &info); level++)
+    {
+        lua_getinfo(L, "Sln", &info);
+
+        std::string frame;
+
+        if (info.name != NULL)
+            frame = info.name;
+        else if (info.what[0] == 'm')
+            frame = "main";
+        else if (info.what[0] == 'C')
+            frame = "?";
+        else
+            frame = "function <" + std::string(info.short_src) + ":" + std::to_string(info.linedefined) + ">";
+
+        if (info.currentline > 0)
+            frame += " (" + std::string(info.short_src) + ":" + std::to_string(info.currentline) + ")";
+        else
+            frame += " (" + std::string(info.short_src) + ")";
+
+        std::replace(frame.begin(), frame.end(), ';', ':');
+
+        stack = stack.empty() ? frame : frame + ";" + stack;
+    }
+
+    samples[stack] += count;
+}
+
+
+/**
+ * Handle a tick of the timer.
+ */
+static void profiler_tick(int sig)
+{
+    (void)sig;
+
+    if (profiler_lua_depth > 0 && profiled != NULL)
+    {
+        pending = pending + 1;
+
+        if (lua_gethook(profiled) != profiler_hook)
+        {
+            saved_hook  = lua_gethook(profiled);
+            saved_mask  = lua_gethookmask(profiled);
+            saved_count = lua_gethookcount(profiled);
+        }
+
+        lua_sethook(profiled, profiler_hook, LUA_MASKCOUNT, 1);
+    }
+    else
+    {
+        outside = outside + 1;
+    }
+}
+
+
+/**
+ * Start sampling the given Lua state.
+ */
+bool profiler_start(lua_State *L, long interval)
+{
+    if (profiled != NULL)
+        return false;
+
+    samples.clear();
+    pending  = 0;
+    outside  = 0;
+    profiled = L;
+
+    saved_hook  = NULL;
+    saved_mask  = 0;
+    saved_count = 0;
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = profiler_tick;
+    sa.sa_flags   = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGPROF, &sa, &previous);
+
+    struct itimerval timer;
+    timer.it_interval.tv_sec  = interval / 1000000;
+    timer.it_interval.tv_usec = interval % 1000000;
+    timer.it_value            = timer.it_interval;
+    setitimer(ITIMER_PROF, &timer, NULL);
+
+    return true;
+}
+
+
+/**
+ * Is the profiler running?
+ */
+bool profiler_running()
+{
+    return (profiled != NULL);
+}
+
+
+/**
+ * Stop the profiler, returning the samples as folded stacks.
+ */
+std::string profiler_stop()
+{
+    if (profiled == NULL)
+        return "";
+
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    setitimer(ITIMER_PROF, &timer, NULL);
+    sigaction(SIGPROF, &previous, NULL);
+
+    if (lua_gethook(profiled) == profiler_hook)
+        lua_sethook(profiled, saved_hook, saved_mask, saved_count);
+
+    profiled = NULL;
+
+    std::string out;
+
+    for (std::map<std::string, long>::iterator it = samples.begin(); it != samples.end(); ++it)
+        out += it->first + " " + std::to_string(it->second) + "\n";
+
+    /*
+     * Time spent outside Lua is shown for comparison.
+     */
+    if (outside > 0)
+        out += "[editor] " + std::to_string(outside) + "\n";
+
+    samples.clear();
+    return (out);
+}
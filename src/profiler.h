@@ -0,0 +1,90 @@
+/* profiler.h - A sampling profiler for Lua code.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <signal.h>
+#include <string>
+
+#include "lua_primitives.h"
+
+
+/**
+ * How deeply we're nested within calls to Lua.
+ *
+ * The profiler only samples the Lua stack if a tick arrives while Lua is
+ * running, including any C primitives it calls.
+ *
+ * Each thread has its own count, as in batch-mode each runs its own Lua
+ * state - the profiler itself is only available interactively.
+ */
+extern thread_local volatile sig_atomic_t profiler_lua_depth;
+
+
+/**
+ * Record that the enclosing scope is running Lua code.
+ *
+ * This costs an increment, and a decrement, whether or not the profiler
+ * is running - there is no hook, or timer, until it is started.
+ */
+class lua_running
+{
+public:
+    lua_running()
+    {
+        profiler_lua_depth = profiler_lua_depth + 1;
+    };
+
+    ~lua_running()
+    {
+        profiler_lua_depth = profiler_lua_depth - 1;
+    };
+};
+
+
+/**
+ * Start sampling the given Lua state, every `interval` microseconds of
+ * CPU-time.
+ *
+ * Returns false if the profiler is already running.
+ */
+bool profiler_start(lua_State *L, long interval);
+
+/**
+ * Is the profiler running?
+ */
+bool profiler_running();
+
+/**
+ * Stop the profiler, returning the samples as folded stacks - one line
+ * for each distinct stack, with the number of samples taken in it, as
+ * flamegraph.pl expects.
+ */
+std::string profiler_stop();
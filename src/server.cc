@@ -0,0 +1,341 @@
+/* server.cc - Reusing a running editor, to open files.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <set>
+#include <map>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "server.h"
+
+
+
+/*
+ * The protocol is simple: the client sends the absolute path of each file
+ * it wishes to open, one per line, and then shuts down its side of the
+ * connection.  The server opens each file in a new buffer, and once all
+ * of them have been killed it sends "done\n" and closes the connection.
+ */
+
+
+/**
+ * A connected client.
+ */
+struct client
+{
+    /*
+     * Input we've not yet processed, as it lacks a newline.
+     */
+    std::string input;
+
+    /*
+     * The IDs of the buffers we opened for this client, which are still
+     * alive.
+     */
+    std::set<int> buffers;
+
+    /*
+     * Has the client finished sending requests?
+     */
+    bool eof;
+};
+
+
+/*
+ * Our clients, by their file-descriptor.
+ */
+static std::map<int, client> clients;
+
+/*
+ * The socket we're listening upon, removed when we exit.
+ */
+static std::string listening;
+
+
+/**
+ * The path of the socket a server listens upon.
+ */
+std::string server_socket_path()
+{
+    const char *runtime = getenv("XDG_RUNTIME_DIR");
+
+    if (runtime != NULL && runtime[0] != '\0')
+        return (std::string(runtime) + "/kilua.sock");
+
+    /*
+     * /tmp is shared, so we use a directory which must belong to us,
+     * and be inaccessible to everybody else.
+     */
+    std::string dir = "/tmp/kilua-" + std::to_string(getuid());
+    mkdir(dir.c_str(), 0700);
+
+    struct stat sb;
+
+    if (lstat(dir.c_str(), &sb) != 0 || !S_ISDIR(sb.st_mode) ||
+            sb.st_uid != getuid() || (sb.st_mode & 077) != 0)
+        return "";
+
+    return (dir + "/server");
+}
+
+
+/**
+ * Fill in the address of the socket, returning false if the path is too
+ * long.
+ */
+static bool socket_address(const std::string &path, struct sockaddr_un *addr)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+
+    if (path.empty() || path.size() >= sizeof(addr->sun_path))
+        return false;
+
+    strcpy(addr->sun_path, path.c_str());
+    return true;
+}
+
+
+/**
+ * Remove our socket as we exit.
+ */
+static void server_stop()
+{
+    if (!listening.empty())
+        unlink(listening.c_str());
+}
+
+
+/**
+ * Tell the client we're done, if all its buffers have been killed, and
+ * it has finished sending requests.
+ */
+static void client_check(int fd)
+{
+    client &c = clients[fd];
+
+    if (!c.eof || !c.buffers.empty())
+        return;
+
+    send(fd, "done\n", 5, MSG_NOSIGNAL);
+    close(fd);
+    clients.erase(fd);
+}
+
+
+/**
+ * Read requests from a client.
+ */
+static void client_read(Editor *e, int fd)
+{
+    client &c = clients[fd];
+
+    char buf[4096];
+    ssize_t n = read(fd, buf, sizeof(buf));
+
+    if (n > 0)
+        c.input.append(buf, n);
+
+    /*
+     * Open the file named on each complete line.
+     */
+    size_t nl;
+
+    while ((nl = c.input.find('\n')) != std::string::npos)
+    {
+        std::string path = c.input.substr(0, nl);
+        c.input.erase(0, nl + 1);
+
+        if (path.empty())
+            continue;
+
+        e->load_files(std::vector<std::string>(1, path));
+        c.buffers.insert(e->current_buffer()->id());
+    }
+
+    if (n <= 0)
+    {
+        e->events()->unwatch_fd(fd);
+        c.eof = true;
+        client_check(fd);
+    }
+}
+
+
+/**
+ * Listen for clients, which ask us to open files.
+ */
+bool server_start(Editor *e)
+{
+    std::string path = server_socket_path();
+    struct sockaddr_un addr;
+
+    if (!socket_address(path, &addr))
+    {
+        e->set_status(1, "Not starting the server, there is no safe location for its socket");
+        return false;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if (fd < 0)
+        return false;
+
+    /*
+     * If there's a server running already we leave it alone, otherwise
+     * the socket is left over from one which has gone.
+     */
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+    {
+        close(fd);
+        e->set_status(1, "Not starting the server, one is already running on %s", path.c_str());
+        return false;
+    }
+
+    unlink(path.c_str());
+
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, 16) != 0)
+    {
+        e->set_status(1, "Failed to start the server on %s: %s", path.c_str(), strerror(errno));
+        close(fd);
+        return false;
+    }
+
+    listening = path;
+    atexit(server_stop);
+
+    /*
+     * Accept clients.
+     */
+    e->events()->watch_fd(fd, [e](int fd)
+    {
+        int conn = accept4(fd, NULL, NULL, SOCK_CLOEXEC);
+
+        if (conn < 0)
+            return;
+
+        clients[conn].eof = false;
+
+        e->events()->watch_fd(conn, [e](int conn)
+        {
+            client_read(e, conn);
+        });
+    });
+
+    /*
+     * When a buffer is killed the client which opened it might be done.
+     */
+    e->on_kill([](int id)
+    {
+        std::vector<int> fds;
+
+        for (std::map<int, client>::iterator it = clients.begin(); it != clients.end(); ++it)
+        {
+            if (it->second.buffers.erase(id))
+                fds.push_back(it->first);
+        }
+
+        for (std::vector<int>::iterator it = fds.begin(); it != fds.end(); ++it)
+            client_check(*it);
+    });
+
+    e->set_status(1, "Listening for clients on %s", path.c_str());
+    return true;
+}
+
+
+/**
+ * Ask the running server to open the given files, and wait until their
+ * buffers have been killed.
+ */
+int client_main(std::vector<std::string> files)
+{
+    std::string path = server_socket_path();
+    struct sockaddr_un addr;
+
+    if (files.empty())
+    {
+        fprintf(stderr, "Usage: kilua --client file1 [file2 .. fileN]\n");
+        return 1;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd < 0 || !socket_address(path, &addr) ||
+            connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        fprintf(stderr, "kilua: there is no server running, start one with `kilua --server`\n");
+        return 1;
+    }
+
+    /*
+     * The server has its own working directory, so we send absolute
+     * paths.
+     */
+    char cwd[4096];
+
+    if (getcwd(cwd, sizeof(cwd)) == NULL)
+        cwd[0] = '\0';
+
+    std::string request;
+
+    for (std::vector<std::string>::iterator it = files.begin(); it != files.end(); ++it)
+    {
+        if ((*it)[0] != '/')
+            request += std::string(cwd) + "/";
+
+        request += *it + "\n";
+    }
+
+    if (send(fd, request.c_str(), request.size(), MSG_NOSIGNAL) != (ssize_t)request.size())
+    {
+        fprintf(stderr, "kilua: failed to send the request to the server\n");
+        return 1;
+    }
+
+    shutdown(fd, SHUT_WR);
+
+    /*
+     * Wait until we're told the buffers are gone - or the server exits.
+     */
+    char buf[64];
+
+    while (read(fd, buf, sizeof(buf)) > 0)
+        ;
+
+    close(fd);
+    return 0;
+}
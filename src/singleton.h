@@ -37,6 +37,9 @@
 
 /**
  * A template base-class implementing the common Singleton design-pattern.
+ *
+ * There is one instance per-thread, so that `--batch` may run an editor,
+ * and its Lua state, within each of its worker threads.
  */
 template <class T> class Singleton
 {
@@ -67,9 +70,9 @@ public:
 private:
 
     /**
-     * The one instance of our object.
+     * The one instance of our object, within this thread.
      */
-    static T* m_instance;
+    static thread_local T* m_instance;
 };
 
-template <class T> T* Singleton<T>::m_instance = NULL;
+template <class T> thread_local T* Singleton<T>::m_instance = NULL;
@@ -0,0 +1,153 @@
+/* stats.cc - Timings of the phases of our main-loop.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <string.h>
+
+#include "stats.h"
+
+
+/*
+ * The names of our phases, as shown by `stats()`.
+ */
+static const char *phase_names[STAT_MAX] =
+{
+    "read",
+    "key",
+    "idle",
+    "highlight",
+    "draw",
+    "refresh",
+    "gc",
+};
+
+
+/**
+ * Constructor.
+ */
+Stats::Stats()
+{
+    memset(m_phases, 0, sizeof(m_phases));
+}
+
+
+/**
+ * Record that the given phase took `us` microseconds.
+ */
+void Stats::record(stat_phase phase, long us)
+{
+    struct phase &p = m_phases[phase];
+
+    p.samples[p.count % RING_SIZE] = us;
+    p.count += 1;
+    p.total += us;
+
+    if (us > p.max)
+        p.max = us;
+}
+
+
+/**
+ * Note that the timing of the given phase has started.
+ */
+int Stats::enter(stat_phase phase)
+{
+    return (m_phases[phase].depth++);
+}
+
+
+/**
+ * Note that the timing of the given phase has finished.
+ */
+int Stats::leave(stat_phase phase)
+{
+    return (--m_phases[phase].depth);
+}
+
+
+/**
+ * The name of the given phase.
+ */
+const char *Stats::name(stat_phase phase)
+{
+    return (phase_names[phase]);
+}
+
+
+/**
+ * The number of times the phase has been recorded.
+ */
+long Stats::count(stat_phase phase)
+{
+    return (m_phases[phase].count);
+}
+
+
+/**
+ * The mean time the phase has taken, in milliseconds.
+ */
+double Stats::mean(stat_phase phase)
+{
+    struct phase &p = m_phases[phase];
+
+    if (p.count == 0)
+        return 0;
+
+    return (p.total / 1000.0 / p.count);
+}
+
+
+/**
+ * The given percentile of the recent times the phase has taken.
+ */
+double Stats::percentile(stat_phase phase, int pc)
+{
+    struct phase &p = m_phases[phase];
+    int n = std::min(p.count, (long)RING_SIZE);
+
+    if (n == 0)
+        return 0;
+
+    int sorted[RING_SIZE];
+    memcpy(sorted, p.samples, n * sizeof(int));
+    std::sort(sorted, sorted + n);
+
+    int i = (pc * n + 99) / 100;
+    return (sorted[i > 0 ? i - 1 : 0] / 1000.0);
+}
+
+
+/**
+ * The longest time the phase has taken, in milliseconds.
+ */
+double Stats::max(stat_phase phase)
+{
+    return (m_phases[phase].max / 1000.0);
+}
@@ -0,0 +1,145 @@
+/* stats.h - Timings of the phases of our main-loop.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include "util.h"
+
+
+/**
+ * The phases of the main-loop which we time.
+ */
+enum stat_phase
+{
+    STAT_READ,
+    STAT_KEY,
+    STAT_IDLE,
+    STAT_HIGHLIGHT,
+    STAT_DRAW,
+    STAT_REFRESH,
+    STAT_GC,
+    STAT_MAX
+};
+
+
+/**
+ * Timings of each phase of the main-loop.
+ *
+ * We keep the count, and total time, of every sample, along with the
+ * most recent samples in a fixed-size ring from which percentiles are
+ * calculated.  Recording a sample never allocates, or locks.
+ */
+class Stats
+{
+public:
+    Stats();
+
+public:
+    /**
+     * Record that the given phase took `us` microseconds.
+     */
+    void record(stat_phase phase, long us);
+
+    /**
+     * Note that the timing of the given phase has started, or finished,
+     * returning the number of enclosing timings of it still running.
+     */
+    int enter(stat_phase phase);
+    int leave(stat_phase phase);
+
+    /**
+     * The name of the given phase.
+     */
+    const char *name(stat_phase phase);
+
+    /**
+     * The number of times the phase has been recorded.
+     */
+    long count(stat_phase phase);
+
+    /**
+     * The mean time the phase has taken, in milliseconds.
+     */
+    double mean(stat_phase phase);
+
+    /**
+     * The given percentile of the recent times the phase has taken, in
+     * milliseconds.
+     */
+    double percentile(stat_phase phase, int p);
+
+    /**
+     * The longest time the phase has taken, in milliseconds.
+     */
+    double max(stat_phase phase);
+
+private:
+    /**
+     * The number of samples we keep for each phase.
+     */
+    static const int RING_SIZE = 1024;
+
+    struct phase
+    {
+        long count;
+        long total;
+        long max;
+        int depth;
+        int samples[RING_SIZE];
+    };
+
+    phase m_phases[STAT_MAX];
+};
+
+
+/**
+ * Record the time taken by the enclosing scope, as the given phase.
+ *
+ * If the phase is already being timed the outermost timer records it.
+ */
+class stat_timer
+{
+public:
+    stat_timer(Stats *stats, stat_phase phase) : m_stats(stats), m_phase(phase), m_start(Util::now_us())
+    {
+        m_stats->enter(m_phase);
+    };
+
+    ~stat_timer()
+    {
+        if (m_stats->leave(m_phase) == 0)
+            m_stats->record(m_phase, Util::now_us() - m_start);
+    };
+
+private:
+    Stats *m_stats;
+    stat_phase m_phase;
+    long m_start;
+};
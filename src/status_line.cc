@@ -0,0 +1,350 @@
+/* status_line.cc - Rendering the status-bar from a template.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "status_line.h"
+
+
+/*
+ * The names of our fields.
+ */
+static const struct
+{
+    const char *name;
+    status_field type;
+} field_names[] =
+{
+    { "buffer",   FIELD_BUFFER },
+    { "buffers",  FIELD_BUFFERS },
+    { "date",     FIELD_DATE },
+    { "file",     FIELD_FILE },
+    { "mode",     FIELD_MODE },
+    { "modified", FIELD_MODIFIED },
+    { "point",    FIELD_POINT },
+    { "syntax",   FIELD_SYNTAX },
+    { "time",     FIELD_TIME },
+    { "x",        FIELD_X },
+    { "y",        FIELD_Y },
+};
+
+
+/**
+ * Count the characters in the given UTF-8 string.
+ */
+static int utf8_length(const std::string &str)
+{
+    int len = 0;
+
+    for (std::string::const_iterator it = str.begin(); it != str.end(); ++it)
+    {
+        if ((*it & 0xC0) != 0x80)
+            len++;
+    }
+
+    return len;
+}
+
+
+/**
+ * Constructor.
+ */
+StatusLine::StatusLine()
+{
+    m_valid = false;
+}
+
+
+/**
+ * Set the template, and parse it.
+ */
+void StatusLine::set_format(const std::string &format)
+{
+    m_format = format;
+    m_segments.clear();
+    m_valid = false;
+
+    size_t pos = 0;
+    std::string text;
+
+    while (pos < format.size())
+    {
+        segment s;
+        s.cached = false;
+
+        if (format.compare(pos, 7, "#BLANK#") == 0)
+        {
+            s.type = FIELD_BLANK;
+            pos += 7;
+        }
+        else if (format.compare(pos, 2, "${") == 0 && format.find('}', pos) != std::string::npos)
+        {
+            size_t end = format.find('}', pos);
+            std::string name = format.substr(pos + 2, end - pos - 2);
+            pos = end + 1;
+
+            s.type = FIELD_TEXT;
+
+            if (name.size() > 2 && name.compare(name.size() - 2, 2, "()") == 0)
+            {
+                s.type = FIELD_LUA;
+                s.text = name.substr(0, name.size() - 2);
+            }
+
+            for (size_t i = 0; i < sizeof(field_names) / sizeof(field_names[0]); i++)
+            {
+                if (name == field_names[i].name)
+                    s.type = field_names[i].type;
+            }
+
+            /*
+             * Unknown names are shown literally.
+             */
+            if (s.type == FIELD_TEXT)
+                text += "${" + name + "}";
+        }
+        else
+        {
+            text += format[pos++];
+            continue;
+        }
+
+        /*
+         * Flush any literal text before this field.
+         */
+        if (!text.empty())
+        {
+            segment t;
+            t.type   = FIELD_TEXT;
+            t.text   = text;
+            t.cached = false;
+            m_segments.push_back(t);
+            text.clear();
+        }
+
+        if (s.type != FIELD_TEXT)
+            m_segments.push_back(s);
+    }
+
+    if (!text.empty())
+    {
+        segment t;
+        t.type   = FIELD_TEXT;
+        t.text   = text;
+        t.cached = false;
+        m_segments.push_back(t);
+    }
+}
+
+
+/**
+ * Get the template.
+ */
+std::string StatusLine::format()
+{
+    return (m_format);
+}
+
+
+/**
+ * Does the template contain the given field?
+ */
+bool StatusLine::uses(status_field type)
+{
+    for (std::vector<segment>::iterator it = m_segments.begin(); it != m_segments.end(); ++it)
+    {
+        if (it->type == type)
+            return true;
+    }
+
+    return false;
+}
+
+
+/**
+ * Does the template use the date?
+ */
+bool StatusLine::uses_date()
+{
+    return (uses(FIELD_DATE));
+}
+
+
+/**
+ * Does the template use the time?
+ */
+bool StatusLine::uses_time()
+{
+    return (uses(FIELD_TIME));
+}
+
+
+/**
+ * Forget the cached value of the given Lua function, or all of them.
+ */
+void StatusLine::invalidate(const std::string &name)
+{
+    for (std::vector<segment>::iterator it = m_segments.begin(); it != m_segments.end(); ++it)
+    {
+        if (it->type == FIELD_LUA && (name.empty() || it->text == name))
+        {
+            it->cached = false;
+            m_valid = false;
+        }
+    }
+}
+
+
+/**
+ * Render the status-bar.
+ */
+std::string StatusLine::render(const status_values &values, std::function<std::string(const std::string &)> lua)
+{
+    if (m_valid && values == m_values)
+        return (m_rendered);
+
+    /*
+     * Expand everything other than the padding, noting where that goes.
+     */
+    std::string out;
+    std::vector<size_t> blanks;
+
+    for (std::vector<segment>::iterator it = m_segments.begin(); it != m_segments.end(); ++it)
+    {
+        switch (it->type)
+        {
+        case FIELD_TEXT:
+            out += it->text;
+            break;
+
+        case FIELD_BLANK:
+            blanks.push_back(out.size());
+            break;
+
+        case FIELD_BUFFER:
+            out += std::to_string(values.buffer);
+            break;
+
+        case FIELD_BUFFERS:
+            out += std::to_string(values.buffers);
+            break;
+
+        case FIELD_DATE:
+            out += values.date;
+            break;
+
+        case FIELD_FILE:
+            out += values.file;
+            break;
+
+        case FIELD_MODE:
+            if (!values.syntax.empty())
+                out += values.syntax + "-mode";
+
+            break;
+
+        case FIELD_MODIFIED:
+            if (values.dirty)
+                out += "<modified>";
+
+            break;
+
+        case FIELD_POINT:
+            out += values.point;
+            break;
+
+        case FIELD_SYNTAX:
+            out += values.syntax;
+            break;
+
+        case FIELD_TIME:
+            out += values.time;
+            break;
+
+        case FIELD_X:
+            out += std::to_string(values.x);
+            break;
+
+        case FIELD_Y:
+            out += std::to_string(values.y);
+            break;
+
+        case FIELD_LUA:
+            if (!it->cached)
+            {
+                it->value  = lua(it->text);
+                it->cached = true;
+            }
+
+            out += it->value;
+            break;
+        }
+    }
+
+    /*
+     * Share the padding between the blanks, the first taking any
+     * remainder.
+     */
+    int pad = values.width - utf8_length(out);
+
+    if (pad > 0 && !blanks.empty())
+    {
+        int each  = pad / blanks.size();
+        int extra = pad % blanks.size();
+
+        for (size_t i = blanks.size(); i > 0; i--)
+        {
+            int n = each + (i == 1 ? extra : 0);
+            out.insert(blanks[i - 1], n, ' ');
+        }
+    }
+
+    /*
+     * Truncate, if it is too long.
+     */
+    if (pad < 0)
+    {
+        int len = 0;
+
+        for (size_t i = 0; i < out.size(); i++)
+        {
+            if ((out[i] & 0xC0) != 0x80 && len++ == values.width)
+            {
+                out.erase(i);
+                break;
+            }
+        }
+    }
+
+    m_values   = values;
+    m_rendered = out;
+    m_valid    = true;
+
+    return (m_rendered);
+}
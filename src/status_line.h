@@ -0,0 +1,172 @@
+/* status_line.h - Rendering the status-bar from a template.
+ *
+ * Copyright (C) 2016 Steve Kemp https://steve.kemp.fi/
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *  *  Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *
+ *  *  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+
+/**
+ * The things a status-bar template may contain.
+ */
+enum status_field
+{
+    FIELD_TEXT,
+    FIELD_BLANK,
+    FIELD_BUFFER,
+    FIELD_BUFFERS,
+    FIELD_DATE,
+    FIELD_FILE,
+    FIELD_MODE,
+    FIELD_MODIFIED,
+    FIELD_POINT,
+    FIELD_SYNTAX,
+    FIELD_TIME,
+    FIELD_X,
+    FIELD_Y,
+    FIELD_LUA
+};
+
+
+/**
+ * The values from which a status-bar is rendered.
+ *
+ * We only render the status-bar when one of these has changed.
+ */
+struct status_values
+{
+    int buffer;
+    int buffers;
+    std::string file;
+    std::string syntax;
+    bool dirty;
+    int x;
+    int y;
+    std::string point;
+    std::string date;
+    std::string time;
+    int width;
+
+    bool operator==(const status_values &other) const
+    {
+        return (buffer == other.buffer && buffers == other.buffers &&
+                file == other.file && syntax == other.syntax &&
+                dirty == other.dirty && x == other.x && y == other.y &&
+                point == other.point && date == other.date &&
+                time == other.time && width == other.width);
+    }
+};
+
+
+/**
+ * A status-bar, rendered from a template such as:
+ *
+ *    "${file} ${modified} #BLANK# Col:${x} Row:${y}"
+ *
+ * "#BLANK#" is replaced by the padding needed to fill the screen, and
+ * "${name()}" by the result of calling the Lua function `name` - which
+ * is cached until it is invalidated.
+ */
+class StatusLine
+{
+public:
+    /**
+     * Constructor.
+     */
+    StatusLine();
+
+public:
+    /**
+     * Set the template.  An empty template disables us.
+     */
+    void set_format(const std::string &format);
+
+    /**
+     * Get the template.
+     */
+    std::string format();
+
+    /**
+     * Does the template use the date, or the time?
+     *
+     * These are only worth calculating if so.
+     */
+    bool uses_date();
+    bool uses_time();
+
+    /**
+     * Forget the cached value of the given Lua function, or of all
+     * of them if the name is empty.
+     */
+    void invalidate(const std::string &name);
+
+    /**
+     * Render the status-bar, calling `lua` to get the value of any
+     * Lua functions which aren't cached.
+     */
+    std::string render(const status_values &values, std::function<std::string(const std::string &)> lua);
+
+private:
+
+    /**
+     * A part of the template.
+     *
+     * `text` is the literal text, or the name of a Lua function whose
+     * result is held in `value`.
+     */
+    struct segment
+    {
+        status_field type;
+        std::string text;
+        bool cached;
+        std::string value;
+    };
+
+    /**
+     * Does the template contain the given field?
+     */
+    bool uses(status_field type);
+
+    /**
+     * The template, and the segments we parsed it into.
+     */
+    std::string m_format;
+    std::vector<segment> m_segments;
+
+    /**
+     * The values we last rendered, and the result.
+     */
+    bool m_valid;
+    status_values m_values;
+    std::string m_rendered;
+};
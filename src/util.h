@@ -32,78 +32,302 @@
 
 #pragma once
 
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <time.h>
 
 
 /**
  * A utility class for converting strings and characters.
  *
- * We assume that a single ASCII character can become a wide
- * character of no more than 6 bytes.
+ * Text is always UTF-8, whatever the locale, and conversions append to
+ * caller-supplied storage rather than allocating their own.
+ *
+ * Bytes which aren't valid UTF-8 are decoded as the code points U+DC80 to
+ * U+DCFF, which can't otherwise appear, and are encoded back to the bytes
+ * they came from - so a file which isn't UTF-8 is saved unchanged.
  */
 class Util
 {
 public:
-    static const int max_len = 6;
+    /**
+     * The most bytes a single character may be encoded as.
+     */
+    static const int max_len = 4;
 
 
     /**
-     * Convert the single wide-character specified to
-     * an ASCII string.
-     *
-     * NOTE: The caller must `delete[]` the result.
+     * The number of bytes required to encode the given character as UTF-8.
      */
-    static char * wchar2ascii(wchar_t ch)
+    static int utf8_length(wchar_t c)
     {
-        std::wstring tmp;
-        tmp += ch;
+        unsigned int u = (unsigned int)c;
+
+        if (u < 0x80)
+            return 1;
 
-        char *str = new char[Util::max_len];
-        sprintf(str, "%ls", tmp.c_str());
+        if (u < 0x800)
+            return 2;
 
-        return (str);
-    }
+        if (u >= 0xDC80 && u <= 0xDCFF)
+            return 1;
+
+        if (u < 0x10000)
+            return 3;
+
+        if (u > 0x10FFFF)
+            return 3;
+
+        return 4;
+    };
 
 
     /**
-     * Convert a normal string to a wide string.
+     * Encode the given character as UTF-8, into a buffer which must have
+     * room for four bytes.
      *
-     * NOTE: The caller must `delete[]` the result.
+     * Characters beyond Unicode are encoded as U+FFFD.
+     *
+     * Returns the number of bytes written.
      */
-    static wchar_t * ascii2wide(const char *in)
+    static int utf8_encode(wchar_t c, char *out)
     {
-        size_t in_size  = strlen(in) + 1;
-        size_t out_size = in_size * Util::max_len;
+        unsigned int u = (unsigned int)c;
+
+        if (u < 0x80)
+        {
+            out[0] = u;
+            return 1;
+        }
+
+        if (u < 0x800)
+        {
+            out[0] = 0xC0 | (u >> 6);
+            out[1] = 0x80 | (u & 0x3F);
+            return 2;
+        }
+
+        if (u >= 0xDC80 && u <= 0xDCFF)
+        {
+            out[0] = u & 0xFF;
+            return 1;
+        }
+
+        if (u > 0x10FFFF)
+            u = 0xFFFD;
 
-        wchar_t* result = new wchar_t[out_size];
+        if (u < 0x10000)
+        {
+            out[0] = 0xE0 | (u >> 12);
+            out[1] = 0x80 | ((u >> 6) & 0x3F);
+            out[2] = 0x80 | (u & 0x3F);
+            return 3;
+        }
 
-        mbstowcs(result, in, out_size);
-        return (result);
+        out[0] = 0xF0 | ((u >> 18) & 0x07);
+        out[1] = 0x80 | ((u >> 12) & 0x3F);
+        out[2] = 0x80 | ((u >> 6) & 0x3F);
+        out[3] = 0x80 | (u & 0x3F);
+        return 4;
     };
 
 
     /**
-     * Convert the wide-character string specified to
-     * an ASCII string.
+     * Decode a single character from the `len` bytes of UTF-8 at `in`,
+     * which must be at least one.
      *
-     * NOTE: The caller must `delete[]` the result.
+     * Overlong encodings, surrogates, characters beyond Unicode, and
+     * truncated sequences are invalid, and their first byte is decoded
+     * alone, as described above.
+     *
+     * Returns the number of bytes consumed.
+     */
+    static size_t utf8_decode(const char *in, size_t len, wchar_t *out)
+    {
+        const unsigned char *s = (const unsigned char *)in;
+        unsigned int u = s[0];
+        size_t need;
+        unsigned int min;
+
+        if (u < 0x80)
+        {
+            *out = u;
+            return 1;
+        }
+
+        if (u >= 0xC2 && u <= 0xDF)
+        {
+            need = 1;
+            min  = 0x80;
+            u   &= 0x1F;
+        }
+        else if (u >= 0xE0 && u <= 0xEF)
+        {
+            need = 2;
+            min  = 0x800;
+            u   &= 0x0F;
+        }
+        else if (u >= 0xF0 && u <= 0xF4)
+        {
+            need = 3;
+            min  = 0x10000;
+            u   &= 0x07;
+        }
+        else
+        {
+            *out = 0xDC00 | s[0];
+            return 1;
+        }
+
+        if (len <= need)
+        {
+            *out = 0xDC00 | s[0];
+            return 1;
+        }
+
+        for (size_t i = 1; i <= need; i++)
+        {
+            if ((s[i] & 0xC0) != 0x80)
+            {
+                *out = 0xDC00 | s[0];
+                return 1;
+            }
+
+            u = (u << 6) | (s[i] & 0x3F);
+        }
+
+        if (u < min || u > 0x10FFFF || (u >= 0xD800 && u <= 0xDFFF))
+        {
+            *out = 0xDC00 | s[0];
+            return 1;
+        }
+
+        *out = u;
+        return need + 1;
+    };
+
+
+    /**
+     * The number of bytes at the start of the given string which are
+     * ASCII, tested eight at a time.
+     */
+    static size_t ascii_prefix(const char *in, size_t len)
+    {
+        size_t i = 0;
+
+        for (; i + 8 <= len; i += 8)
+        {
+            uint64_t word;
+            memcpy(&word, in + i, sizeof(word));
+
+            if (word & 0x8080808080808080ULL)
+                break;
+        }
+
+        while (i < len && !(in[i] & 0x80))
+            i++;
+
+        return i;
+    };
+
+
+    /**
+     * The number of bytes at the start of the given string which don't
+     * end within a character, as when a read splits one.
+     */
+    static size_t utf8_complete(const char *in, size_t len)
+    {
+        /*
+         * Look back for the lead-byte of the last character.
+         */
+        for (size_t back = 1; back <= 3 && back <= len; back++)
+        {
+            unsigned char c = in[len - back];
+
+            if ((c & 0xC0) == 0x80)
+                continue;
+
+            size_t need = (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : (c >= 0xC0) ? 2 : 1;
+            return (need > back && c < 0xF5) ? len - back : len;
+        }
+
+        return len;
+    };
+
+
+    /**
+     * Decode the given UTF-8, appending the characters to `out`.
      */
-    static char * wide2ascii(wchar_t *in)
+    static void utf8_to_wide(const char *in, size_t len, std::wstring &out)
     {
-        std::wstring tmp;
-        tmp += in;
+        size_t i = 0;
 
-        char *str = new char[(tmp.size() * Util::max_len) + 1];
-        sprintf(str, "%ls", in);
+        while (i < len)
+        {
+            size_t ascii = ascii_prefix(in + i, len - i);
 
-        return (str);
+            out.append(in + i, in + i + ascii);
+            i += ascii;
+
+            if (i < len)
+            {
+                wchar_t c;
+                i += utf8_decode(in + i, len - i, &c);
+                out += c;
+            }
+        }
     };
 
-    static char * widestr2ascii(std::wstring in)
+    static void utf8_to_wide(const char *in, std::wstring &out)
+    {
+        utf8_to_wide(in, strlen(in), out);
+    };
+
+
+    /**
+     * Encode the given characters as UTF-8, appending them to `out`.
+     */
+    static void wide_to_utf8(const wchar_t *in, size_t len, std::string &out)
+    {
+        char buf[max_len];
+
+        for (size_t i = 0; i < len; i++)
+        {
+            if ((unsigned int)in[i] < 0x80)
+                out += (char)in[i];
+            else
+                out.append(buf, utf8_encode(in[i], buf));
+        }
+    };
+
+    static void wide_to_utf8(const std::wstring &in, std::string &out)
+    {
+        wide_to_utf8(in.c_str(), in.size(), out);
+    };
+
+
+    /**
+     * Get the current (monotonic) time, in milliseconds.
+     */
+    static long now_ms()
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+    };
+
+
+    /**
+     * Get the current (monotonic) time, in microseconds.
+     */
+    static long now_us()
     {
-        size_t len = in.size() * 5 + 1;
-        char *str = new char[len + 1];
-        sprintf(str, "%ls", in.c_str());
-        return (str);
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
     };
 
 };
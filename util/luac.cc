@@ -0,0 +1,60 @@
+/* luac.cc - Compile Lua source to bytecode, at build-time.
+ *
+ * We use this rather than the `luac` binary, which isn't always installed,
+ * so that the bytecode we embed is always produced by the same version of
+ * Lua - or LuaJIT - which the editor is linked against.
+ *
+ * Usage: luac input.lua output.luac
+ */
+
+#include <stdio.h>
+
+extern "C" {
+#include <lua.h>
+#include <lauxlib.h>
+}
+
+
+/*
+ * Write the bytecode to the output file.
+ */
+static int writer(lua_State *L, const void *p, size_t size, void *ud)
+{
+    (void)L;
+    return (fwrite(p, 1, size, (FILE *)ud) != size);
+}
+
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "Usage: %s input.lua output.luac\n", argv[0]);
+        return 1;
+    }
+
+    lua_State *L = luaL_newstate();
+
+    if (luaL_loadfile(L, argv[1]) != 0)
+    {
+        fprintf(stderr, "%s\n", lua_tostring(L, -1));
+        return 1;
+    }
+
+    FILE *out = fopen(argv[2], "wb");
+
+    if (out == NULL)
+    {
+        perror(argv[2]);
+        return 1;
+    }
+
+    if (lua_dump(L, writer, out) != 0 || fclose(out) != 0)
+    {
+        fprintf(stderr, "Failed to write %s\n", argv[2]);
+        return 1;
+    }
+
+    lua_close(L);
+    return 0;
+}